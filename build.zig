@@ -9,10 +9,16 @@ const std = @import("std");
 pub fn build(b: *std.Build) void {
     const target = b.standardTargetOptions(.{});
     const optimize = b.standardOptimizeOption(.{});
+    // Render cache keys include a hash of the library sources, so cached output from any other
+    // build of the library is never served.
+    const options = b.addOptions();
+    options.addOption(u64, "source_hash", hashSources(b, &.{ "src/octomark.zig", "src/perfect_hash.zig", "src/emoji.zig" }));
+    const options_mod = options.createModule();
     const mod = b.addModule("octomark", .{
         .root_source_file = b.path("src/octomark.zig"),
         .target = target,
     });
+    mod.addImport("build_options", options_mod);
 
     const exe = b.addExecutable(.{
         .name = "octomark",
@@ -23,6 +29,7 @@ pub fn build(b: *std.Build) void {
         }),
     });
     exe.root_module.addImport("octomark", mod);
+    exe.root_module.addImport("build_options", options_mod);
 
     b.installArtifact(exe);
 
@@ -43,6 +50,7 @@ pub fn build(b: *std.Build) void {
         }),
     });
     benchmark_exe.root_module.addImport("octomark", mod);
+    benchmark_exe.root_module.addImport("build_options", options_mod);
 
     b.installArtifact(benchmark_exe);
 
@@ -60,6 +68,7 @@ pub fn build(b: *std.Build) void {
         }),
     });
     profile_exe.root_module.addImport("octomark", mod);
+    profile_exe.root_module.addImport("build_options", options_mod);
 
     b.installArtifact(profile_exe);
 
@@ -68,3 +77,14 @@ pub fn build(b: *std.Build) void {
     profile_step.dependOn(&profile_run.step);
     profile_run.step.dependOn(b.getInstallStep());
 }
+
+fn hashSources(b: *std.Build, paths: []const []const u8) u64 {
+    var h = std.hash.Wyhash.init(0);
+    for (paths) |path| {
+        const bytes = b.build_root.handle.readFileAlloc(b.allocator, path, 16 << 20) catch |e| {
+            std.debug.panic("unable to read {s}: {s}", .{ path, @errorName(e) });
+        };
+        h.update(bytes);
+    }
+    return h.final();
+}
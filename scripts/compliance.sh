@@ -8,3 +8,7 @@ zig build -Doptimize=ReleaseSafe
 # Run the compliance tests
 echo "Running CommonMark spec tests..."
 python3 commonmark-spec/test/spec_tests.py --program "./zig-out/bin/octomark" --spec commonmark-spec/spec.txt "$@"
+
+# Sanitizer regressions, in the same format
+echo "Running sanitizer tests..."
+python3 commonmark-spec/test/spec_tests.py --program "./zig-out/bin/octomark --sanitize" --spec scripts/sanitize.txt
@@ -13,6 +13,10 @@ pub fn main() !void {
         return;
     }
 
+    allocator.free(try verifyChunkBoundaries(allocator, block, .{}));
+    try verifyUtf8Boundaries(allocator);
+    try verifyLineEndings(allocator);
+
     const sizes_mb = [_]usize{ 10, 50, 100, 200 };
     var null_file = try std.fs.openFileAbsolute("/dev/null", .{ .mode = .write_only });
     defer null_file.close();
@@ -32,6 +36,7 @@ pub fn main() !void {
             std.mem.copyForwards(u8, data[p .. p + block.len], block);
             p += block.len;
         }
+        const total_lines = iterations * std.mem.count(u8, block, "\n");
 
         var parser: octomark.OctomarkParser = .{};
         try parser.init(allocator);
@@ -52,10 +57,347 @@ pub fn main() !void {
         const elapsed_ms = @as(f64, @floatFromInt(elapsed_ns)) / 1_000_000.0;
         const gb_s = (@as(f64, @floatFromInt(total_size)) / (1024.0 * 1024.0 * 1024.0)) /
             (@as(f64, @floatFromInt(elapsed_ns)) / 1_000_000_000.0);
+        const mlines_s = (@as(f64, @floatFromInt(total_lines)) / 1_000_000.0) /
+            (@as(f64, @floatFromInt(elapsed_ns)) / 1_000_000_000.0);
+
+        std.debug.print(
+            "Size: {d:>3} MB | Time: {d:>7.2} ms | Throughput: {d:.2} GB/s | {d:.2} M lines/s\n",
+            .{ target_mb, elapsed_ms, gb_s, mlines_s },
+        );
+    }
+
+    const iterations = @max(1, (50 * 1024 * 1024) / block.len);
+    const data = try allocator.alloc(u8, iterations * block.len);
+    defer allocator.free(data);
+    for (0..iterations) |i| @memcpy(data[i * block.len ..][0..block.len], block);
+    try benchUtf8Validation(allocator, null_file, data);
+    try benchDialect(allocator, null_file, data, "full", .{});
+    try benchDialect(allocator, null_file, data, "no html/tables", .{ .html = false, .tables = false });
+    try benchTokens(allocator, null_file, data);
+
+    try benchAutolinks(allocator, null_file, 200_000);
+    try benchEmoji(allocator, null_file, 200_000);
+    try benchFootnotes(allocator, null_file, 20_000);
+    try benchInlineTitles(1_000_000);
+
+    const threads = std.Thread.getCpuCount() catch 1;
+    try benchTable(allocator, null_file, 10, 100_000, 0);
+    try benchTable(allocator, null_file, 10, 100_000, threads);
+    try benchTable(allocator, null_file, 300, 10_000, 0);
+    try benchTable(allocator, null_file, 300, 10_000, threads);
+}
 
+/// Render `data` once to `null_file` and return the elapsed time in nanoseconds.
+fn timeRender(
+    comptime Parser: type,
+    allocator: std.mem.Allocator,
+    null_file: std.fs.File,
+    data: []const u8,
+    options: octomark.OctomarkOptions,
+) !u64 {
+    var parser: Parser = .{};
+    try parser.init(allocator);
+    defer parser.deinit(allocator);
+    parser.setOptions(options);
+
+    var write_buffer: [65536]u8 = undefined;
+    var writer = null_file.writer(&write_buffer);
+
+    var timer = try std.time.Timer.start();
+    var stream = std.io.fixedBufferStream(data);
+    try parser.parse(stream.reader(), &writer.interface, allocator);
+    try writer.interface.flush();
+    return timer.read();
+}
+
+/// Compare a render of `data` with UTF-8 validation on and off.
+fn benchUtf8Validation(allocator: std.mem.Allocator, null_file: std.fs.File, data: []const u8) !void {
+    for ([_]octomark.Utf8Policy{ .pass_through, .replace }) |policy| {
+        const elapsed_ns = try timeRender(octomark.OctomarkParser, allocator, null_file, data, .{ .utf8_policy = policy });
+        const seconds = @as(f64, @floatFromInt(elapsed_ns)) / 1_000_000_000.0;
         std.debug.print(
-            "Size: {d:>3} MB | Time: {d:>7.2} ms | Throughput: {d:.2} GB/s\n",
-            .{ target_mb, elapsed_ms, gb_s },
+            "UTF-8 policy: {s:<12} | Time: {d:>7.2} ms | Throughput: {d:.2} GB/s\n",
+            .{ @tagName(policy), seconds * 1000.0, @as(f64, @floatFromInt(data.len)) / (1024.0 * 1024.0 * 1024.0) / seconds },
         );
     }
 }
+
+fn benchDialect(
+    allocator: std.mem.Allocator,
+    null_file: std.fs.File,
+    data: []const u8,
+    name: []const u8,
+    comptime dialect: octomark.Dialect,
+) !void {
+    const elapsed_ns = try timeRender(octomark.Octomark(dialect), allocator, null_file, data, .{});
+    const seconds = @as(f64, @floatFromInt(elapsed_ns)) / 1_000_000_000.0;
+    std.debug.print(
+        "Dialect: {s:<14} | Time: {d:>7.2} ms | Throughput: {d:.2} GB/s\n",
+        .{ name, seconds * 1000.0, @as(f64, @floatFromInt(data.len)) / (1024.0 * 1024.0 * 1024.0) / seconds },
+    );
+}
+
+/// Compare a plain render of `data` with one that also streams search tokens to a counting sink.
+fn benchTokens(allocator: std.mem.Allocator, null_file: std.fs.File, data: []const u8) !void {
+    const counter = struct {
+        fn token(context: ?*anyopaque, _: octomark.Token) anyerror!void {
+            const count: *usize = @ptrCast(@alignCast(context.?));
+            count.* += 1;
+        }
+    };
+    var count: usize = 0;
+    for ([_]bool{ false, true }) |tokens| {
+        const sink: ?octomark.TokenSink = if (tokens) .{ .context = &count, .token = counter.token } else null;
+        const elapsed_ns = try timeRender(octomark.OctomarkParser, allocator, null_file, data, .{ .token_sink = sink });
+        const seconds = @as(f64, @floatFromInt(elapsed_ns)) / 1_000_000_000.0;
+        std.debug.print(
+            "Token sink: {} | Tokens: {d:>9} | Time: {d:>7.2} ms | Throughput: {d:.2} GB/s\n",
+            .{ tokens, count, seconds * 1000.0, @as(f64, @floatFromInt(data.len)) / (1024.0 * 1024.0 * 1024.0) / seconds },
+        );
+    }
+}
+
+/// Render a generated chat log full of bare URLs with and without extended autolinks.
+fn benchAutolinks(allocator: std.mem.Allocator, null_file: std.fs.File, lines: usize) !void {
+    var data = std.ArrayListUnmanaged(u8){};
+    defer data.deinit(allocator);
+    var line_buf: [256]u8 = undefined;
+    for (0..lines) |n| {
+        const line = try std.fmt.bufPrint(
+            &line_buf,
+            "[{d:0>2}:{d:0>2}] user{d}: see https://example.com/issues/{d}?tab=files, www.example.org/docs/(v{d}) or ops{d}@example.net.\n\n",
+            .{ n / 60 % 24, n % 60, n % 97, n, n % 7, n % 13 },
+        );
+        try data.appendSlice(allocator, line);
+    }
+    inline for (.{ false, true }) |autolinks| {
+        const elapsed_ns = try timeRender(octomark.Octomark(.{ .autolinks = autolinks }), allocator, null_file, data.items, .{});
+        const seconds = @as(f64, @floatFromInt(elapsed_ns)) / 1_000_000_000.0;
+        std.debug.print(
+            "Chat log {d} lines | Autolinks: {} | Time: {d:>7.2} ms | {d:.2} MB/s\n",
+            .{ lines, autolinks, seconds * 1000.0, @as(f64, @floatFromInt(data.items.len)) / (1024.0 * 1024.0) / seconds },
+        );
+    }
+}
+
+/// Render a generated chat log with shortcodes, unknown names and times (colons that are not
+/// shortcodes) on every line.
+fn benchEmoji(allocator: std.mem.Allocator, null_file: std.fs.File, lines: usize) !void {
+    var data = std.ArrayListUnmanaged(u8){};
+    defer data.deinit(allocator);
+    const names = [_][]const u8{ "tada", "+1", "rocket", "heavy_check_mark", "not_an_emoji", "eyes" };
+    var line_buf: [256]u8 = undefined;
+    for (0..lines) |n| {
+        const line = try std.fmt.bufPrint(
+            &line_buf,
+            "[{d:0>2}:{d:0>2}] user{d}: build {d} is green :{s}: thanks :{s}:\n\n",
+            .{ n / 60 % 24, n % 60, n % 97, n, names[n % names.len], names[n / 7 % names.len] },
+        );
+        try data.appendSlice(allocator, line);
+    }
+    inline for (.{ false, true }) |expand| {
+        const elapsed_ns = try timeRender(octomark.Octomark(.{ .emoji = expand }), allocator, null_file, data.items, .{});
+        const seconds = @as(f64, @floatFromInt(elapsed_ns)) / 1_000_000_000.0;
+        std.debug.print(
+            "Chat log {d} lines | Emoji: {} | Time: {d:>7.2} ms | {d:.2} MB/s\n",
+            .{ lines, expand, seconds * 1000.0, @as(f64, @floatFromInt(data.items.len)) / (1024.0 * 1024.0) / seconds },
+        );
+    }
+}
+
+/// Render a generated paper with three footnote references per paragraph and the definitions at
+/// the end of each section.
+fn benchFootnotes(allocator: std.mem.Allocator, null_file: std.fs.File, paragraphs: usize) !void {
+    var data = std.ArrayListUnmanaged(u8){};
+    defer data.deinit(allocator);
+    var buf: [512]u8 = undefined;
+    const per_section = 10;
+    var section: usize = 0;
+    while (section * per_section < paragraphs) : (section += 1) {
+        try data.appendSlice(allocator, try std.fmt.bufPrint(&buf, "## Section {d}\n\n", .{section}));
+        for (0..per_section) |k| {
+            const n = section * per_section + k;
+            try data.appendSlice(allocator, try std.fmt.bufPrint(
+                &buf,
+                "Prior work[^r{d}a] reports *consistent* results,[^r{d}b] although replication[^r{d}c] remains open.\n\n",
+                .{ n, n, n },
+            ));
+        }
+        for (0..per_section) |k| {
+            const n = section * per_section + k;
+            for ("abc") |tag| {
+                try data.appendSlice(allocator, try std.fmt.bufPrint(
+                    &buf,
+                    "[^r{d}{c}]: Author {d}, *Journal of Results* {d}, pp. {d}-{d}.\n",
+                    .{ n, tag, n % 50, 1990 + n % 30, n % 300, n % 300 + 12 },
+                ));
+            }
+        }
+        try data.append(allocator, '\n');
+    }
+    inline for (.{ false, true }) |footnotes| {
+        const elapsed_ns = try timeRender(octomark.Octomark(.{ .footnotes = footnotes }), allocator, null_file, data.items, .{});
+        const seconds = @as(f64, @floatFromInt(elapsed_ns)) / 1_000_000_000.0;
+        std.debug.print(
+            "Footnote corpus {d} paragraphs | Footnotes: {} | Time: {d:>7.2} ms | {d:.2} MB/s\n",
+            .{ paragraphs, footnotes, seconds * 1000.0, @as(f64, @floatFromInt(data.items.len)) / (1024.0 * 1024.0) / seconds },
+        );
+    }
+}
+
+/// Time short issue titles through `renderInline` and through a full parser, in ns per title.
+fn benchInlineTitles(count: usize) !void {
+    const titles = [_][]const u8{
+        "Fix `feed()` hang on *very* long lines",
+        "Crash when [linking](https://example.com) inside **bold** text",
+        "Support ~~strikethrough~~ in table captions & titles",
+        "Docs: explain `OctomarkOptions` <br> handling",
+    };
+    var out_buf: [1024]u8 = undefined;
+    var out = std.Io.Writer.fixed(&out_buf);
+
+    var timer = try std.time.Timer.start();
+    for (0..count) |n| {
+        out.end = 0;
+        try octomark.OctomarkParser.renderInline(titles[n % titles.len], .{}, &out);
+    }
+    const inline_ns = timer.read();
+
+    const allocator = std.heap.smp_allocator;
+    timer.reset();
+    for (0..count) |n| {
+        out.end = 0;
+        var parser: octomark.OctomarkParser = undefined;
+        try parser.init(allocator);
+        defer parser.deinit(allocator);
+        try parser.feed(titles[n % titles.len], &out, allocator);
+        try parser.finish(&out);
+    }
+    const full_ns = timer.read();
+
+    std.debug.print("Inline titles x {d} | renderInline: {d:.1} ns/title | full parser: {d:.1} ns/title\n", .{
+        count,
+        @as(f64, @floatFromInt(inline_ns)) / @as(f64, @floatFromInt(count)),
+        @as(f64, @floatFromInt(full_ns)) / @as(f64, @floatFromInt(count)),
+    });
+}
+
+fn benchTable(allocator: std.mem.Allocator, null_file: std.fs.File, columns: usize, rows: usize, threads: usize) !void {
+    var data = std.ArrayListUnmanaged(u8){};
+    defer data.deinit(allocator);
+    var num_buf: [32]u8 = undefined;
+
+    try data.append(allocator, '|');
+    for (0..columns) |c| try data.appendSlice(allocator, try std.fmt.bufPrint(&num_buf, " col{d} |", .{c}));
+    try data.appendSlice(allocator, "\n|");
+    for (0..columns) |_| try data.appendSlice(allocator, "---:|");
+    try data.append(allocator, '\n');
+    for (0..rows) |r| {
+        try data.append(allocator, '|');
+        for (0..columns) |c| try data.appendSlice(allocator, try std.fmt.bufPrint(&num_buf, " {d} |", .{r * columns + c}));
+        try data.append(allocator, '\n');
+    }
+
+    const elapsed_ns = try timeRender(octomark.OctomarkParser, allocator, null_file, data.items, .{ .table_threads = threads });
+    const seconds = @as(f64, @floatFromInt(elapsed_ns)) / 1_000_000_000.0;
+    std.debug.print(
+        "Table {d:>3} cols x {d:>6} rows | Threads: {d:>2} | Time: {d:>7.2} ms | {d:.2} MB/s | {d:.2} M cells/s\n",
+        .{
+            columns,
+            rows,
+            threads,
+            seconds * 1000.0,
+            @as(f64, @floatFromInt(data.items.len)) / (1024.0 * 1024.0) / seconds,
+            @as(f64, @floatFromInt(columns * rows)) / 1_000_000.0 / seconds,
+        },
+    );
+}
+
+/// Multibyte text, invalid bytes and a sequence cut off by the end of the input, so chunk
+/// boundaries fall inside UTF-8 sequences and the carried-over sequence paths all run.
+const utf8_corpus = "# \u{DC}berschrift \u{65E5}\u{672C}\u{8A9E}\n\n" ++
+    "Caf\u{E9} *na\u{EF}ve* r\u{E9}sum\u{E9} \u{2014} \u{201C}quoted\u{201D} \u{1F600} and **\u{7C97}\u{4F53}**\n" ++
+    "bad \xff byte, overlong \xc0\xaf, lone \x80 continuation, surrogate \xed\xa0\x80 end\n" ++
+    "cut \xe2\x82 mid-sequence and \xf0\x9f emoji\n\n" ++
+    "| a | \u{FC} |\n| - | - |\n| \u{1F600} | \xfe |\n\n" ++
+    "```\ncode \u{2713} \xc3\n```\n\n" ++
+    "tail \xf0\x9f\x98";
+
+/// Render `utf8_corpus` at every chunk size under each UTF-8 policy: `.replace` and
+/// `.pass_through` must match their single-chunk output, and `.reject` must fail every time.
+fn verifyUtf8Boundaries(allocator: std.mem.Allocator) !void {
+    for ([_]octomark.Utf8Policy{ .replace, .pass_through }) |policy| {
+        allocator.free(try verifyChunkBoundaries(allocator, utf8_corpus, .{ .utf8_policy = policy }));
+    }
+    var chunk_size: usize = 1;
+    while (chunk_size <= utf8_corpus.len) : (chunk_size += 1) {
+        if (renderChunked(allocator, utf8_corpus, chunk_size, .{ .utf8_policy = .reject })) |out| {
+            allocator.free(out);
+            std.debug.print("Invalid UTF-8 accepted at chunk size {d}\n", .{chunk_size});
+            return error.ChunkBoundaryMismatch;
+        } else |err| if (err != error.InvalidUtf8) return err;
+    }
+    std.debug.print("UTF-8 boundaries: every policy consistent for chunk sizes 1..{d}\n", .{utf8_corpus.len});
+}
+
+/// LF-terminated Markdown with NUL bytes; `verifyLineEndings` renders it with CRLF and CR line
+/// endings too.
+const newline_corpus = "# Title\n\nSome *text* with a NUL \x00 inside\nand a hard break  \nafter it\n\n" ++
+    "- item\n- item \x00 two\n\n> quote\n> more\n\n```\ncode\n\x00\n```\n\n| a | b |\n| - | - |\n| 1 | 2 |\n";
+
+/// Render `newline_corpus` with CRLF and with lone CR line endings at every chunk size, so a
+/// CR ends a chunk and a CRLF is split across two. Each must match the LF form with NUL
+/// already replaced by U+FFFD, as normalization promises.
+fn verifyLineEndings(allocator: std.mem.Allocator) !void {
+    const lf = try std.mem.replaceOwned(u8, allocator, newline_corpus, "\x00", "\u{FFFD}");
+    defer allocator.free(lf);
+    const expected = try verifyChunkBoundaries(allocator, lf, .{});
+    defer allocator.free(expected);
+    for ([_][]const u8{ "\r\n", "\r" }) |ending| {
+        const input = try std.mem.replaceOwned(u8, allocator, newline_corpus, "\n", ending);
+        defer allocator.free(input);
+        const out = try verifyChunkBoundaries(allocator, input, .{});
+        defer allocator.free(out);
+        if (!std.mem.eql(u8, expected, out)) {
+            std.debug.print("Line endings {any} render differently from LF\n", .{ending});
+            return error.NormalizationMismatch;
+        }
+    }
+}
+
+/// Render `input` at every chunk size and require output identical to a single-chunk render,
+/// which is returned.
+fn verifyChunkBoundaries(allocator: std.mem.Allocator, input: []const u8, options: octomark.OctomarkOptions) ![]u8 {
+    const reference = try renderChunked(allocator, input, input.len, options);
+    errdefer allocator.free(reference);
+    var chunk_size: usize = 1;
+    while (chunk_size < input.len) : (chunk_size += 1) {
+        const out = try renderChunked(allocator, input, chunk_size, options);
+        defer allocator.free(out);
+        if (!std.mem.eql(u8, reference, out)) {
+            std.debug.print("Chunk boundary mismatch at chunk size {d}\n", .{chunk_size});
+            return error.ChunkBoundaryMismatch;
+        }
+    }
+    std.debug.print("Chunk boundaries: identical output for chunk sizes 1..{d}\n", .{input.len});
+    return reference;
+}
+
+fn renderChunked(allocator: std.mem.Allocator, input: []const u8, chunk_size: usize, options: octomark.OctomarkOptions) ![]u8 {
+    var parser: octomark.OctomarkParser = undefined;
+    try parser.init(allocator);
+    defer parser.deinit(allocator);
+    parser.setOptions(options);
+
+    var out = std.Io.Writer.Allocating.init(allocator);
+    defer out.deinit();
+
+    var pos: usize = 0;
+    while (pos < input.len) {
+        const end = @min(pos + chunk_size, input.len);
+        try parser.feed(input[pos..end], &out.writer, allocator);
+        pos = end;
+    }
+    try parser.finish(&out.writer);
+    return allocator.dupe(u8, out.written());
+}
@@ -0,0 +1,3533 @@
+//! Emoji shortcodes (`:name:`) and their UTF-8 sequences, sorted by name. Names follow the
+//! GitHub/gemoji aliases plus CLDR short names, restricted to `[a-z0-9_+-]`.
+
+pub const Entry = struct { []const u8, []const u8 };
+
+pub const entries = [_]Entry{
+    .{ "+1", "\u{1F44D}" },
+    .{ "-1", "\u{1F44E}" },
+    .{ "100", "\u{1F4AF}" },
+    .{ "1234", "\u{1F522}" },
+    .{ "1st_place_medal", "\u{1F947}" },
+    .{ "2nd_place_medal", "\u{1F948}" },
+    .{ "3rd_place_medal", "\u{1F949}" },
+    .{ "8ball", "\u{1F3B1}" },
+    .{ "__1", "\u{1F44E}" },
+    .{ "a", "\u{1F170}" },
+    .{ "ab", "\u{1F18E}" },
+    .{ "abacus", "\u{1F9EE}" },
+    .{ "abc", "\u{1F524}" },
+    .{ "abcd", "\u{1F521}" },
+    .{ "accept", "\u{1F251}" },
+    .{ "adhesive_bandage", "\u{1FA79}" },
+    .{ "admission_tickets", "\u{1F39F}" },
+    .{ "adult", "\u{1F9D1}" },
+    .{ "adult_dark_skin_tone", "\u{1F9D1}\u{1F3FF}" },
+    .{ "adult_light_skin_tone", "\u{1F9D1}\u{1F3FB}" },
+    .{ "adult_medium-dark_skin_tone", "\u{1F9D1}\u{1F3FE}" },
+    .{ "adult_medium-light_skin_tone", "\u{1F9D1}\u{1F3FC}" },
+    .{ "adult_medium_skin_tone", "\u{1F9D1}\u{1F3FD}" },
+    .{ "aerial_tramway", "\u{1F6A1}" },
+    .{ "afghanistan", "\u{1F1E6}\u{1F1EB}" },
+    .{ "airplane", "\u{2708}" },
+    .{ "airplane_arrival", "\u{1F6EC}" },
+    .{ "airplane_arriving", "\u{1F6EC}" },
+    .{ "airplane_departure", "\u{1F6EB}" },
+    .{ "alarm_clock", "\u{23F0}" },
+    .{ "albania", "\u{1F1E6}\u{1F1F1}" },
+    .{ "alembic", "\u{2697}" },
+    .{ "algeria", "\u{1F1E9}\u{1F1FF}" },
+    .{ "alien", "\u{1F47D}" },
+    .{ "alien_monster", "\u{1F47E}" },
+    .{ "ambulance", "\u{1F691}" },
+    .{ "american_football", "\u{1F3C8}" },
+    .{ "american_samoa", "\u{1F1E6}\u{1F1F8}" },
+    .{ "amphora", "\u{1F3FA}" },
+    .{ "anchor", "\u{2693}" },
+    .{ "andorra", "\u{1F1E6}\u{1F1E9}" },
+    .{ "angel", "\u{1F47C}" },
+    .{ "anger", "\u{1F4A2}" },
+    .{ "anger_symbol", "\u{1F4A2}" },
+    .{ "angola", "\u{1F1E6}\u{1F1F4}" },
+    .{ "angry", "\u{1F620}" },
+    .{ "angry_face", "\u{1F620}" },
+    .{ "angry_face_with_horns", "\u{1F47F}" },
+    .{ "anguilla", "\u{1F1E6}\u{1F1EE}" },
+    .{ "anguished", "\u{1F627}" },
+    .{ "anguished_face", "\u{1F627}" },
+    .{ "ant", "\u{1F41C}" },
+    .{ "antarctica", "\u{1F1E6}\u{1F1F6}" },
+    .{ "antenna_bars", "\u{1F4F6}" },
+    .{ "anxious_face_with_sweat", "\u{1F630}" },
+    .{ "apple", "\u{1F34E}" },
+    .{ "aquarius", "\u{2652}" },
+    .{ "argentina", "\u{1F1E6}\u{1F1F7}" },
+    .{ "aries", "\u{2648}" },
+    .{ "armenia", "\u{1F1E6}\u{1F1F2}" },
+    .{ "arrow_backward", "\u{25C0}" },
+    .{ "arrow_double_down", "\u{23EC}" },
+    .{ "arrow_double_up", "\u{23EB}" },
+    .{ "arrow_down", "\u{2B07}" },
+    .{ "arrow_down_small", "\u{1F53D}" },
+    .{ "arrow_forward", "\u{25B6}" },
+    .{ "arrow_heading_down", "\u{2935}" },
+    .{ "arrow_heading_up", "\u{2934}" },
+    .{ "arrow_left", "\u{2B05}" },
+    .{ "arrow_lower_left", "\u{2199}" },
+    .{ "arrow_lower_right", "\u{2198}" },
+    .{ "arrow_right", "\u{27A1}" },
+    .{ "arrow_right_hook", "\u{21AA}" },
+    .{ "arrow_up", "\u{2B06}" },
+    .{ "arrow_up_down", "\u{2195}" },
+    .{ "arrow_up_small", "\u{1F53C}" },
+    .{ "arrow_upper_left", "\u{2196}" },
+    .{ "arrow_upper_right", "\u{2197}" },
+    .{ "arrows_clockwise", "\u{1F503}" },
+    .{ "arrows_counterclockwise", "\u{1F504}" },
+    .{ "art", "\u{1F3A8}" },
+    .{ "articulated_lorry", "\u{1F69B}" },
+    .{ "artist_palette", "\u{1F3A8}" },
+    .{ "aruba", "\u{1F1E6}\u{1F1FC}" },
+    .{ "ascension_island", "\u{1F1E6}\u{1F1E8}" },
+    .{ "astonished", "\u{1F632}" },
+    .{ "astonished_face", "\u{1F632}" },
+    .{ "athletic_shoe", "\u{1F45F}" },
+    .{ "atm", "\u{1F3E7}" },
+    .{ "atm_sign", "\u{1F3E7}" },
+    .{ "atom_symbol", "\u{269B}" },
+    .{ "australia", "\u{1F1E6}\u{1F1FA}" },
+    .{ "austria", "\u{1F1E6}\u{1F1F9}" },
+    .{ "auto_rickshaw", "\u{1F6FA}" },
+    .{ "automobile", "\u{1F697}" },
+    .{ "avocado", "\u{1F951}" },
+    .{ "axe", "\u{1FA93}" },
+    .{ "azerbaijan", "\u{1F1E6}\u{1F1FF}" },
+    .{ "b", "\u{1F171}" },
+    .{ "baby", "\u{1F476}" },
+    .{ "baby_angel", "\u{1F47C}" },
+    .{ "baby_angel_dark_skin_tone", "\u{1F47C}\u{1F3FF}" },
+    .{ "baby_angel_light_skin_tone", "\u{1F47C}\u{1F3FB}" },
+    .{ "baby_angel_medium-dark_skin_tone", "\u{1F47C}\u{1F3FE}" },
+    .{ "baby_angel_medium-light_skin_tone", "\u{1F47C}\u{1F3FC}" },
+    .{ "baby_angel_medium_skin_tone", "\u{1F47C}\u{1F3FD}" },
+    .{ "baby_bottle", "\u{1F37C}" },
+    .{ "baby_chick", "\u{1F424}" },
+    .{ "baby_dark_skin_tone", "\u{1F476}\u{1F3FF}" },
+    .{ "baby_light_skin_tone", "\u{1F476}\u{1F3FB}" },
+    .{ "baby_medium-dark_skin_tone", "\u{1F476}\u{1F3FE}" },
+    .{ "baby_medium-light_skin_tone", "\u{1F476}\u{1F3FC}" },
+    .{ "baby_medium_skin_tone", "\u{1F476}\u{1F3FD}" },
+    .{ "baby_symbol", "\u{1F6BC}" },
+    .{ "back", "\u{1F519}" },
+    .{ "back_arrow", "\u{1F519}" },
+    .{ "backhand_index_pointing_down", "\u{1F447}" },
+    .{ "backhand_index_pointing_down_dark_skin_tone", "\u{1F447}\u{1F3FF}" },
+    .{ "backhand_index_pointing_down_light_skin_tone", "\u{1F447}\u{1F3FB}" },
+    .{ "backhand_index_pointing_down_medium-dark_skin_tone", "\u{1F447}\u{1F3FE}" },
+    .{ "backhand_index_pointing_down_medium-light_skin_tone", "\u{1F447}\u{1F3FC}" },
+    .{ "backhand_index_pointing_down_medium_skin_tone", "\u{1F447}\u{1F3FD}" },
+    .{ "backhand_index_pointing_left", "\u{1F448}" },
+    .{ "backhand_index_pointing_left_dark_skin_tone", "\u{1F448}\u{1F3FF}" },
+    .{ "backhand_index_pointing_left_light_skin_tone", "\u{1F448}\u{1F3FB}" },
+    .{ "backhand_index_pointing_left_medium-dark_skin_tone", "\u{1F448}\u{1F3FE}" },
+    .{ "backhand_index_pointing_left_medium-light_skin_tone", "\u{1F448}\u{1F3FC}" },
+    .{ "backhand_index_pointing_left_medium_skin_tone", "\u{1F448}\u{1F3FD}" },
+    .{ "backhand_index_pointing_right", "\u{1F449}" },
+    .{ "backhand_index_pointing_right_dark_skin_tone", "\u{1F449}\u{1F3FF}" },
+    .{ "backhand_index_pointing_right_light_skin_tone", "\u{1F449}\u{1F3FB}" },
+    .{ "backhand_index_pointing_right_medium-dark_skin_tone", "\u{1F449}\u{1F3FE}" },
+    .{ "backhand_index_pointing_right_medium-light_skin_tone", "\u{1F449}\u{1F3FC}" },
+    .{ "backhand_index_pointing_right_medium_skin_tone", "\u{1F449}\u{1F3FD}" },
+    .{ "backhand_index_pointing_up", "\u{1F446}" },
+    .{ "backhand_index_pointing_up_dark_skin_tone", "\u{1F446}\u{1F3FF}" },
+    .{ "backhand_index_pointing_up_light_skin_tone", "\u{1F446}\u{1F3FB}" },
+    .{ "backhand_index_pointing_up_medium-dark_skin_tone", "\u{1F446}\u{1F3FE}" },
+    .{ "backhand_index_pointing_up_medium-light_skin_tone", "\u{1F446}\u{1F3FC}" },
+    .{ "backhand_index_pointing_up_medium_skin_tone", "\u{1F446}\u{1F3FD}" },
+    .{ "bacon", "\u{1F953}" },
+    .{ "badger", "\u{1F9A1}" },
+    .{ "badminton", "\u{1F3F8}" },
+    .{ "badminton_racquet_and_shuttlecock", "\u{1F3F8}" },
+    .{ "bagel", "\u{1F96F}" },
+    .{ "baggage_claim", "\u{1F6C4}" },
+    .{ "baguette_bread", "\u{1F956}" },
+    .{ "bahamas", "\u{1F1E7}\u{1F1F8}" },
+    .{ "bahrain", "\u{1F1E7}\u{1F1ED}" },
+    .{ "balance_scale", "\u{2696}" },
+    .{ "bald", "\u{1F9B2}" },
+    .{ "bald_man", "\u{1F468}\u{200D}\u{1F9B2}" },
+    .{ "bald_woman", "\u{1F469}\u{200D}\u{1F9B2}" },
+    .{ "ballet_shoes", "\u{1FA70}" },
+    .{ "balloon", "\u{1F388}" },
+    .{ "ballot_box_with_ballot", "\u{1F5F3}" },
+    .{ "ballot_box_with_check", "\u{2611}" },
+    .{ "bamboo", "\u{1F38D}" },
+    .{ "banana", "\u{1F34C}" },
+    .{ "bangbang", "\u{203C}" },
+    .{ "bangladesh", "\u{1F1E7}\u{1F1E9}" },
+    .{ "banjo", "\u{1FA95}" },
+    .{ "bank", "\u{1F3E6}" },
+    .{ "bar_chart", "\u{1F4CA}" },
+    .{ "barbados", "\u{1F1E7}\u{1F1E7}" },
+    .{ "barber", "\u{1F488}" },
+    .{ "barber_pole", "\u{1F488}" },
+    .{ "baseball", "\u{26BE}" },
+    .{ "basket", "\u{1F9FA}" },
+    .{ "basketball", "\u{1F3C0}" },
+    .{ "bat", "\u{1F987}" },
+    .{ "bath", "\u{1F6C0}" },
+    .{ "bathtub", "\u{1F6C1}" },
+    .{ "battery", "\u{1F50B}" },
+    .{ "beach_with_umbrella", "\u{1F3D6}" },
+    .{ "beaming_face_with_smiling_eyes", "\u{1F601}" },
+    .{ "bear", "\u{1F43B}" },
+    .{ "bear_face", "\u{1F43B}" },
+    .{ "bearded_person", "\u{1F9D4}" },
+    .{ "bearded_person_dark_skin_tone", "\u{1F9D4}\u{1F3FF}" },
+    .{ "bearded_person_light_skin_tone", "\u{1F9D4}\u{1F3FB}" },
+    .{ "bearded_person_medium-dark_skin_tone", "\u{1F9D4}\u{1F3FE}" },
+    .{ "bearded_person_medium-light_skin_tone", "\u{1F9D4}\u{1F3FC}" },
+    .{ "bearded_person_medium_skin_tone", "\u{1F9D4}\u{1F3FD}" },
+    .{ "beating_heart", "\u{1F493}" },
+    .{ "bed", "\u{1F6CF}" },
+    .{ "bee", "\u{1F41D}" },
+    .{ "beer", "\u{1F37A}" },
+    .{ "beer_mug", "\u{1F37A}" },
+    .{ "beers", "\u{1F37B}" },
+    .{ "beetle", "\u{1F41E}" },
+    .{ "beginner", "\u{1F530}" },
+    .{ "belarus", "\u{1F1E7}\u{1F1FE}" },
+    .{ "belgium", "\u{1F1E7}\u{1F1EA}" },
+    .{ "belize", "\u{1F1E7}\u{1F1FF}" },
+    .{ "bell", "\u{1F514}" },
+    .{ "bell_with_slash", "\u{1F515}" },
+    .{ "bellhop_bell", "\u{1F6CE}" },
+    .{ "benin", "\u{1F1E7}\u{1F1EF}" },
+    .{ "bento", "\u{1F371}" },
+    .{ "bento_box", "\u{1F371}" },
+    .{ "bermuda", "\u{1F1E7}\u{1F1F2}" },
+    .{ "beverage_box", "\u{1F9C3}" },
+    .{ "bhutan", "\u{1F1E7}\u{1F1F9}" },
+    .{ "bicycle", "\u{1F6B2}" },
+    .{ "bicyclist", "\u{1F6B4}" },
+    .{ "bike", "\u{1F6B2}" },
+    .{ "bikini", "\u{1F459}" },
+    .{ "billed_cap", "\u{1F9E2}" },
+    .{ "biohazard", "\u{2623}" },
+    .{ "biohazard_sign", "\u{2623}" },
+    .{ "bird", "\u{1F426}" },
+    .{ "birthday", "\u{1F382}" },
+    .{ "birthday_cake", "\u{1F382}" },
+    .{ "black_circle", "\u{26AB}" },
+    .{ "black_circle_for_record", "\u{23FA}" },
+    .{ "black_flag", "\u{1F3F4}" },
+    .{ "black_heart", "\u{1F5A4}" },
+    .{ "black_joker", "\u{1F0CF}" },
+    .{ "black_large_square", "\u{2B1B}" },
+    .{ "black_left__pointing_double_triangle_with_vertical_bar", "\u{23EE}" },
+    .{ "black_medium-small_square", "\u{25FE}" },
+    .{ "black_medium_small_square", "\u{25FE}" },
+    .{ "black_medium_square", "\u{25FC}" },
+    .{ "black_nib", "\u{2712}" },
+    .{ "black_right__pointing_double_triangle_with_vertical_bar", "\u{23ED}" },
+    .{ "black_right__pointing_triangle_with_double_vertical_bar", "\u{23EF}" },
+    .{ "black_small_square", "\u{25AA}" },
+    .{ "black_square_button", "\u{1F532}" },
+    .{ "black_square_for_stop", "\u{23F9}" },
+    .{ "blond-haired_man", "\u{1F471}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "blond-haired_man_dark_skin_tone", "\u{1F471}\u{1F3FF}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "blond-haired_man_light_skin_tone", "\u{1F471}\u{1F3FB}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "blond-haired_man_medium-dark_skin_tone", "\u{1F471}\u{1F3FE}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "blond-haired_man_medium-light_skin_tone", "\u{1F471}\u{1F3FC}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "blond-haired_man_medium_skin_tone", "\u{1F471}\u{1F3FD}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "blond-haired_person", "\u{1F471}" },
+    .{ "blond-haired_person_dark_skin_tone", "\u{1F471}\u{1F3FF}" },
+    .{ "blond-haired_person_light_skin_tone", "\u{1F471}\u{1F3FB}" },
+    .{ "blond-haired_person_medium-dark_skin_tone", "\u{1F471}\u{1F3FE}" },
+    .{ "blond-haired_person_medium-light_skin_tone", "\u{1F471}\u{1F3FC}" },
+    .{ "blond-haired_person_medium_skin_tone", "\u{1F471}\u{1F3FD}" },
+    .{ "blond-haired_woman", "\u{1F471}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "blond-haired_woman_dark_skin_tone", "\u{1F471}\u{1F3FF}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "blond-haired_woman_light_skin_tone", "\u{1F471}\u{1F3FB}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "blond-haired_woman_medium-dark_skin_tone", "\u{1F471}\u{1F3FE}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "blond-haired_woman_medium-light_skin_tone", "\u{1F471}\u{1F3FC}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "blond-haired_woman_medium_skin_tone", "\u{1F471}\u{1F3FD}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "blossom", "\u{1F33C}" },
+    .{ "blowfish", "\u{1F421}" },
+    .{ "blue_book", "\u{1F4D8}" },
+    .{ "blue_car", "\u{1F699}" },
+    .{ "blue_circle", "\u{1F535}" },
+    .{ "blue_heart", "\u{1F499}" },
+    .{ "blue_square", "\u{1F7E6}" },
+    .{ "blush", "\u{1F60A}" },
+    .{ "boar", "\u{1F417}" },
+    .{ "boat", "\u{26F5}" },
+    .{ "bolivia", "\u{1F1E7}\u{1F1F4}" },
+    .{ "bomb", "\u{1F4A3}" },
+    .{ "bone", "\u{1F9B4}" },
+    .{ "book", "\u{1F4D6}" },
+    .{ "bookmark", "\u{1F516}" },
+    .{ "bookmark_tabs", "\u{1F4D1}" },
+    .{ "books", "\u{1F4DA}" },
+    .{ "boom", "\u{1F4A5}" },
+    .{ "boot", "\u{1F462}" },
+    .{ "botswana", "\u{1F1E7}\u{1F1FC}" },
+    .{ "bottle_with_popping_cork", "\u{1F37E}" },
+    .{ "bouquet", "\u{1F490}" },
+    .{ "bouvet_island", "\u{1F1E7}\u{1F1FB}" },
+    .{ "bow", "\u{1F647}" },
+    .{ "bow_and_arrow", "\u{1F3F9}" },
+    .{ "bowl_with_spoon", "\u{1F963}" },
+    .{ "bowling", "\u{1F3B3}" },
+    .{ "boxing_glove", "\u{1F94A}" },
+    .{ "boy", "\u{1F466}" },
+    .{ "boy_dark_skin_tone", "\u{1F466}\u{1F3FF}" },
+    .{ "boy_light_skin_tone", "\u{1F466}\u{1F3FB}" },
+    .{ "boy_medium-dark_skin_tone", "\u{1F466}\u{1F3FE}" },
+    .{ "boy_medium-light_skin_tone", "\u{1F466}\u{1F3FC}" },
+    .{ "boy_medium_skin_tone", "\u{1F466}\u{1F3FD}" },
+    .{ "brain", "\u{1F9E0}" },
+    .{ "brazil", "\u{1F1E7}\u{1F1F7}" },
+    .{ "bread", "\u{1F35E}" },
+    .{ "breast-feeding", "\u{1F931}" },
+    .{ "breast-feeding_dark_skin_tone", "\u{1F931}\u{1F3FF}" },
+    .{ "breast-feeding_light_skin_tone", "\u{1F931}\u{1F3FB}" },
+    .{ "breast-feeding_medium-dark_skin_tone", "\u{1F931}\u{1F3FE}" },
+    .{ "breast-feeding_medium-light_skin_tone", "\u{1F931}\u{1F3FC}" },
+    .{ "breast-feeding_medium_skin_tone", "\u{1F931}\u{1F3FD}" },
+    .{ "brick", "\u{1F9F1}" },
+    .{ "bride_with_veil", "\u{1F470}" },
+    .{ "bride_with_veil_dark_skin_tone", "\u{1F470}\u{1F3FF}" },
+    .{ "bride_with_veil_light_skin_tone", "\u{1F470}\u{1F3FB}" },
+    .{ "bride_with_veil_medium-dark_skin_tone", "\u{1F470}\u{1F3FE}" },
+    .{ "bride_with_veil_medium-light_skin_tone", "\u{1F470}\u{1F3FC}" },
+    .{ "bride_with_veil_medium_skin_tone", "\u{1F470}\u{1F3FD}" },
+    .{ "bridge_at_night", "\u{1F309}" },
+    .{ "briefcase", "\u{1F4BC}" },
+    .{ "briefs", "\u{1FA72}" },
+    .{ "bright_button", "\u{1F506}" },
+    .{ "british_indian_ocean_territory", "\u{1F1EE}\u{1F1F4}" },
+    .{ "british_virgin_islands", "\u{1F1FB}\u{1F1EC}" },
+    .{ "broccoli", "\u{1F966}" },
+    .{ "broken_heart", "\u{1F494}" },
+    .{ "broom", "\u{1F9F9}" },
+    .{ "brown_circle", "\u{1F7E4}" },
+    .{ "brown_heart", "\u{1F90E}" },
+    .{ "brown_square", "\u{1F7EB}" },
+    .{ "brunei", "\u{1F1E7}\u{1F1F3}" },
+    .{ "bug", "\u{1F41B}" },
+    .{ "building_construction", "\u{1F3D7}" },
+    .{ "bulb", "\u{1F4A1}" },
+    .{ "bulgaria", "\u{1F1E7}\u{1F1EC}" },
+    .{ "bullet_train", "\u{1F685}" },
+    .{ "bullettrain_front", "\u{1F685}" },
+    .{ "bullettrain_side", "\u{1F684}" },
+    .{ "burkina_faso", "\u{1F1E7}\u{1F1EB}" },
+    .{ "burrito", "\u{1F32F}" },
+    .{ "burundi", "\u{1F1E7}\u{1F1EE}" },
+    .{ "bus", "\u{1F68C}" },
+    .{ "bus_stop", "\u{1F68F}" },
+    .{ "busstop", "\u{1F68F}" },
+    .{ "bust_in_silhouette", "\u{1F464}" },
+    .{ "busts_in_silhouette", "\u{1F465}" },
+    .{ "butter", "\u{1F9C8}" },
+    .{ "butterfly", "\u{1F98B}" },
+    .{ "cactus", "\u{1F335}" },
+    .{ "cake", "\u{1F370}" },
+    .{ "calendar", "\u{1F4C6}" },
+    .{ "call_me_hand", "\u{1F919}" },
+    .{ "call_me_hand_dark_skin_tone", "\u{1F919}\u{1F3FF}" },
+    .{ "call_me_hand_light_skin_tone", "\u{1F919}\u{1F3FB}" },
+    .{ "call_me_hand_medium-dark_skin_tone", "\u{1F919}\u{1F3FE}" },
+    .{ "call_me_hand_medium-light_skin_tone", "\u{1F919}\u{1F3FC}" },
+    .{ "call_me_hand_medium_skin_tone", "\u{1F919}\u{1F3FD}" },
+    .{ "calling", "\u{1F4F2}" },
+    .{ "cambodia", "\u{1F1F0}\u{1F1ED}" },
+    .{ "camel", "\u{1F42B}" },
+    .{ "camera", "\u{1F4F7}" },
+    .{ "camera_with_flash", "\u{1F4F8}" },
+    .{ "cameroon", "\u{1F1E8}\u{1F1F2}" },
+    .{ "camping", "\u{1F3D5}" },
+    .{ "canada", "\u{1F1E8}\u{1F1E6}" },
+    .{ "canary_islands", "\u{1F1EE}\u{1F1E8}" },
+    .{ "cancer", "\u{264B}" },
+    .{ "candle", "\u{1F56F}" },
+    .{ "candy", "\u{1F36C}" },
+    .{ "canned_food", "\u{1F96B}" },
+    .{ "canoe", "\u{1F6F6}" },
+    .{ "cape_verde", "\u{1F1E8}\u{1F1FB}" },
+    .{ "capital_abcd", "\u{1F520}" },
+    .{ "capricorn", "\u{2651}" },
+    .{ "car", "\u{1F697}" },
+    .{ "card_file_box", "\u{1F5C3}" },
+    .{ "card_index", "\u{1F4C7}" },
+    .{ "card_index_dividers", "\u{1F5C2}" },
+    .{ "caribbean_netherlands", "\u{1F1E7}\u{1F1F6}" },
+    .{ "carousel_horse", "\u{1F3A0}" },
+    .{ "carp_streamer", "\u{1F38F}" },
+    .{ "carrot", "\u{1F955}" },
+    .{ "castle", "\u{1F3F0}" },
+    .{ "cat", "\u{1F431}" },
+    .{ "cat2", "\u{1F408}" },
+    .{ "cat_face", "\u{1F431}" },
+    .{ "cat_face_with_tears_of_joy", "\u{1F639}" },
+    .{ "cat_face_with_wry_smile", "\u{1F63C}" },
+    .{ "cayman_islands", "\u{1F1F0}\u{1F1FE}" },
+    .{ "cd", "\u{1F4BF}" },
+    .{ "central_african_republic", "\u{1F1E8}\u{1F1EB}" },
+    .{ "chad", "\u{1F1F9}\u{1F1E9}" },
+    .{ "chains", "\u{26D3}" },
+    .{ "chair", "\u{1FA91}" },
+    .{ "chart", "\u{1F4B9}" },
+    .{ "chart_decreasing", "\u{1F4C9}" },
+    .{ "chart_increasing", "\u{1F4C8}" },
+    .{ "chart_increasing_with_yen", "\u{1F4B9}" },
+    .{ "chart_with_downwards_trend", "\u{1F4C9}" },
+    .{ "chart_with_upwards_trend", "\u{1F4C8}" },
+    .{ "checkered_flag", "\u{1F3C1}" },
+    .{ "cheese_wedge", "\u{1F9C0}" },
+    .{ "chequered_flag", "\u{1F3C1}" },
+    .{ "cherries", "\u{1F352}" },
+    .{ "cherry_blossom", "\u{1F338}" },
+    .{ "chess_pawn", "\u{265F}" },
+    .{ "chestnut", "\u{1F330}" },
+    .{ "chicken", "\u{1F414}" },
+    .{ "child", "\u{1F9D2}" },
+    .{ "child_dark_skin_tone", "\u{1F9D2}\u{1F3FF}" },
+    .{ "child_light_skin_tone", "\u{1F9D2}\u{1F3FB}" },
+    .{ "child_medium-dark_skin_tone", "\u{1F9D2}\u{1F3FE}" },
+    .{ "child_medium-light_skin_tone", "\u{1F9D2}\u{1F3FC}" },
+    .{ "child_medium_skin_tone", "\u{1F9D2}\u{1F3FD}" },
+    .{ "children_crossing", "\u{1F6B8}" },
+    .{ "chile", "\u{1F1E8}\u{1F1F1}" },
+    .{ "china", "\u{1F1E8}\u{1F1F3}" },
+    .{ "chipmunk", "\u{1F43F}" },
+    .{ "chocolate_bar", "\u{1F36B}" },
+    .{ "chopsticks", "\u{1F962}" },
+    .{ "christmas_island", "\u{1F1E8}\u{1F1FD}" },
+    .{ "christmas_tree", "\u{1F384}" },
+    .{ "church", "\u{26EA}" },
+    .{ "cigarette", "\u{1F6AC}" },
+    .{ "cinema", "\u{1F3A6}" },
+    .{ "circled_m", "\u{24C2}" },
+    .{ "circus_tent", "\u{1F3AA}" },
+    .{ "city_sunrise", "\u{1F307}" },
+    .{ "city_sunset", "\u{1F306}" },
+    .{ "cityscape", "\u{1F3D9}" },
+    .{ "cityscape_at_dusk", "\u{1F306}" },
+    .{ "cl", "\u{1F191}" },
+    .{ "cl_button", "\u{1F191}" },
+    .{ "clamp", "\u{1F5DC}" },
+    .{ "clap", "\u{1F44F}" },
+    .{ "clapper", "\u{1F3AC}" },
+    .{ "clapper_board", "\u{1F3AC}" },
+    .{ "clapping_hands", "\u{1F44F}" },
+    .{ "clapping_hands_dark_skin_tone", "\u{1F44F}\u{1F3FF}" },
+    .{ "clapping_hands_light_skin_tone", "\u{1F44F}\u{1F3FB}" },
+    .{ "clapping_hands_medium-dark_skin_tone", "\u{1F44F}\u{1F3FE}" },
+    .{ "clapping_hands_medium-light_skin_tone", "\u{1F44F}\u{1F3FC}" },
+    .{ "clapping_hands_medium_skin_tone", "\u{1F44F}\u{1F3FD}" },
+    .{ "classical_building", "\u{1F3DB}" },
+    .{ "clinking_beer_mugs", "\u{1F37B}" },
+    .{ "clinking_glasses", "\u{1F942}" },
+    .{ "clipboard", "\u{1F4CB}" },
+    .{ "clipperton_island", "\u{1F1E8}\u{1F1F5}" },
+    .{ "clock1", "\u{1F550}" },
+    .{ "clock10", "\u{1F559}" },
+    .{ "clock1030", "\u{1F565}" },
+    .{ "clock11", "\u{1F55A}" },
+    .{ "clock1130", "\u{1F566}" },
+    .{ "clock12", "\u{1F55B}" },
+    .{ "clock1230", "\u{1F567}" },
+    .{ "clock130", "\u{1F55C}" },
+    .{ "clock2", "\u{1F551}" },
+    .{ "clock230", "\u{1F55D}" },
+    .{ "clock3", "\u{1F552}" },
+    .{ "clock330", "\u{1F55E}" },
+    .{ "clock4", "\u{1F553}" },
+    .{ "clock430", "\u{1F55F}" },
+    .{ "clock5", "\u{1F554}" },
+    .{ "clock530", "\u{1F560}" },
+    .{ "clock6", "\u{1F555}" },
+    .{ "clock630", "\u{1F561}" },
+    .{ "clock7", "\u{1F556}" },
+    .{ "clock730", "\u{1F562}" },
+    .{ "clock8", "\u{1F557}" },
+    .{ "clock830", "\u{1F563}" },
+    .{ "clock9", "\u{1F558}" },
+    .{ "clock930", "\u{1F564}" },
+    .{ "clockwise_vertical_arrows", "\u{1F503}" },
+    .{ "closed_book", "\u{1F4D5}" },
+    .{ "closed_lock_with_key", "\u{1F510}" },
+    .{ "closed_mailbox_with_lowered_flag", "\u{1F4EA}" },
+    .{ "closed_mailbox_with_raised_flag", "\u{1F4EB}" },
+    .{ "closed_umbrella", "\u{1F302}" },
+    .{ "cloud", "\u{2601}" },
+    .{ "cloud_with_lightning", "\u{1F329}" },
+    .{ "cloud_with_lightning_and_rain", "\u{26C8}" },
+    .{ "cloud_with_rain", "\u{1F327}" },
+    .{ "cloud_with_snow", "\u{1F328}" },
+    .{ "cloud_with_tornado", "\u{1F32A}" },
+    .{ "clown_face", "\u{1F921}" },
+    .{ "club_suit", "\u{2663}" },
+    .{ "clubs", "\u{2663}" },
+    .{ "clutch_bag", "\u{1F45D}" },
+    .{ "coat", "\u{1F9E5}" },
+    .{ "cocktail", "\u{1F378}" },
+    .{ "cocktail_glass", "\u{1F378}" },
+    .{ "coconut", "\u{1F965}" },
+    .{ "coffee", "\u{2615}" },
+    .{ "coffin", "\u{26B0}" },
+    .{ "cold_face", "\u{1F976}" },
+    .{ "cold_sweat", "\u{1F630}" },
+    .{ "collision", "\u{1F4A5}" },
+    .{ "colombia", "\u{1F1E8}\u{1F1F4}" },
+    .{ "comet", "\u{2604}" },
+    .{ "comoros", "\u{1F1F0}\u{1F1F2}" },
+    .{ "compass", "\u{1F9ED}" },
+    .{ "compression", "\u{1F5DC}" },
+    .{ "computer", "\u{1F4BB}" },
+    .{ "computer_disk", "\u{1F4BD}" },
+    .{ "computer_mouse", "\u{1F5B1}" },
+    .{ "confetti_ball", "\u{1F38A}" },
+    .{ "confounded", "\u{1F616}" },
+    .{ "confounded_face", "\u{1F616}" },
+    .{ "confused", "\u{1F615}" },
+    .{ "confused_face", "\u{1F615}" },
+    .{ "congo_-_brazzaville", "\u{1F1E8}\u{1F1EC}" },
+    .{ "congo_-_kinshasa", "\u{1F1E8}\u{1F1E9}" },
+    .{ "congratulations", "\u{3297}" },
+    .{ "construction", "\u{1F6A7}" },
+    .{ "construction_worker", "\u{1F477}" },
+    .{ "construction_worker_dark_skin_tone", "\u{1F477}\u{1F3FF}" },
+    .{ "construction_worker_light_skin_tone", "\u{1F477}\u{1F3FB}" },
+    .{ "construction_worker_medium-dark_skin_tone", "\u{1F477}\u{1F3FE}" },
+    .{ "construction_worker_medium-light_skin_tone", "\u{1F477}\u{1F3FC}" },
+    .{ "construction_worker_medium_skin_tone", "\u{1F477}\u{1F3FD}" },
+    .{ "control_knobs", "\u{1F39B}" },
+    .{ "convenience_store", "\u{1F3EA}" },
+    .{ "cook_islands", "\u{1F1E8}\u{1F1F0}" },
+    .{ "cooked_rice", "\u{1F35A}" },
+    .{ "cookie", "\u{1F36A}" },
+    .{ "cooking", "\u{1F373}" },
+    .{ "cool", "\u{1F192}" },
+    .{ "cool_button", "\u{1F192}" },
+    .{ "cop", "\u{1F46E}" },
+    .{ "copyright", "\u{A9}" },
+    .{ "corn", "\u{1F33D}" },
+    .{ "costa_rica", "\u{1F1E8}\u{1F1F7}" },
+    .{ "couch_and_lamp", "\u{1F6CB}" },
+    .{ "counterclockwise_arrows_button", "\u{1F504}" },
+    .{ "couple", "\u{1F46B}" },
+    .{ "couple_with_heart", "\u{1F491}" },
+    .{ "couple_with_heart_man_man", "\u{1F468}\u{200D}\u{2764}\u{FE0F}\u{200D}\u{1F468}" },
+    .{ "couple_with_heart_woman_man", "\u{1F469}\u{200D}\u{2764}\u{FE0F}\u{200D}\u{1F468}" },
+    .{ "couple_with_heart_woman_woman", "\u{1F469}\u{200D}\u{2764}\u{FE0F}\u{200D}\u{1F469}" },
+    .{ "couplekiss", "\u{1F48F}" },
+    .{ "cow", "\u{1F42E}" },
+    .{ "cow2", "\u{1F404}" },
+    .{ "cow_face", "\u{1F42E}" },
+    .{ "cowboy_hat_face", "\u{1F920}" },
+    .{ "crab", "\u{1F980}" },
+    .{ "crayon", "\u{1F58D}" },
+    .{ "credit_card", "\u{1F4B3}" },
+    .{ "crescent_moon", "\u{1F319}" },
+    .{ "cricket", "\u{1F997}" },
+    .{ "cricket_bat_and_ball", "\u{1F3CF}" },
+    .{ "cricket_game", "\u{1F3CF}" },
+    .{ "croatia", "\u{1F1ED}\u{1F1F7}" },
+    .{ "crocodile", "\u{1F40A}" },
+    .{ "croissant", "\u{1F950}" },
+    .{ "cross_mark", "\u{274C}" },
+    .{ "cross_mark_button", "\u{274E}" },
+    .{ "crossed_fingers", "\u{1F91E}" },
+    .{ "crossed_fingers_dark_skin_tone", "\u{1F91E}\u{1F3FF}" },
+    .{ "crossed_fingers_light_skin_tone", "\u{1F91E}\u{1F3FB}" },
+    .{ "crossed_fingers_medium-dark_skin_tone", "\u{1F91E}\u{1F3FE}" },
+    .{ "crossed_fingers_medium-light_skin_tone", "\u{1F91E}\u{1F3FC}" },
+    .{ "crossed_fingers_medium_skin_tone", "\u{1F91E}\u{1F3FD}" },
+    .{ "crossed_flags", "\u{1F38C}" },
+    .{ "crossed_swords", "\u{2694}" },
+    .{ "crown", "\u{1F451}" },
+    .{ "cry", "\u{1F622}" },
+    .{ "crying_cat_face", "\u{1F63F}" },
+    .{ "crying_face", "\u{1F622}" },
+    .{ "crystal_ball", "\u{1F52E}" },
+    .{ "cuba", "\u{1F1E8}\u{1F1FA}" },
+    .{ "cucumber", "\u{1F952}" },
+    .{ "cup_with_straw", "\u{1F964}" },
+    .{ "cupcake", "\u{1F9C1}" },
+    .{ "cupid", "\u{1F498}" },
+    .{ "curling_stone", "\u{1F94C}" },
+    .{ "curly-haired_man", "\u{1F468}\u{200D}\u{1F9B1}" },
+    .{ "curly-haired_woman", "\u{1F469}\u{200D}\u{1F9B1}" },
+    .{ "curly_hair", "\u{1F9B1}" },
+    .{ "curly_loop", "\u{27B0}" },
+    .{ "currency_exchange", "\u{1F4B1}" },
+    .{ "curry", "\u{1F35B}" },
+    .{ "curry_rice", "\u{1F35B}" },
+    .{ "custard", "\u{1F36E}" },
+    .{ "customs", "\u{1F6C3}" },
+    .{ "cut_of_meat", "\u{1F969}" },
+    .{ "cyclone", "\u{1F300}" },
+    .{ "cyprus", "\u{1F1E8}\u{1F1FE}" },
+    .{ "czechia", "\u{1F1E8}\u{1F1FF}" },
+    .{ "dagger", "\u{1F5E1}" },
+    .{ "dagger_knife", "\u{1F5E1}" },
+    .{ "dancer", "\u{1F483}" },
+    .{ "dancers", "\u{1F46F}" },
+    .{ "dango", "\u{1F361}" },
+    .{ "dark_skin_tone", "\u{1F3FF}" },
+    .{ "dark_sunglasses", "\u{1F576}" },
+    .{ "dart", "\u{1F3AF}" },
+    .{ "dash", "\u{1F4A8}" },
+    .{ "dashing_away", "\u{1F4A8}" },
+    .{ "date", "\u{1F4C5}" },
+    .{ "deaf_person", "\u{1F9CF}" },
+    .{ "deciduous_tree", "\u{1F333}" },
+    .{ "deer", "\u{1F98C}" },
+    .{ "delivery_truck", "\u{1F69A}" },
+    .{ "denmark", "\u{1F1E9}\u{1F1F0}" },
+    .{ "department_store", "\u{1F3EC}" },
+    .{ "derelict_house", "\u{1F3DA}" },
+    .{ "derelict_house_building", "\u{1F3DA}" },
+    .{ "desert", "\u{1F3DC}" },
+    .{ "desert_island", "\u{1F3DD}" },
+    .{ "desktop_computer", "\u{1F5A5}" },
+    .{ "detective", "\u{1F575}" },
+    .{ "detective_dark_skin_tone", "\u{1F575}\u{1F3FF}" },
+    .{ "detective_light_skin_tone", "\u{1F575}\u{1F3FB}" },
+    .{ "detective_medium-dark_skin_tone", "\u{1F575}\u{1F3FE}" },
+    .{ "detective_medium-light_skin_tone", "\u{1F575}\u{1F3FC}" },
+    .{ "detective_medium_skin_tone", "\u{1F575}\u{1F3FD}" },
+    .{ "diamond_shape_with_a_dot_inside", "\u{1F4A0}" },
+    .{ "diamond_suit", "\u{2666}" },
+    .{ "diamond_with_a_dot", "\u{1F4A0}" },
+    .{ "diamonds", "\u{2666}" },
+    .{ "diego_garcia", "\u{1F1E9}\u{1F1EC}" },
+    .{ "dim_button", "\u{1F505}" },
+    .{ "direct_hit", "\u{1F3AF}" },
+    .{ "disappointed", "\u{1F61E}" },
+    .{ "disappointed_face", "\u{1F61E}" },
+    .{ "disappointed_relieved", "\u{1F625}" },
+    .{ "diving_mask", "\u{1F93F}" },
+    .{ "diya_lamp", "\u{1FA94}" },
+    .{ "dizzy", "\u{1F4AB}" },
+    .{ "dizzy_face", "\u{1F635}" },
+    .{ "djibouti", "\u{1F1E9}\u{1F1EF}" },
+    .{ "dna", "\u{1F9EC}" },
+    .{ "do_not_litter", "\u{1F6AF}" },
+    .{ "dog", "\u{1F436}" },
+    .{ "dog2", "\u{1F415}" },
+    .{ "dog_face", "\u{1F436}" },
+    .{ "dollar", "\u{1F4B5}" },
+    .{ "dollar_banknote", "\u{1F4B5}" },
+    .{ "dolls", "\u{1F38E}" },
+    .{ "dolphin", "\u{1F42C}" },
+    .{ "dominica", "\u{1F1E9}\u{1F1F2}" },
+    .{ "dominican_republic", "\u{1F1E9}\u{1F1F4}" },
+    .{ "door", "\u{1F6AA}" },
+    .{ "dotted_six-pointed_star", "\u{1F52F}" },
+    .{ "double_curly_loop", "\u{27BF}" },
+    .{ "double_exclamation_mark", "\u{203C}" },
+    .{ "double_vertical_bar", "\u{23F8}" },
+    .{ "doughnut", "\u{1F369}" },
+    .{ "dove", "\u{1F54A}" },
+    .{ "dove_of_peace", "\u{1F54A}" },
+    .{ "down-left_arrow", "\u{2199}" },
+    .{ "down-right_arrow", "\u{2198}" },
+    .{ "down_arrow", "\u{2B07}" },
+    .{ "downcast_face_with_sweat", "\u{1F613}" },
+    .{ "downwards_button", "\u{1F53D}" },
+    .{ "dragon", "\u{1F409}" },
+    .{ "dragon_face", "\u{1F432}" },
+    .{ "dress", "\u{1F457}" },
+    .{ "dromedary_camel", "\u{1F42A}" },
+    .{ "drooling_face", "\u{1F924}" },
+    .{ "drop_of_blood", "\u{1FA78}" },
+    .{ "droplet", "\u{1F4A7}" },
+    .{ "drum", "\u{1F941}" },
+    .{ "duck", "\u{1F986}" },
+    .{ "dumpling", "\u{1F95F}" },
+    .{ "dvd", "\u{1F4C0}" },
+    .{ "e-mail", "\u{1F4E7}" },
+    .{ "e__mail", "\u{1F4E7}" },
+    .{ "eagle", "\u{1F985}" },
+    .{ "ear", "\u{1F442}" },
+    .{ "ear_dark_skin_tone", "\u{1F442}\u{1F3FF}" },
+    .{ "ear_light_skin_tone", "\u{1F442}\u{1F3FB}" },
+    .{ "ear_medium-dark_skin_tone", "\u{1F442}\u{1F3FE}" },
+    .{ "ear_medium-light_skin_tone", "\u{1F442}\u{1F3FC}" },
+    .{ "ear_medium_skin_tone", "\u{1F442}\u{1F3FD}" },
+    .{ "ear_of_corn", "\u{1F33D}" },
+    .{ "ear_of_rice", "\u{1F33E}" },
+    .{ "ear_with_hearing_aid", "\u{1F9BB}" },
+    .{ "earth_africa", "\u{1F30D}" },
+    .{ "earth_americas", "\u{1F30E}" },
+    .{ "earth_asia", "\u{1F30F}" },
+    .{ "ecuador", "\u{1F1EA}\u{1F1E8}" },
+    .{ "egg", "\u{1F373}" },
+    .{ "eggplant", "\u{1F346}" },
+    .{ "egypt", "\u{1F1EA}\u{1F1EC}" },
+    .{ "eight", "\u{38}\u{FE0F}\u{20E3}" },
+    .{ "eight-pointed_star", "\u{2734}" },
+    .{ "eight-spoked_asterisk", "\u{2733}" },
+    .{ "eight-thirty", "\u{1F563}" },
+    .{ "eight_pointed_black_star", "\u{2734}" },
+    .{ "eight_spoked_asterisk", "\u{2733}" },
+    .{ "eject_button", "\u{23CF}" },
+    .{ "eject_symbol", "\u{23CF}" },
+    .{ "el_salvador", "\u{1F1F8}\u{1F1FB}" },
+    .{ "electric_plug", "\u{1F50C}" },
+    .{ "elephant", "\u{1F418}" },
+    .{ "eleven-thirty", "\u{1F566}" },
+    .{ "elf", "\u{1F9DD}" },
+    .{ "elf_dark_skin_tone", "\u{1F9DD}\u{1F3FF}" },
+    .{ "elf_light_skin_tone", "\u{1F9DD}\u{1F3FB}" },
+    .{ "elf_medium-dark_skin_tone", "\u{1F9DD}\u{1F3FE}" },
+    .{ "elf_medium-light_skin_tone", "\u{1F9DD}\u{1F3FC}" },
+    .{ "elf_medium_skin_tone", "\u{1F9DD}\u{1F3FD}" },
+    .{ "email", "\u{2709}" },
+    .{ "emoji_modifier_fitzpatrick_type__1__2", "\u{1F3FB}" },
+    .{ "emoji_modifier_fitzpatrick_type__3", "\u{1F3FC}" },
+    .{ "emoji_modifier_fitzpatrick_type__4", "\u{1F3FD}" },
+    .{ "emoji_modifier_fitzpatrick_type__5", "\u{1F3FE}" },
+    .{ "emoji_modifier_fitzpatrick_type__6", "\u{1F3FF}" },
+    .{ "end", "\u{1F51A}" },
+    .{ "end_arrow", "\u{1F51A}" },
+    .{ "england", "\u{1F3F4}\u{E0067}\u{E0062}\u{E0065}\u{E006E}\u{E0067}\u{E007F}" },
+    .{ "envelope", "\u{2709}" },
+    .{ "envelope_with_arrow", "\u{1F4E9}" },
+    .{ "equatorial_guinea", "\u{1F1EC}\u{1F1F6}" },
+    .{ "eritrea", "\u{1F1EA}\u{1F1F7}" },
+    .{ "estonia", "\u{1F1EA}\u{1F1EA}" },
+    .{ "ethiopia", "\u{1F1EA}\u{1F1F9}" },
+    .{ "euro", "\u{1F4B6}" },
+    .{ "euro_banknote", "\u{1F4B6}" },
+    .{ "european_castle", "\u{1F3F0}" },
+    .{ "european_post_office", "\u{1F3E4}" },
+    .{ "european_union", "\u{1F1EA}\u{1F1FA}" },
+    .{ "evergreen_tree", "\u{1F332}" },
+    .{ "ewe", "\u{1F411}" },
+    .{ "exclamation", "\u{2757}" },
+    .{ "exclamation_mark", "\u{2757}" },
+    .{ "exclamation_question_mark", "\u{2049}" },
+    .{ "exploding_head", "\u{1F92F}" },
+    .{ "expressionless", "\u{1F611}" },
+    .{ "expressionless_face", "\u{1F611}" },
+    .{ "eye", "\u{1F441}" },
+    .{ "eye_in_speech_bubble", "\u{1F441}\u{FE0F}\u{200D}\u{1F5E8}\u{FE0F}" },
+    .{ "eyeglasses", "\u{1F453}" },
+    .{ "eyes", "\u{1F440}" },
+    .{ "face_blowing_a_kiss", "\u{1F618}" },
+    .{ "face_savoring_food", "\u{1F60B}" },
+    .{ "face_screaming_in_fear", "\u{1F631}" },
+    .{ "face_vomiting", "\u{1F92E}" },
+    .{ "face_with_hand_over_mouth", "\u{1F92D}" },
+    .{ "face_with_head-bandage", "\u{1F915}" },
+    .{ "face_with_head__bandage", "\u{1F915}" },
+    .{ "face_with_medical_mask", "\u{1F637}" },
+    .{ "face_with_monocle", "\u{1F9D0}" },
+    .{ "face_with_open_mouth", "\u{1F62E}" },
+    .{ "face_with_raised_eyebrow", "\u{1F928}" },
+    .{ "face_with_rolling_eyes", "\u{1F644}" },
+    .{ "face_with_steam_from_nose", "\u{1F624}" },
+    .{ "face_with_symbols_on_mouth", "\u{1F92C}" },
+    .{ "face_with_tears_of_joy", "\u{1F602}" },
+    .{ "face_with_thermometer", "\u{1F912}" },
+    .{ "face_with_tongue", "\u{1F61B}" },
+    .{ "face_without_mouth", "\u{1F636}" },
+    .{ "facepunch", "\u{1F44A}" },
+    .{ "factory", "\u{1F3ED}" },
+    .{ "fairy", "\u{1F9DA}" },
+    .{ "fairy_dark_skin_tone", "\u{1F9DA}\u{1F3FF}" },
+    .{ "fairy_light_skin_tone", "\u{1F9DA}\u{1F3FB}" },
+    .{ "fairy_medium-dark_skin_tone", "\u{1F9DA}\u{1F3FE}" },
+    .{ "fairy_medium-light_skin_tone", "\u{1F9DA}\u{1F3FC}" },
+    .{ "fairy_medium_skin_tone", "\u{1F9DA}\u{1F3FD}" },
+    .{ "falafel", "\u{1F9C6}" },
+    .{ "falkland_islands", "\u{1F1EB}\u{1F1F0}" },
+    .{ "fallen_leaf", "\u{1F342}" },
+    .{ "family", "\u{1F46A}" },
+    .{ "family_man_boy", "\u{1F468}\u{200D}\u{1F466}" },
+    .{ "family_man_boy_boy", "\u{1F468}\u{200D}\u{1F466}\u{200D}\u{1F466}" },
+    .{ "family_man_girl", "\u{1F468}\u{200D}\u{1F467}" },
+    .{ "family_man_girl_boy", "\u{1F468}\u{200D}\u{1F467}\u{200D}\u{1F466}" },
+    .{ "family_man_girl_girl", "\u{1F468}\u{200D}\u{1F467}\u{200D}\u{1F467}" },
+    .{ "family_man_man_boy", "\u{1F468}\u{200D}\u{1F468}\u{200D}\u{1F466}" },
+    .{ "family_man_man_boy_boy", "\u{1F468}\u{200D}\u{1F468}\u{200D}\u{1F466}\u{200D}\u{1F466}" },
+    .{ "family_man_man_girl", "\u{1F468}\u{200D}\u{1F468}\u{200D}\u{1F467}" },
+    .{ "family_man_man_girl_boy", "\u{1F468}\u{200D}\u{1F468}\u{200D}\u{1F467}\u{200D}\u{1F466}" },
+    .{ "family_man_man_girl_girl", "\u{1F468}\u{200D}\u{1F468}\u{200D}\u{1F467}\u{200D}\u{1F467}" },
+    .{ "family_man_woman_boy", "\u{1F468}\u{200D}\u{1F469}\u{200D}\u{1F466}" },
+    .{ "family_man_woman_boy_boy", "\u{1F468}\u{200D}\u{1F469}\u{200D}\u{1F466}\u{200D}\u{1F466}" },
+    .{ "family_man_woman_girl", "\u{1F468}\u{200D}\u{1F469}\u{200D}\u{1F467}" },
+    .{ "family_man_woman_girl_boy", "\u{1F468}\u{200D}\u{1F469}\u{200D}\u{1F467}\u{200D}\u{1F466}" },
+    .{ "family_man_woman_girl_girl", "\u{1F468}\u{200D}\u{1F469}\u{200D}\u{1F467}\u{200D}\u{1F467}" },
+    .{ "family_woman_boy", "\u{1F469}\u{200D}\u{1F466}" },
+    .{ "family_woman_boy_boy", "\u{1F469}\u{200D}\u{1F466}\u{200D}\u{1F466}" },
+    .{ "family_woman_girl", "\u{1F469}\u{200D}\u{1F467}" },
+    .{ "family_woman_girl_boy", "\u{1F469}\u{200D}\u{1F467}\u{200D}\u{1F466}" },
+    .{ "family_woman_girl_girl", "\u{1F469}\u{200D}\u{1F467}\u{200D}\u{1F467}" },
+    .{ "family_woman_woman_boy", "\u{1F469}\u{200D}\u{1F469}\u{200D}\u{1F466}" },
+    .{ "family_woman_woman_boy_boy", "\u{1F469}\u{200D}\u{1F469}\u{200D}\u{1F466}\u{200D}\u{1F466}" },
+    .{ "family_woman_woman_girl", "\u{1F469}\u{200D}\u{1F469}\u{200D}\u{1F467}" },
+    .{ "family_woman_woman_girl_boy", "\u{1F469}\u{200D}\u{1F469}\u{200D}\u{1F467}\u{200D}\u{1F466}" },
+    .{ "family_woman_woman_girl_girl", "\u{1F469}\u{200D}\u{1F469}\u{200D}\u{1F467}\u{200D}\u{1F467}" },
+    .{ "faroe_islands", "\u{1F1EB}\u{1F1F4}" },
+    .{ "fast-forward_button", "\u{23E9}" },
+    .{ "fast_down_button", "\u{23EC}" },
+    .{ "fast_forward", "\u{23E9}" },
+    .{ "fast_reverse_button", "\u{23EA}" },
+    .{ "fast_up_button", "\u{23EB}" },
+    .{ "fax", "\u{1F4E0}" },
+    .{ "fax_machine", "\u{1F4E0}" },
+    .{ "fearful", "\u{1F628}" },
+    .{ "fearful_face", "\u{1F628}" },
+    .{ "feet", "\u{1F43E}" },
+    .{ "female_sign", "\u{2640}" },
+    .{ "ferris_wheel", "\u{1F3A1}" },
+    .{ "ferry", "\u{26F4}" },
+    .{ "field_hockey", "\u{1F3D1}" },
+    .{ "field_hockey_stick_and_ball", "\u{1F3D1}" },
+    .{ "fiji", "\u{1F1EB}\u{1F1EF}" },
+    .{ "file_cabinet", "\u{1F5C4}" },
+    .{ "file_folder", "\u{1F4C1}" },
+    .{ "film_frames", "\u{1F39E}" },
+    .{ "film_projector", "\u{1F4FD}" },
+    .{ "finland", "\u{1F1EB}\u{1F1EE}" },
+    .{ "fire", "\u{1F525}" },
+    .{ "fire_engine", "\u{1F692}" },
+    .{ "fire_extinguisher", "\u{1F9EF}" },
+    .{ "firecracker", "\u{1F9E8}" },
+    .{ "fireworks", "\u{1F386}" },
+    .{ "first_quarter_moon", "\u{1F313}" },
+    .{ "first_quarter_moon_face", "\u{1F31B}" },
+    .{ "first_quarter_moon_with_face", "\u{1F31B}" },
+    .{ "fish", "\u{1F41F}" },
+    .{ "fish_cake", "\u{1F365}" },
+    .{ "fish_cake_with_swirl", "\u{1F365}" },
+    .{ "fishing_pole", "\u{1F3A3}" },
+    .{ "fishing_pole_and_fish", "\u{1F3A3}" },
+    .{ "fist", "\u{270A}" },
+    .{ "five", "\u{35}\u{FE0F}\u{20E3}" },
+    .{ "five-thirty", "\u{1F560}" },
+    .{ "flag_for_afghanistan", "\u{1F1E6}\u{1F1EB}" },
+    .{ "flag_for_albania", "\u{1F1E6}\u{1F1F1}" },
+    .{ "flag_for_algeria", "\u{1F1E9}\u{1F1FF}" },
+    .{ "flag_for_american_samoa", "\u{1F1E6}\u{1F1F8}" },
+    .{ "flag_for_andorra", "\u{1F1E6}\u{1F1E9}" },
+    .{ "flag_for_angola", "\u{1F1E6}\u{1F1F4}" },
+    .{ "flag_for_anguilla", "\u{1F1E6}\u{1F1EE}" },
+    .{ "flag_for_antarctica", "\u{1F1E6}\u{1F1F6}" },
+    .{ "flag_for_argentina", "\u{1F1E6}\u{1F1F7}" },
+    .{ "flag_for_armenia", "\u{1F1E6}\u{1F1F2}" },
+    .{ "flag_for_aruba", "\u{1F1E6}\u{1F1FC}" },
+    .{ "flag_for_ascension_island", "\u{1F1E6}\u{1F1E8}" },
+    .{ "flag_for_australia", "\u{1F1E6}\u{1F1FA}" },
+    .{ "flag_for_austria", "\u{1F1E6}\u{1F1F9}" },
+    .{ "flag_for_azerbaijan", "\u{1F1E6}\u{1F1FF}" },
+    .{ "flag_for_bahamas", "\u{1F1E7}\u{1F1F8}" },
+    .{ "flag_for_bahrain", "\u{1F1E7}\u{1F1ED}" },
+    .{ "flag_for_bangladesh", "\u{1F1E7}\u{1F1E9}" },
+    .{ "flag_for_barbados", "\u{1F1E7}\u{1F1E7}" },
+    .{ "flag_for_belarus", "\u{1F1E7}\u{1F1FE}" },
+    .{ "flag_for_belgium", "\u{1F1E7}\u{1F1EA}" },
+    .{ "flag_for_belize", "\u{1F1E7}\u{1F1FF}" },
+    .{ "flag_for_benin", "\u{1F1E7}\u{1F1EF}" },
+    .{ "flag_for_bermuda", "\u{1F1E7}\u{1F1F2}" },
+    .{ "flag_for_bhutan", "\u{1F1E7}\u{1F1F9}" },
+    .{ "flag_for_bolivia", "\u{1F1E7}\u{1F1F4}" },
+    .{ "flag_for_botswana", "\u{1F1E7}\u{1F1FC}" },
+    .{ "flag_for_bouvet_island", "\u{1F1E7}\u{1F1FB}" },
+    .{ "flag_for_brazil", "\u{1F1E7}\u{1F1F7}" },
+    .{ "flag_for_british_indian_ocean_territory", "\u{1F1EE}\u{1F1F4}" },
+    .{ "flag_for_british_virgin_islands", "\u{1F1FB}\u{1F1EC}" },
+    .{ "flag_for_brunei", "\u{1F1E7}\u{1F1F3}" },
+    .{ "flag_for_bulgaria", "\u{1F1E7}\u{1F1EC}" },
+    .{ "flag_for_burkina_faso", "\u{1F1E7}\u{1F1EB}" },
+    .{ "flag_for_burundi", "\u{1F1E7}\u{1F1EE}" },
+    .{ "flag_for_cambodia", "\u{1F1F0}\u{1F1ED}" },
+    .{ "flag_for_cameroon", "\u{1F1E8}\u{1F1F2}" },
+    .{ "flag_for_canada", "\u{1F1E8}\u{1F1E6}" },
+    .{ "flag_for_canary_islands", "\u{1F1EE}\u{1F1E8}" },
+    .{ "flag_for_cape_verde", "\u{1F1E8}\u{1F1FB}" },
+    .{ "flag_for_caribbean_netherlands", "\u{1F1E7}\u{1F1F6}" },
+    .{ "flag_for_cayman_islands", "\u{1F1F0}\u{1F1FE}" },
+    .{ "flag_for_central_african_republic", "\u{1F1E8}\u{1F1EB}" },
+    .{ "flag_for_chad", "\u{1F1F9}\u{1F1E9}" },
+    .{ "flag_for_chile", "\u{1F1E8}\u{1F1F1}" },
+    .{ "flag_for_china", "\u{1F1E8}\u{1F1F3}" },
+    .{ "flag_for_christmas_island", "\u{1F1E8}\u{1F1FD}" },
+    .{ "flag_for_clipperton_island", "\u{1F1E8}\u{1F1F5}" },
+    .{ "flag_for_cocos__islands", "\u{1F1E8}\u{1F1E8}" },
+    .{ "flag_for_colombia", "\u{1F1E8}\u{1F1F4}" },
+    .{ "flag_for_comoros", "\u{1F1F0}\u{1F1F2}" },
+    .{ "flag_for_congo____brazzaville", "\u{1F1E8}\u{1F1EC}" },
+    .{ "flag_for_congo____kinshasa", "\u{1F1E8}\u{1F1E9}" },
+    .{ "flag_for_cook_islands", "\u{1F1E8}\u{1F1F0}" },
+    .{ "flag_for_costa_rica", "\u{1F1E8}\u{1F1F7}" },
+    .{ "flag_for_croatia", "\u{1F1ED}\u{1F1F7}" },
+    .{ "flag_for_cuba", "\u{1F1E8}\u{1F1FA}" },
+    .{ "flag_for_cyprus", "\u{1F1E8}\u{1F1FE}" },
+    .{ "flag_for_czech_republic", "\u{1F1E8}\u{1F1FF}" },
+    .{ "flag_for_denmark", "\u{1F1E9}\u{1F1F0}" },
+    .{ "flag_for_diego_garcia", "\u{1F1E9}\u{1F1EC}" },
+    .{ "flag_for_djibouti", "\u{1F1E9}\u{1F1EF}" },
+    .{ "flag_for_dominica", "\u{1F1E9}\u{1F1F2}" },
+    .{ "flag_for_dominican_republic", "\u{1F1E9}\u{1F1F4}" },
+    .{ "flag_for_ecuador", "\u{1F1EA}\u{1F1E8}" },
+    .{ "flag_for_egypt", "\u{1F1EA}\u{1F1EC}" },
+    .{ "flag_for_el_salvador", "\u{1F1F8}\u{1F1FB}" },
+    .{ "flag_for_equatorial_guinea", "\u{1F1EC}\u{1F1F6}" },
+    .{ "flag_for_eritrea", "\u{1F1EA}\u{1F1F7}" },
+    .{ "flag_for_estonia", "\u{1F1EA}\u{1F1EA}" },
+    .{ "flag_for_ethiopia", "\u{1F1EA}\u{1F1F9}" },
+    .{ "flag_for_european_union", "\u{1F1EA}\u{1F1FA}" },
+    .{ "flag_for_falkland_islands", "\u{1F1EB}\u{1F1F0}" },
+    .{ "flag_for_faroe_islands", "\u{1F1EB}\u{1F1F4}" },
+    .{ "flag_for_fiji", "\u{1F1EB}\u{1F1EF}" },
+    .{ "flag_for_finland", "\u{1F1EB}\u{1F1EE}" },
+    .{ "flag_for_france", "\u{1F1EB}\u{1F1F7}" },
+    .{ "flag_for_french_guiana", "\u{1F1EC}\u{1F1EB}" },
+    .{ "flag_for_french_polynesia", "\u{1F1F5}\u{1F1EB}" },
+    .{ "flag_for_french_southern_territories", "\u{1F1F9}\u{1F1EB}" },
+    .{ "flag_for_gabon", "\u{1F1EC}\u{1F1E6}" },
+    .{ "flag_for_gambia", "\u{1F1EC}\u{1F1F2}" },
+    .{ "flag_for_georgia", "\u{1F1EC}\u{1F1EA}" },
+    .{ "flag_for_germany", "\u{1F1E9}\u{1F1EA}" },
+    .{ "flag_for_ghana", "\u{1F1EC}\u{1F1ED}" },
+    .{ "flag_for_gibraltar", "\u{1F1EC}\u{1F1EE}" },
+    .{ "flag_for_greece", "\u{1F1EC}\u{1F1F7}" },
+    .{ "flag_for_greenland", "\u{1F1EC}\u{1F1F1}" },
+    .{ "flag_for_grenada", "\u{1F1EC}\u{1F1E9}" },
+    .{ "flag_for_guadeloupe", "\u{1F1EC}\u{1F1F5}" },
+    .{ "flag_for_guam", "\u{1F1EC}\u{1F1FA}" },
+    .{ "flag_for_guatemala", "\u{1F1EC}\u{1F1F9}" },
+    .{ "flag_for_guernsey", "\u{1F1EC}\u{1F1EC}" },
+    .{ "flag_for_guinea", "\u{1F1EC}\u{1F1F3}" },
+    .{ "flag_for_guinea__bissau", "\u{1F1EC}\u{1F1FC}" },
+    .{ "flag_for_guyana", "\u{1F1EC}\u{1F1FE}" },
+    .{ "flag_for_haiti", "\u{1F1ED}\u{1F1F9}" },
+    .{ "flag_for_honduras", "\u{1F1ED}\u{1F1F3}" },
+    .{ "flag_for_hong_kong", "\u{1F1ED}\u{1F1F0}" },
+    .{ "flag_for_hungary", "\u{1F1ED}\u{1F1FA}" },
+    .{ "flag_for_iceland", "\u{1F1EE}\u{1F1F8}" },
+    .{ "flag_for_india", "\u{1F1EE}\u{1F1F3}" },
+    .{ "flag_for_indonesia", "\u{1F1EE}\u{1F1E9}" },
+    .{ "flag_for_iran", "\u{1F1EE}\u{1F1F7}" },
+    .{ "flag_for_iraq", "\u{1F1EE}\u{1F1F6}" },
+    .{ "flag_for_ireland", "\u{1F1EE}\u{1F1EA}" },
+    .{ "flag_for_isle_of_man", "\u{1F1EE}\u{1F1F2}" },
+    .{ "flag_for_israel", "\u{1F1EE}\u{1F1F1}" },
+    .{ "flag_for_italy", "\u{1F1EE}\u{1F1F9}" },
+    .{ "flag_for_jamaica", "\u{1F1EF}\u{1F1F2}" },
+    .{ "flag_for_japan", "\u{1F1EF}\u{1F1F5}" },
+    .{ "flag_for_jersey", "\u{1F1EF}\u{1F1EA}" },
+    .{ "flag_for_jordan", "\u{1F1EF}\u{1F1F4}" },
+    .{ "flag_for_kazakhstan", "\u{1F1F0}\u{1F1FF}" },
+    .{ "flag_for_kenya", "\u{1F1F0}\u{1F1EA}" },
+    .{ "flag_for_kiribati", "\u{1F1F0}\u{1F1EE}" },
+    .{ "flag_for_kosovo", "\u{1F1FD}\u{1F1F0}" },
+    .{ "flag_for_kuwait", "\u{1F1F0}\u{1F1FC}" },
+    .{ "flag_for_kyrgyzstan", "\u{1F1F0}\u{1F1EC}" },
+    .{ "flag_for_laos", "\u{1F1F1}\u{1F1E6}" },
+    .{ "flag_for_latvia", "\u{1F1F1}\u{1F1FB}" },
+    .{ "flag_for_lebanon", "\u{1F1F1}\u{1F1E7}" },
+    .{ "flag_for_lesotho", "\u{1F1F1}\u{1F1F8}" },
+    .{ "flag_for_liberia", "\u{1F1F1}\u{1F1F7}" },
+    .{ "flag_for_libya", "\u{1F1F1}\u{1F1FE}" },
+    .{ "flag_for_liechtenstein", "\u{1F1F1}\u{1F1EE}" },
+    .{ "flag_for_lithuania", "\u{1F1F1}\u{1F1F9}" },
+    .{ "flag_for_luxembourg", "\u{1F1F1}\u{1F1FA}" },
+    .{ "flag_for_macau", "\u{1F1F2}\u{1F1F4}" },
+    .{ "flag_for_macedonia", "\u{1F1F2}\u{1F1F0}" },
+    .{ "flag_for_madagascar", "\u{1F1F2}\u{1F1EC}" },
+    .{ "flag_for_malawi", "\u{1F1F2}\u{1F1FC}" },
+    .{ "flag_for_malaysia", "\u{1F1F2}\u{1F1FE}" },
+    .{ "flag_for_maldives", "\u{1F1F2}\u{1F1FB}" },
+    .{ "flag_for_mali", "\u{1F1F2}\u{1F1F1}" },
+    .{ "flag_for_malta", "\u{1F1F2}\u{1F1F9}" },
+    .{ "flag_for_marshall_islands", "\u{1F1F2}\u{1F1ED}" },
+    .{ "flag_for_martinique", "\u{1F1F2}\u{1F1F6}" },
+    .{ "flag_for_mauritania", "\u{1F1F2}\u{1F1F7}" },
+    .{ "flag_for_mauritius", "\u{1F1F2}\u{1F1FA}" },
+    .{ "flag_for_mayotte", "\u{1F1FE}\u{1F1F9}" },
+    .{ "flag_for_mexico", "\u{1F1F2}\u{1F1FD}" },
+    .{ "flag_for_micronesia", "\u{1F1EB}\u{1F1F2}" },
+    .{ "flag_for_moldova", "\u{1F1F2}\u{1F1E9}" },
+    .{ "flag_for_monaco", "\u{1F1F2}\u{1F1E8}" },
+    .{ "flag_for_mongolia", "\u{1F1F2}\u{1F1F3}" },
+    .{ "flag_for_montenegro", "\u{1F1F2}\u{1F1EA}" },
+    .{ "flag_for_montserrat", "\u{1F1F2}\u{1F1F8}" },
+    .{ "flag_for_morocco", "\u{1F1F2}\u{1F1E6}" },
+    .{ "flag_for_mozambique", "\u{1F1F2}\u{1F1FF}" },
+    .{ "flag_for_myanmar", "\u{1F1F2}\u{1F1F2}" },
+    .{ "flag_for_namibia", "\u{1F1F3}\u{1F1E6}" },
+    .{ "flag_for_nauru", "\u{1F1F3}\u{1F1F7}" },
+    .{ "flag_for_nepal", "\u{1F1F3}\u{1F1F5}" },
+    .{ "flag_for_netherlands", "\u{1F1F3}\u{1F1F1}" },
+    .{ "flag_for_new_caledonia", "\u{1F1F3}\u{1F1E8}" },
+    .{ "flag_for_new_zealand", "\u{1F1F3}\u{1F1FF}" },
+    .{ "flag_for_nicaragua", "\u{1F1F3}\u{1F1EE}" },
+    .{ "flag_for_niger", "\u{1F1F3}\u{1F1EA}" },
+    .{ "flag_for_nigeria", "\u{1F1F3}\u{1F1EC}" },
+    .{ "flag_for_niue", "\u{1F1F3}\u{1F1FA}" },
+    .{ "flag_for_norfolk_island", "\u{1F1F3}\u{1F1EB}" },
+    .{ "flag_for_north_korea", "\u{1F1F0}\u{1F1F5}" },
+    .{ "flag_for_northern_mariana_islands", "\u{1F1F2}\u{1F1F5}" },
+    .{ "flag_for_norway", "\u{1F1F3}\u{1F1F4}" },
+    .{ "flag_for_oman", "\u{1F1F4}\u{1F1F2}" },
+    .{ "flag_for_pakistan", "\u{1F1F5}\u{1F1F0}" },
+    .{ "flag_for_palau", "\u{1F1F5}\u{1F1FC}" },
+    .{ "flag_for_palestinian_territories", "\u{1F1F5}\u{1F1F8}" },
+    .{ "flag_for_panama", "\u{1F1F5}\u{1F1E6}" },
+    .{ "flag_for_papua_new_guinea", "\u{1F1F5}\u{1F1EC}" },
+    .{ "flag_for_paraguay", "\u{1F1F5}\u{1F1FE}" },
+    .{ "flag_for_peru", "\u{1F1F5}\u{1F1EA}" },
+    .{ "flag_for_philippines", "\u{1F1F5}\u{1F1ED}" },
+    .{ "flag_for_pitcairn_islands", "\u{1F1F5}\u{1F1F3}" },
+    .{ "flag_for_poland", "\u{1F1F5}\u{1F1F1}" },
+    .{ "flag_for_portugal", "\u{1F1F5}\u{1F1F9}" },
+    .{ "flag_for_puerto_rico", "\u{1F1F5}\u{1F1F7}" },
+    .{ "flag_for_qatar", "\u{1F1F6}\u{1F1E6}" },
+    .{ "flag_for_romania", "\u{1F1F7}\u{1F1F4}" },
+    .{ "flag_for_russia", "\u{1F1F7}\u{1F1FA}" },
+    .{ "flag_for_rwanda", "\u{1F1F7}\u{1F1FC}" },
+    .{ "flag_for_samoa", "\u{1F1FC}\u{1F1F8}" },
+    .{ "flag_for_san_marino", "\u{1F1F8}\u{1F1F2}" },
+    .{ "flag_for_saudi_arabia", "\u{1F1F8}\u{1F1E6}" },
+    .{ "flag_for_senegal", "\u{1F1F8}\u{1F1F3}" },
+    .{ "flag_for_serbia", "\u{1F1F7}\u{1F1F8}" },
+    .{ "flag_for_seychelles", "\u{1F1F8}\u{1F1E8}" },
+    .{ "flag_for_sierra_leone", "\u{1F1F8}\u{1F1F1}" },
+    .{ "flag_for_singapore", "\u{1F1F8}\u{1F1EC}" },
+    .{ "flag_for_sint_maarten", "\u{1F1F8}\u{1F1FD}" },
+    .{ "flag_for_slovakia", "\u{1F1F8}\u{1F1F0}" },
+    .{ "flag_for_slovenia", "\u{1F1F8}\u{1F1EE}" },
+    .{ "flag_for_solomon_islands", "\u{1F1F8}\u{1F1E7}" },
+    .{ "flag_for_somalia", "\u{1F1F8}\u{1F1F4}" },
+    .{ "flag_for_south_africa", "\u{1F1FF}\u{1F1E6}" },
+    .{ "flag_for_south_korea", "\u{1F1F0}\u{1F1F7}" },
+    .{ "flag_for_south_sudan", "\u{1F1F8}\u{1F1F8}" },
+    .{ "flag_for_spain", "\u{1F1EA}\u{1F1F8}" },
+    .{ "flag_for_sri_lanka", "\u{1F1F1}\u{1F1F0}" },
+    .{ "flag_for_sudan", "\u{1F1F8}\u{1F1E9}" },
+    .{ "flag_for_suriname", "\u{1F1F8}\u{1F1F7}" },
+    .{ "flag_for_swaziland", "\u{1F1F8}\u{1F1FF}" },
+    .{ "flag_for_sweden", "\u{1F1F8}\u{1F1EA}" },
+    .{ "flag_for_switzerland", "\u{1F1E8}\u{1F1ED}" },
+    .{ "flag_for_syria", "\u{1F1F8}\u{1F1FE}" },
+    .{ "flag_for_taiwan", "\u{1F1F9}\u{1F1FC}" },
+    .{ "flag_for_tajikistan", "\u{1F1F9}\u{1F1EF}" },
+    .{ "flag_for_tanzania", "\u{1F1F9}\u{1F1FF}" },
+    .{ "flag_for_thailand", "\u{1F1F9}\u{1F1ED}" },
+    .{ "flag_for_timor__leste", "\u{1F1F9}\u{1F1F1}" },
+    .{ "flag_for_togo", "\u{1F1F9}\u{1F1EC}" },
+    .{ "flag_for_tokelau", "\u{1F1F9}\u{1F1F0}" },
+    .{ "flag_for_tonga", "\u{1F1F9}\u{1F1F4}" },
+    .{ "flag_for_tristan_da_cunha", "\u{1F1F9}\u{1F1E6}" },
+    .{ "flag_for_tunisia", "\u{1F1F9}\u{1F1F3}" },
+    .{ "flag_for_turkey", "\u{1F1F9}\u{1F1F7}" },
+    .{ "flag_for_turkmenistan", "\u{1F1F9}\u{1F1F2}" },
+    .{ "flag_for_tuvalu", "\u{1F1F9}\u{1F1FB}" },
+    .{ "flag_for_uganda", "\u{1F1FA}\u{1F1EC}" },
+    .{ "flag_for_ukraine", "\u{1F1FA}\u{1F1E6}" },
+    .{ "flag_for_united_arab_emirates", "\u{1F1E6}\u{1F1EA}" },
+    .{ "flag_for_united_kingdom", "\u{1F1EC}\u{1F1E7}" },
+    .{ "flag_for_united_states", "\u{1F1FA}\u{1F1F8}" },
+    .{ "flag_for_uruguay", "\u{1F1FA}\u{1F1FE}" },
+    .{ "flag_for_uzbekistan", "\u{1F1FA}\u{1F1FF}" },
+    .{ "flag_for_vanuatu", "\u{1F1FB}\u{1F1FA}" },
+    .{ "flag_for_vatican_city", "\u{1F1FB}\u{1F1E6}" },
+    .{ "flag_for_venezuela", "\u{1F1FB}\u{1F1EA}" },
+    .{ "flag_for_vietnam", "\u{1F1FB}\u{1F1F3}" },
+    .{ "flag_for_western_sahara", "\u{1F1EA}\u{1F1ED}" },
+    .{ "flag_for_yemen", "\u{1F1FE}\u{1F1EA}" },
+    .{ "flag_for_zambia", "\u{1F1FF}\u{1F1F2}" },
+    .{ "flag_for_zimbabwe", "\u{1F1FF}\u{1F1FC}" },
+    .{ "flag_in_hole", "\u{26F3}" },
+    .{ "flags", "\u{1F38F}" },
+    .{ "flamingo", "\u{1F9A9}" },
+    .{ "flashlight", "\u{1F526}" },
+    .{ "flat_shoe", "\u{1F97F}" },
+    .{ "fleur-de-lis", "\u{269C}" },
+    .{ "fleur__de__lis", "\u{269C}" },
+    .{ "flexed_biceps", "\u{1F4AA}" },
+    .{ "flexed_biceps_dark_skin_tone", "\u{1F4AA}\u{1F3FF}" },
+    .{ "flexed_biceps_light_skin_tone", "\u{1F4AA}\u{1F3FB}" },
+    .{ "flexed_biceps_medium-dark_skin_tone", "\u{1F4AA}\u{1F3FE}" },
+    .{ "flexed_biceps_medium-light_skin_tone", "\u{1F4AA}\u{1F3FC}" },
+    .{ "flexed_biceps_medium_skin_tone", "\u{1F4AA}\u{1F3FD}" },
+    .{ "flipper", "\u{1F42C}" },
+    .{ "floppy_disk", "\u{1F4BE}" },
+    .{ "flower_playing_cards", "\u{1F3B4}" },
+    .{ "flushed", "\u{1F633}" },
+    .{ "flushed_face", "\u{1F633}" },
+    .{ "flying_disc", "\u{1F94F}" },
+    .{ "flying_saucer", "\u{1F6F8}" },
+    .{ "fog", "\u{1F32B}" },
+    .{ "foggy", "\u{1F301}" },
+    .{ "folded_hands", "\u{1F64F}" },
+    .{ "folded_hands_dark_skin_tone", "\u{1F64F}\u{1F3FF}" },
+    .{ "folded_hands_light_skin_tone", "\u{1F64F}\u{1F3FB}" },
+    .{ "folded_hands_medium-dark_skin_tone", "\u{1F64F}\u{1F3FE}" },
+    .{ "folded_hands_medium-light_skin_tone", "\u{1F64F}\u{1F3FC}" },
+    .{ "folded_hands_medium_skin_tone", "\u{1F64F}\u{1F3FD}" },
+    .{ "foot", "\u{1F9B6}" },
+    .{ "football", "\u{1F3C8}" },
+    .{ "footprints", "\u{1F463}" },
+    .{ "fork_and_knife", "\u{1F374}" },
+    .{ "fork_and_knife_with_plate", "\u{1F37D}" },
+    .{ "fortune_cookie", "\u{1F960}" },
+    .{ "fountain", "\u{26F2}" },
+    .{ "fountain_pen", "\u{1F58B}" },
+    .{ "four", "\u{34}\u{FE0F}\u{20E3}" },
+    .{ "four-thirty", "\u{1F55F}" },
+    .{ "four_leaf_clover", "\u{1F340}" },
+    .{ "fox_face", "\u{1F98A}" },
+    .{ "frame_with_picture", "\u{1F5BC}" },
+    .{ "framed_picture", "\u{1F5BC}" },
+    .{ "france", "\u{1F1EB}\u{1F1F7}" },
+    .{ "free", "\u{1F193}" },
+    .{ "free_button", "\u{1F193}" },
+    .{ "french_fries", "\u{1F35F}" },
+    .{ "french_guiana", "\u{1F1EC}\u{1F1EB}" },
+    .{ "french_polynesia", "\u{1F1F5}\u{1F1EB}" },
+    .{ "french_southern_territories", "\u{1F1F9}\u{1F1EB}" },
+    .{ "fried_shrimp", "\u{1F364}" },
+    .{ "fries", "\u{1F35F}" },
+    .{ "frog", "\u{1F438}" },
+    .{ "frog_face", "\u{1F438}" },
+    .{ "front-facing_baby_chick", "\u{1F425}" },
+    .{ "frowning", "\u{1F626}" },
+    .{ "frowning_face", "\u{2639}" },
+    .{ "frowning_face_with_open_mouth", "\u{1F626}" },
+    .{ "fuel_pump", "\u{26FD}" },
+    .{ "fuelpump", "\u{26FD}" },
+    .{ "full_moon", "\u{1F315}" },
+    .{ "full_moon_face", "\u{1F31D}" },
+    .{ "full_moon_with_face", "\u{1F31D}" },
+    .{ "funeral_urn", "\u{26B1}" },
+    .{ "gabon", "\u{1F1EC}\u{1F1E6}" },
+    .{ "gambia", "\u{1F1EC}\u{1F1F2}" },
+    .{ "game_die", "\u{1F3B2}" },
+    .{ "garlic", "\u{1F9C4}" },
+    .{ "gear", "\u{2699}" },
+    .{ "gem", "\u{1F48E}" },
+    .{ "gem_stone", "\u{1F48E}" },
+    .{ "gemini", "\u{264A}" },
+    .{ "genie", "\u{1F9DE}" },
+    .{ "georgia", "\u{1F1EC}\u{1F1EA}" },
+    .{ "germany", "\u{1F1E9}\u{1F1EA}" },
+    .{ "ghana", "\u{1F1EC}\u{1F1ED}" },
+    .{ "ghost", "\u{1F47B}" },
+    .{ "gibraltar", "\u{1F1EC}\u{1F1EE}" },
+    .{ "gift", "\u{1F381}" },
+    .{ "gift_heart", "\u{1F49D}" },
+    .{ "giraffe", "\u{1F992}" },
+    .{ "girl", "\u{1F467}" },
+    .{ "girl_dark_skin_tone", "\u{1F467}\u{1F3FF}" },
+    .{ "girl_light_skin_tone", "\u{1F467}\u{1F3FB}" },
+    .{ "girl_medium-dark_skin_tone", "\u{1F467}\u{1F3FE}" },
+    .{ "girl_medium-light_skin_tone", "\u{1F467}\u{1F3FC}" },
+    .{ "girl_medium_skin_tone", "\u{1F467}\u{1F3FD}" },
+    .{ "glass_of_milk", "\u{1F95B}" },
+    .{ "glasses", "\u{1F453}" },
+    .{ "globe_showing_americas", "\u{1F30E}" },
+    .{ "globe_showing_asia-australia", "\u{1F30F}" },
+    .{ "globe_showing_europe-africa", "\u{1F30D}" },
+    .{ "globe_with_meridians", "\u{1F310}" },
+    .{ "gloves", "\u{1F9E4}" },
+    .{ "glowing_star", "\u{1F31F}" },
+    .{ "goal_net", "\u{1F945}" },
+    .{ "goat", "\u{1F410}" },
+    .{ "goblin", "\u{1F47A}" },
+    .{ "goggles", "\u{1F97D}" },
+    .{ "golf", "\u{26F3}" },
+    .{ "golfer", "\u{1F3CC}" },
+    .{ "gorilla", "\u{1F98D}" },
+    .{ "graduation_cap", "\u{1F393}" },
+    .{ "grapes", "\u{1F347}" },
+    .{ "greece", "\u{1F1EC}\u{1F1F7}" },
+    .{ "green_apple", "\u{1F34F}" },
+    .{ "green_book", "\u{1F4D7}" },
+    .{ "green_circle", "\u{1F7E2}" },
+    .{ "green_heart", "\u{1F49A}" },
+    .{ "green_salad", "\u{1F957}" },
+    .{ "green_square", "\u{1F7E9}" },
+    .{ "greenland", "\u{1F1EC}\u{1F1F1}" },
+    .{ "grenada", "\u{1F1EC}\u{1F1E9}" },
+    .{ "grey_exclamation", "\u{2755}" },
+    .{ "grey_question", "\u{2754}" },
+    .{ "grimacing", "\u{1F62C}" },
+    .{ "grimacing_face", "\u{1F62C}" },
+    .{ "grin", "\u{1F601}" },
+    .{ "grinning", "\u{1F600}" },
+    .{ "grinning_cat_face", "\u{1F63A}" },
+    .{ "grinning_cat_face_with_smiling_eyes", "\u{1F638}" },
+    .{ "grinning_face", "\u{1F600}" },
+    .{ "grinning_face_with_big_eyes", "\u{1F603}" },
+    .{ "grinning_face_with_smiling_eyes", "\u{1F604}" },
+    .{ "grinning_face_with_sweat", "\u{1F605}" },
+    .{ "grinning_squinting_face", "\u{1F606}" },
+    .{ "growing_heart", "\u{1F497}" },
+    .{ "guadeloupe", "\u{1F1EC}\u{1F1F5}" },
+    .{ "guam", "\u{1F1EC}\u{1F1FA}" },
+    .{ "guard", "\u{1F482}" },
+    .{ "guard_dark_skin_tone", "\u{1F482}\u{1F3FF}" },
+    .{ "guard_light_skin_tone", "\u{1F482}\u{1F3FB}" },
+    .{ "guard_medium-dark_skin_tone", "\u{1F482}\u{1F3FE}" },
+    .{ "guard_medium-light_skin_tone", "\u{1F482}\u{1F3FC}" },
+    .{ "guard_medium_skin_tone", "\u{1F482}\u{1F3FD}" },
+    .{ "guardsman", "\u{1F482}" },
+    .{ "guatemala", "\u{1F1EC}\u{1F1F9}" },
+    .{ "guernsey", "\u{1F1EC}\u{1F1EC}" },
+    .{ "guide_dog", "\u{1F9AE}" },
+    .{ "guinea", "\u{1F1EC}\u{1F1F3}" },
+    .{ "guinea-bissau", "\u{1F1EC}\u{1F1FC}" },
+    .{ "guitar", "\u{1F3B8}" },
+    .{ "gun", "\u{1F52B}" },
+    .{ "guyana", "\u{1F1EC}\u{1F1FE}" },
+    .{ "haircut", "\u{1F487}" },
+    .{ "haiti", "\u{1F1ED}\u{1F1F9}" },
+    .{ "hamburger", "\u{1F354}" },
+    .{ "hammer", "\u{1F528}" },
+    .{ "hammer_and_pick", "\u{2692}" },
+    .{ "hammer_and_wrench", "\u{1F6E0}" },
+    .{ "hamster", "\u{1F439}" },
+    .{ "hamster_face", "\u{1F439}" },
+    .{ "hand", "\u{270B}" },
+    .{ "hand_with_fingers_splayed", "\u{1F590}" },
+    .{ "hand_with_fingers_splayed_dark_skin_tone", "\u{1F590}\u{1F3FF}" },
+    .{ "hand_with_fingers_splayed_light_skin_tone", "\u{1F590}\u{1F3FB}" },
+    .{ "hand_with_fingers_splayed_medium-dark_skin_tone", "\u{1F590}\u{1F3FE}" },
+    .{ "hand_with_fingers_splayed_medium-light_skin_tone", "\u{1F590}\u{1F3FC}" },
+    .{ "hand_with_fingers_splayed_medium_skin_tone", "\u{1F590}\u{1F3FD}" },
+    .{ "handbag", "\u{1F45C}" },
+    .{ "handshake", "\u{1F91D}" },
+    .{ "hankey", "\u{1F4A9}" },
+    .{ "hatched_chick", "\u{1F425}" },
+    .{ "hatching_chick", "\u{1F423}" },
+    .{ "headphone", "\u{1F3A7}" },
+    .{ "headphones", "\u{1F3A7}" },
+    .{ "hear-no-evil_monkey", "\u{1F649}" },
+    .{ "hear_no_evil", "\u{1F649}" },
+    .{ "heart", "\u{2764}" },
+    .{ "heart_decoration", "\u{1F49F}" },
+    .{ "heart_eyes", "\u{1F60D}" },
+    .{ "heart_eyes_cat", "\u{1F63B}" },
+    .{ "heart_suit", "\u{2665}" },
+    .{ "heart_with_arrow", "\u{1F498}" },
+    .{ "heart_with_ribbon", "\u{1F49D}" },
+    .{ "heartbeat", "\u{1F493}" },
+    .{ "heartpulse", "\u{1F497}" },
+    .{ "hearts", "\u{2665}" },
+    .{ "heavy_check_mark", "\u{2714}" },
+    .{ "heavy_division_sign", "\u{2797}" },
+    .{ "heavy_dollar_sign", "\u{1F4B2}" },
+    .{ "heavy_exclamation_mark", "\u{2757}" },
+    .{ "heavy_heart_exclamation", "\u{2763}" },
+    .{ "heavy_heart_exclamation_mark_ornament", "\u{2763}" },
+    .{ "heavy_large_circle", "\u{2B55}" },
+    .{ "heavy_minus_sign", "\u{2796}" },
+    .{ "heavy_multiplication_x", "\u{2716}" },
+    .{ "heavy_plus_sign", "\u{2795}" },
+    .{ "hedgehog", "\u{1F994}" },
+    .{ "helicopter", "\u{1F681}" },
+    .{ "helm_symbol", "\u{2388}" },
+    .{ "helmet_with_white_cross", "\u{26D1}" },
+    .{ "herb", "\u{1F33F}" },
+    .{ "hibiscus", "\u{1F33A}" },
+    .{ "high-heeled_shoe", "\u{1F460}" },
+    .{ "high-speed_train", "\u{1F684}" },
+    .{ "high_brightness", "\u{1F506}" },
+    .{ "high_heel", "\u{1F460}" },
+    .{ "high_voltage", "\u{26A1}" },
+    .{ "hiking_boot", "\u{1F97E}" },
+    .{ "hindu_temple", "\u{1F6D5}" },
+    .{ "hippopotamus", "\u{1F99B}" },
+    .{ "hocho", "\u{1F52A}" },
+    .{ "hole", "\u{1F573}" },
+    .{ "honduras", "\u{1F1ED}\u{1F1F3}" },
+    .{ "honey_pot", "\u{1F36F}" },
+    .{ "honeybee", "\u{1F41D}" },
+    .{ "hong_kong_sar_china", "\u{1F1ED}\u{1F1F0}" },
+    .{ "horizontal_traffic_light", "\u{1F6A5}" },
+    .{ "horse", "\u{1F434}" },
+    .{ "horse_face", "\u{1F434}" },
+    .{ "horse_racing", "\u{1F3C7}" },
+    .{ "horse_racing_dark_skin_tone", "\u{1F3C7}\u{1F3FF}" },
+    .{ "horse_racing_light_skin_tone", "\u{1F3C7}\u{1F3FB}" },
+    .{ "horse_racing_medium-dark_skin_tone", "\u{1F3C7}\u{1F3FE}" },
+    .{ "horse_racing_medium-light_skin_tone", "\u{1F3C7}\u{1F3FC}" },
+    .{ "horse_racing_medium_skin_tone", "\u{1F3C7}\u{1F3FD}" },
+    .{ "hospital", "\u{1F3E5}" },
+    .{ "hot_beverage", "\u{2615}" },
+    .{ "hot_dog", "\u{1F32D}" },
+    .{ "hot_face", "\u{1F975}" },
+    .{ "hot_pepper", "\u{1F336}" },
+    .{ "hot_springs", "\u{2668}" },
+    .{ "hotel", "\u{1F3E8}" },
+    .{ "hotsprings", "\u{2668}" },
+    .{ "hourglass", "\u{231B}" },
+    .{ "hourglass_done", "\u{231B}" },
+    .{ "hourglass_flowing_sand", "\u{23F3}" },
+    .{ "hourglass_not_done", "\u{23F3}" },
+    .{ "house", "\u{1F3E0}" },
+    .{ "house_buildings", "\u{1F3D8}" },
+    .{ "house_with_garden", "\u{1F3E1}" },
+    .{ "houses", "\u{1F3D8}" },
+    .{ "hugging_face", "\u{1F917}" },
+    .{ "hundred_points", "\u{1F4AF}" },
+    .{ "hungary", "\u{1F1ED}\u{1F1FA}" },
+    .{ "hushed", "\u{1F62F}" },
+    .{ "hushed_face", "\u{1F62F}" },
+    .{ "ice", "\u{1F9CA}" },
+    .{ "ice_cream", "\u{1F368}" },
+    .{ "ice_hockey", "\u{1F3D2}" },
+    .{ "ice_hockey_stick_and_puck", "\u{1F3D2}" },
+    .{ "ice_skate", "\u{26F8}" },
+    .{ "icecream", "\u{1F366}" },
+    .{ "iceland", "\u{1F1EE}\u{1F1F8}" },
+    .{ "id", "\u{1F194}" },
+    .{ "id_button", "\u{1F194}" },
+    .{ "ideograph_advantage", "\u{1F250}" },
+    .{ "imp", "\u{1F47F}" },
+    .{ "inbox_tray", "\u{1F4E5}" },
+    .{ "incoming_envelope", "\u{1F4E8}" },
+    .{ "index_pointing_up", "\u{261D}" },
+    .{ "index_pointing_up_dark_skin_tone", "\u{261D}\u{1F3FF}" },
+    .{ "index_pointing_up_light_skin_tone", "\u{261D}\u{1F3FB}" },
+    .{ "index_pointing_up_medium-dark_skin_tone", "\u{261D}\u{1F3FE}" },
+    .{ "index_pointing_up_medium-light_skin_tone", "\u{261D}\u{1F3FC}" },
+    .{ "index_pointing_up_medium_skin_tone", "\u{261D}\u{1F3FD}" },
+    .{ "india", "\u{1F1EE}\u{1F1F3}" },
+    .{ "indonesia", "\u{1F1EE}\u{1F1E9}" },
+    .{ "infinity", "\u{267E}" },
+    .{ "information", "\u{2139}" },
+    .{ "information_desk_person", "\u{1F481}" },
+    .{ "information_source", "\u{2139}" },
+    .{ "innocent", "\u{1F607}" },
+    .{ "input_latin_letters", "\u{1F524}" },
+    .{ "input_latin_lowercase", "\u{1F521}" },
+    .{ "input_latin_uppercase", "\u{1F520}" },
+    .{ "input_numbers", "\u{1F522}" },
+    .{ "input_symbols", "\u{1F523}" },
+    .{ "interrobang", "\u{2049}" },
+    .{ "iphone", "\u{1F4F1}" },
+    .{ "iran", "\u{1F1EE}\u{1F1F7}" },
+    .{ "iraq", "\u{1F1EE}\u{1F1F6}" },
+    .{ "ireland", "\u{1F1EE}\u{1F1EA}" },
+    .{ "isle_of_man", "\u{1F1EE}\u{1F1F2}" },
+    .{ "israel", "\u{1F1EE}\u{1F1F1}" },
+    .{ "italy", "\u{1F1EE}\u{1F1F9}" },
+    .{ "izakaya_lantern", "\u{1F3EE}" },
+    .{ "jack-o-lantern", "\u{1F383}" },
+    .{ "jack_o_lantern", "\u{1F383}" },
+    .{ "jamaica", "\u{1F1EF}\u{1F1F2}" },
+    .{ "japan", "\u{1F5FE}" },
+    .{ "japanese_acceptable_button", "\u{1F251}" },
+    .{ "japanese_application_button", "\u{1F238}" },
+    .{ "japanese_bargain_button", "\u{1F250}" },
+    .{ "japanese_castle", "\u{1F3EF}" },
+    .{ "japanese_congratulations_button", "\u{3297}" },
+    .{ "japanese_discount_button", "\u{1F239}" },
+    .{ "japanese_dolls", "\u{1F38E}" },
+    .{ "japanese_free_of_charge_button", "\u{1F21A}" },
+    .{ "japanese_goblin", "\u{1F47A}" },
+    .{ "japanese_here_button", "\u{1F201}" },
+    .{ "japanese_monthly_amount_button", "\u{1F237}" },
+    .{ "japanese_no_vacancy_button", "\u{1F235}" },
+    .{ "japanese_not_free_of_charge_button", "\u{1F236}" },
+    .{ "japanese_ogre", "\u{1F479}" },
+    .{ "japanese_open_for_business_button", "\u{1F23A}" },
+    .{ "japanese_passing_grade_button", "\u{1F234}" },
+    .{ "japanese_post_office", "\u{1F3E3}" },
+    .{ "japanese_prohibited_button", "\u{1F232}" },
+    .{ "japanese_reserved_button", "\u{1F22F}" },
+    .{ "japanese_secret_button", "\u{3299}" },
+    .{ "japanese_service_charge_button", "\u{1F202}" },
+    .{ "japanese_symbol_for_beginner", "\u{1F530}" },
+    .{ "japanese_vacancy_button", "\u{1F233}" },
+    .{ "jeans", "\u{1F456}" },
+    .{ "jersey", "\u{1F1EF}\u{1F1EA}" },
+    .{ "jigsaw", "\u{1F9E9}" },
+    .{ "joker", "\u{1F0CF}" },
+    .{ "jordan", "\u{1F1EF}\u{1F1F4}" },
+    .{ "joy", "\u{1F602}" },
+    .{ "joy_cat", "\u{1F639}" },
+    .{ "joystick", "\u{1F579}" },
+    .{ "kaaba", "\u{1F54B}" },
+    .{ "kangaroo", "\u{1F998}" },
+    .{ "kazakhstan", "\u{1F1F0}\u{1F1FF}" },
+    .{ "kenya", "\u{1F1F0}\u{1F1EA}" },
+    .{ "key", "\u{1F511}" },
+    .{ "keyboard", "\u{2328}" },
+    .{ "keycap_0", "\u{30}\u{FE0F}\u{20E3}" },
+    .{ "keycap_1", "\u{31}\u{FE0F}\u{20E3}" },
+    .{ "keycap_10", "\u{1F51F}" },
+    .{ "keycap_2", "\u{32}\u{FE0F}\u{20E3}" },
+    .{ "keycap_3", "\u{33}\u{FE0F}\u{20E3}" },
+    .{ "keycap_4", "\u{34}\u{FE0F}\u{20E3}" },
+    .{ "keycap_5", "\u{35}\u{FE0F}\u{20E3}" },
+    .{ "keycap_6", "\u{36}\u{FE0F}\u{20E3}" },
+    .{ "keycap_7", "\u{37}\u{FE0F}\u{20E3}" },
+    .{ "keycap_8", "\u{38}\u{FE0F}\u{20E3}" },
+    .{ "keycap_9", "\u{39}\u{FE0F}\u{20E3}" },
+    .{ "keycap_asterisk", "\u{2A}\u{20E3}" },
+    .{ "keycap_digit_eight", "\u{38}\u{20E3}" },
+    .{ "keycap_digit_five", "\u{35}\u{20E3}" },
+    .{ "keycap_digit_four", "\u{34}\u{20E3}" },
+    .{ "keycap_digit_nine", "\u{39}\u{20E3}" },
+    .{ "keycap_digit_one", "\u{31}\u{20E3}" },
+    .{ "keycap_digit_seven", "\u{37}\u{20E3}" },
+    .{ "keycap_digit_six", "\u{36}\u{20E3}" },
+    .{ "keycap_digit_three", "\u{33}\u{20E3}" },
+    .{ "keycap_digit_two", "\u{32}\u{20E3}" },
+    .{ "keycap_digit_zero", "\u{30}\u{20E3}" },
+    .{ "keycap_number_sign", "\u{23}\u{20E3}" },
+    .{ "kick_scooter", "\u{1F6F4}" },
+    .{ "kimono", "\u{1F458}" },
+    .{ "kiribati", "\u{1F1F0}\u{1F1EE}" },
+    .{ "kiss", "\u{1F48B}" },
+    .{ "kiss_man_man", "\u{1F468}\u{200D}\u{2764}\u{FE0F}\u{200D}\u{1F48B}\u{200D}\u{1F468}" },
+    .{ "kiss_mark", "\u{1F48B}" },
+    .{ "kiss_woman_man", "\u{1F469}\u{200D}\u{2764}\u{FE0F}\u{200D}\u{1F48B}\u{200D}\u{1F468}" },
+    .{ "kiss_woman_woman", "\u{1F469}\u{200D}\u{2764}\u{FE0F}\u{200D}\u{1F48B}\u{200D}\u{1F469}" },
+    .{ "kissing", "\u{1F617}" },
+    .{ "kissing_cat", "\u{1F63D}" },
+    .{ "kissing_cat_face", "\u{1F63D}" },
+    .{ "kissing_closed_eyes", "\u{1F61A}" },
+    .{ "kissing_face", "\u{1F617}" },
+    .{ "kissing_face_with_closed_eyes", "\u{1F61A}" },
+    .{ "kissing_face_with_smiling_eyes", "\u{1F619}" },
+    .{ "kissing_heart", "\u{1F618}" },
+    .{ "kissing_smiling_eyes", "\u{1F619}" },
+    .{ "kitchen_knife", "\u{1F52A}" },
+    .{ "kite", "\u{1FA81}" },
+    .{ "kiwi_fruit", "\u{1F95D}" },
+    .{ "knife", "\u{1F52A}" },
+    .{ "koala", "\u{1F428}" },
+    .{ "koko", "\u{1F201}" },
+    .{ "kosovo", "\u{1F1FD}\u{1F1F0}" },
+    .{ "kuwait", "\u{1F1F0}\u{1F1FC}" },
+    .{ "kyrgyzstan", "\u{1F1F0}\u{1F1EC}" },
+    .{ "lab_coat", "\u{1F97C}" },
+    .{ "label", "\u{1F3F7}" },
+    .{ "lacrosse", "\u{1F94D}" },
+    .{ "lady_beetle", "\u{1F41E}" },
+    .{ "lantern", "\u{1F3EE}" },
+    .{ "laos", "\u{1F1F1}\u{1F1E6}" },
+    .{ "laptop_computer", "\u{1F4BB}" },
+    .{ "large_blue_circle", "\u{1F535}" },
+    .{ "large_blue_diamond", "\u{1F537}" },
+    .{ "large_orange_diamond", "\u{1F536}" },
+    .{ "last_quarter_moon", "\u{1F317}" },
+    .{ "last_quarter_moon_face", "\u{1F31C}" },
+    .{ "last_quarter_moon_with_face", "\u{1F31C}" },
+    .{ "last_track_button", "\u{23EE}" },
+    .{ "latin_cross", "\u{271D}" },
+    .{ "latvia", "\u{1F1F1}\u{1F1FB}" },
+    .{ "laughing", "\u{1F606}" },
+    .{ "leaf_fluttering_in_wind", "\u{1F343}" },
+    .{ "leafy_green", "\u{1F96C}" },
+    .{ "leaves", "\u{1F343}" },
+    .{ "lebanon", "\u{1F1F1}\u{1F1E7}" },
+    .{ "ledger", "\u{1F4D2}" },
+    .{ "left-facing_fist", "\u{1F91B}" },
+    .{ "left-facing_fist_dark_skin_tone", "\u{1F91B}\u{1F3FF}" },
+    .{ "left-facing_fist_light_skin_tone", "\u{1F91B}\u{1F3FB}" },
+    .{ "left-facing_fist_medium-dark_skin_tone", "\u{1F91B}\u{1F3FE}" },
+    .{ "left-facing_fist_medium-light_skin_tone", "\u{1F91B}\u{1F3FC}" },
+    .{ "left-facing_fist_medium_skin_tone", "\u{1F91B}\u{1F3FD}" },
+    .{ "left-right_arrow", "\u{2194}" },
+    .{ "left_arrow", "\u{2B05}" },
+    .{ "left_arrow_curving_right", "\u{21AA}" },
+    .{ "left_luggage", "\u{1F6C5}" },
+    .{ "left_right_arrow", "\u{2194}" },
+    .{ "left_speech_bubble", "\u{1F5E8}" },
+    .{ "leftwards_arrow_with_hook", "\u{21A9}" },
+    .{ "leg", "\u{1F9B5}" },
+    .{ "lemon", "\u{1F34B}" },
+    .{ "leo", "\u{264C}" },
+    .{ "leopard", "\u{1F406}" },
+    .{ "lesotho", "\u{1F1F1}\u{1F1F8}" },
+    .{ "level_slider", "\u{1F39A}" },
+    .{ "liberia", "\u{1F1F1}\u{1F1F7}" },
+    .{ "libra", "\u{264E}" },
+    .{ "libya", "\u{1F1F1}\u{1F1FE}" },
+    .{ "liechtenstein", "\u{1F1F1}\u{1F1EE}" },
+    .{ "light_bulb", "\u{1F4A1}" },
+    .{ "light_rail", "\u{1F688}" },
+    .{ "light_skin_tone", "\u{1F3FB}" },
+    .{ "link", "\u{1F517}" },
+    .{ "linked_paperclips", "\u{1F587}" },
+    .{ "lion_face", "\u{1F981}" },
+    .{ "lips", "\u{1F444}" },
+    .{ "lipstick", "\u{1F484}" },
+    .{ "lithuania", "\u{1F1F1}\u{1F1F9}" },
+    .{ "litter_in_bin_sign", "\u{1F6AE}" },
+    .{ "lizard", "\u{1F98E}" },
+    .{ "llama", "\u{1F999}" },
+    .{ "lobster", "\u{1F99E}" },
+    .{ "lock", "\u{1F512}" },
+    .{ "lock_with_ink_pen", "\u{1F50F}" },
+    .{ "locked", "\u{1F512}" },
+    .{ "locked_with_key", "\u{1F510}" },
+    .{ "locked_with_pen", "\u{1F50F}" },
+    .{ "locomotive", "\u{1F682}" },
+    .{ "lollipop", "\u{1F36D}" },
+    .{ "loop", "\u{27BF}" },
+    .{ "lotion_bottle", "\u{1F9F4}" },
+    .{ "loud_sound", "\u{1F50A}" },
+    .{ "loudly_crying_face", "\u{1F62D}" },
+    .{ "loudspeaker", "\u{1F4E2}" },
+    .{ "love-you_gesture", "\u{1F91F}" },
+    .{ "love-you_gesture_dark_skin_tone", "\u{1F91F}\u{1F3FF}" },
+    .{ "love-you_gesture_light_skin_tone", "\u{1F91F}\u{1F3FB}" },
+    .{ "love-you_gesture_medium-dark_skin_tone", "\u{1F91F}\u{1F3FE}" },
+    .{ "love-you_gesture_medium-light_skin_tone", "\u{1F91F}\u{1F3FC}" },
+    .{ "love-you_gesture_medium_skin_tone", "\u{1F91F}\u{1F3FD}" },
+    .{ "love_hotel", "\u{1F3E9}" },
+    .{ "love_letter", "\u{1F48C}" },
+    .{ "low_brightness", "\u{1F505}" },
+    .{ "lower_left_ballpoint_pen", "\u{1F58A}" },
+    .{ "lower_left_crayon", "\u{1F58D}" },
+    .{ "lower_left_fountain_pen", "\u{1F58B}" },
+    .{ "lower_left_paintbrush", "\u{1F58C}" },
+    .{ "luggage", "\u{1F9F3}" },
+    .{ "luxembourg", "\u{1F1F1}\u{1F1FA}" },
+    .{ "lying_face", "\u{1F925}" },
+    .{ "m", "\u{24C2}" },
+    .{ "macau_sar_china", "\u{1F1F2}\u{1F1F4}" },
+    .{ "macedonia", "\u{1F1F2}\u{1F1F0}" },
+    .{ "madagascar", "\u{1F1F2}\u{1F1EC}" },
+    .{ "mag", "\u{1F50D}" },
+    .{ "mag_right", "\u{1F50E}" },
+    .{ "mage", "\u{1F9D9}" },
+    .{ "mage_dark_skin_tone", "\u{1F9D9}\u{1F3FF}" },
+    .{ "mage_light_skin_tone", "\u{1F9D9}\u{1F3FB}" },
+    .{ "mage_medium-dark_skin_tone", "\u{1F9D9}\u{1F3FE}" },
+    .{ "mage_medium-light_skin_tone", "\u{1F9D9}\u{1F3FC}" },
+    .{ "mage_medium_skin_tone", "\u{1F9D9}\u{1F3FD}" },
+    .{ "magnet", "\u{1F9F2}" },
+    .{ "magnifying_glass_tilted_left", "\u{1F50D}" },
+    .{ "magnifying_glass_tilted_right", "\u{1F50E}" },
+    .{ "mahjong", "\u{1F004}" },
+    .{ "mahjong_red_dragon", "\u{1F004}" },
+    .{ "mailbox", "\u{1F4EB}" },
+    .{ "mailbox_closed", "\u{1F4EA}" },
+    .{ "mailbox_with_mail", "\u{1F4EC}" },
+    .{ "mailbox_with_no_mail", "\u{1F4ED}" },
+    .{ "malawi", "\u{1F1F2}\u{1F1FC}" },
+    .{ "malaysia", "\u{1F1F2}\u{1F1FE}" },
+    .{ "maldives", "\u{1F1F2}\u{1F1FB}" },
+    .{ "male_sign", "\u{2642}" },
+    .{ "mali", "\u{1F1F2}\u{1F1F1}" },
+    .{ "malta", "\u{1F1F2}\u{1F1F9}" },
+    .{ "man", "\u{1F468}" },
+    .{ "man_and_woman_holding_hands", "\u{1F46B}" },
+    .{ "man_artist", "\u{1F468}\u{200D}\u{1F3A8}" },
+    .{ "man_artist_dark_skin_tone", "\u{1F468}\u{1F3FF}\u{200D}\u{1F3A8}" },
+    .{ "man_artist_light_skin_tone", "\u{1F468}\u{1F3FB}\u{200D}\u{1F3A8}" },
+    .{ "man_artist_medium-dark_skin_tone", "\u{1F468}\u{1F3FE}\u{200D}\u{1F3A8}" },
+    .{ "man_artist_medium-light_skin_tone", "\u{1F468}\u{1F3FC}\u{200D}\u{1F3A8}" },
+    .{ "man_artist_medium_skin_tone", "\u{1F468}\u{1F3FD}\u{200D}\u{1F3A8}" },
+    .{ "man_astronaut", "\u{1F468}\u{200D}\u{1F680}" },
+    .{ "man_astronaut_dark_skin_tone", "\u{1F468}\u{1F3FF}\u{200D}\u{1F680}" },
+    .{ "man_astronaut_light_skin_tone", "\u{1F468}\u{1F3FB}\u{200D}\u{1F680}" },
+    .{ "man_astronaut_medium-dark_skin_tone", "\u{1F468}\u{1F3FE}\u{200D}\u{1F680}" },
+    .{ "man_astronaut_medium-light_skin_tone", "\u{1F468}\u{1F3FC}\u{200D}\u{1F680}" },
+    .{ "man_astronaut_medium_skin_tone", "\u{1F468}\u{1F3FD}\u{200D}\u{1F680}" },
+    .{ "man_biking", "\u{1F6B4}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_biking_dark_skin_tone", "\u{1F6B4}\u{1F3FF}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_biking_light_skin_tone", "\u{1F6B4}\u{1F3FB}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_biking_medium-dark_skin_tone", "\u{1F6B4}\u{1F3FE}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_biking_medium-light_skin_tone", "\u{1F6B4}\u{1F3FC}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_biking_medium_skin_tone", "\u{1F6B4}\u{1F3FD}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_bouncing_ball", "\u{26F9}\u{FE0F}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_bouncing_ball_dark_skin_tone", "\u{26F9}\u{1F3FF}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_bouncing_ball_light_skin_tone", "\u{26F9}\u{1F3FB}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_bouncing_ball_medium-dark_skin_tone", "\u{26F9}\u{1F3FE}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_bouncing_ball_medium-light_skin_tone", "\u{26F9}\u{1F3FC}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_bouncing_ball_medium_skin_tone", "\u{26F9}\u{1F3FD}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_bowing", "\u{1F647}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_bowing_dark_skin_tone", "\u{1F647}\u{1F3FF}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_bowing_light_skin_tone", "\u{1F647}\u{1F3FB}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_bowing_medium-dark_skin_tone", "\u{1F647}\u{1F3FE}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_bowing_medium-light_skin_tone", "\u{1F647}\u{1F3FC}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_bowing_medium_skin_tone", "\u{1F647}\u{1F3FD}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_cartwheeling", "\u{1F938}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_cartwheeling_dark_skin_tone", "\u{1F938}\u{1F3FF}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_cartwheeling_light_skin_tone", "\u{1F938}\u{1F3FB}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_cartwheeling_medium-dark_skin_tone", "\u{1F938}\u{1F3FE}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_cartwheeling_medium-light_skin_tone", "\u{1F938}\u{1F3FC}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_cartwheeling_medium_skin_tone", "\u{1F938}\u{1F3FD}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_climbing", "\u{1F9D7}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_climbing_dark_skin_tone", "\u{1F9D7}\u{1F3FF}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_climbing_light_skin_tone", "\u{1F9D7}\u{1F3FB}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_climbing_medium-dark_skin_tone", "\u{1F9D7}\u{1F3FE}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_climbing_medium-light_skin_tone", "\u{1F9D7}\u{1F3FC}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_climbing_medium_skin_tone", "\u{1F9D7}\u{1F3FD}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_construction_worker", "\u{1F477}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_construction_worker_dark_skin_tone", "\u{1F477}\u{1F3FF}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_construction_worker_light_skin_tone", "\u{1F477}\u{1F3FB}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_construction_worker_medium-dark_skin_tone", "\u{1F477}\u{1F3FE}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_construction_worker_medium-light_skin_tone", "\u{1F477}\u{1F3FC}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_construction_worker_medium_skin_tone", "\u{1F477}\u{1F3FD}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_cook", "\u{1F468}\u{200D}\u{1F373}" },
+    .{ "man_cook_dark_skin_tone", "\u{1F468}\u{1F3FF}\u{200D}\u{1F373}" },
+    .{ "man_cook_light_skin_tone", "\u{1F468}\u{1F3FB}\u{200D}\u{1F373}" },
+    .{ "man_cook_medium-dark_skin_tone", "\u{1F468}\u{1F3FE}\u{200D}\u{1F373}" },
+    .{ "man_cook_medium-light_skin_tone", "\u{1F468}\u{1F3FC}\u{200D}\u{1F373}" },
+    .{ "man_cook_medium_skin_tone", "\u{1F468}\u{1F3FD}\u{200D}\u{1F373}" },
+    .{ "man_dancing", "\u{1F57A}" },
+    .{ "man_dancing_dark_skin_tone", "\u{1F57A}\u{1F3FF}" },
+    .{ "man_dancing_light_skin_tone", "\u{1F57A}\u{1F3FB}" },
+    .{ "man_dancing_medium-dark_skin_tone", "\u{1F57A}\u{1F3FE}" },
+    .{ "man_dancing_medium-light_skin_tone", "\u{1F57A}\u{1F3FC}" },
+    .{ "man_dancing_medium_skin_tone", "\u{1F57A}\u{1F3FD}" },
+    .{ "man_dark_skin_tone", "\u{1F468}\u{1F3FF}" },
+    .{ "man_detective", "\u{1F575}\u{FE0F}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_detective_dark_skin_tone", "\u{1F575}\u{1F3FF}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_detective_light_skin_tone", "\u{1F575}\u{1F3FB}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_detective_medium-dark_skin_tone", "\u{1F575}\u{1F3FE}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_detective_medium-light_skin_tone", "\u{1F575}\u{1F3FC}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_detective_medium_skin_tone", "\u{1F575}\u{1F3FD}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_elf", "\u{1F9DD}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_elf_dark_skin_tone", "\u{1F9DD}\u{1F3FF}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_elf_light_skin_tone", "\u{1F9DD}\u{1F3FB}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_elf_medium-dark_skin_tone", "\u{1F9DD}\u{1F3FE}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_elf_medium-light_skin_tone", "\u{1F9DD}\u{1F3FC}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_elf_medium_skin_tone", "\u{1F9DD}\u{1F3FD}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_facepalming", "\u{1F926}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_facepalming_dark_skin_tone", "\u{1F926}\u{1F3FF}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_facepalming_light_skin_tone", "\u{1F926}\u{1F3FB}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_facepalming_medium-dark_skin_tone", "\u{1F926}\u{1F3FE}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_facepalming_medium-light_skin_tone", "\u{1F926}\u{1F3FC}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_facepalming_medium_skin_tone", "\u{1F926}\u{1F3FD}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_factory_worker", "\u{1F468}\u{200D}\u{1F3ED}" },
+    .{ "man_factory_worker_dark_skin_tone", "\u{1F468}\u{1F3FF}\u{200D}\u{1F3ED}" },
+    .{ "man_factory_worker_light_skin_tone", "\u{1F468}\u{1F3FB}\u{200D}\u{1F3ED}" },
+    .{ "man_factory_worker_medium-dark_skin_tone", "\u{1F468}\u{1F3FE}\u{200D}\u{1F3ED}" },
+    .{ "man_factory_worker_medium-light_skin_tone", "\u{1F468}\u{1F3FC}\u{200D}\u{1F3ED}" },
+    .{ "man_factory_worker_medium_skin_tone", "\u{1F468}\u{1F3FD}\u{200D}\u{1F3ED}" },
+    .{ "man_fairy", "\u{1F9DA}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_fairy_dark_skin_tone", "\u{1F9DA}\u{1F3FF}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_fairy_light_skin_tone", "\u{1F9DA}\u{1F3FB}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_fairy_medium-dark_skin_tone", "\u{1F9DA}\u{1F3FE}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_fairy_medium-light_skin_tone", "\u{1F9DA}\u{1F3FC}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_fairy_medium_skin_tone", "\u{1F9DA}\u{1F3FD}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_farmer", "\u{1F468}\u{200D}\u{1F33E}" },
+    .{ "man_farmer_dark_skin_tone", "\u{1F468}\u{1F3FF}\u{200D}\u{1F33E}" },
+    .{ "man_farmer_light_skin_tone", "\u{1F468}\u{1F3FB}\u{200D}\u{1F33E}" },
+    .{ "man_farmer_medium-dark_skin_tone", "\u{1F468}\u{1F3FE}\u{200D}\u{1F33E}" },
+    .{ "man_farmer_medium-light_skin_tone", "\u{1F468}\u{1F3FC}\u{200D}\u{1F33E}" },
+    .{ "man_farmer_medium_skin_tone", "\u{1F468}\u{1F3FD}\u{200D}\u{1F33E}" },
+    .{ "man_firefighter", "\u{1F468}\u{200D}\u{1F692}" },
+    .{ "man_firefighter_dark_skin_tone", "\u{1F468}\u{1F3FF}\u{200D}\u{1F692}" },
+    .{ "man_firefighter_light_skin_tone", "\u{1F468}\u{1F3FB}\u{200D}\u{1F692}" },
+    .{ "man_firefighter_medium-dark_skin_tone", "\u{1F468}\u{1F3FE}\u{200D}\u{1F692}" },
+    .{ "man_firefighter_medium-light_skin_tone", "\u{1F468}\u{1F3FC}\u{200D}\u{1F692}" },
+    .{ "man_firefighter_medium_skin_tone", "\u{1F468}\u{1F3FD}\u{200D}\u{1F692}" },
+    .{ "man_frowning", "\u{1F64D}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_frowning_dark_skin_tone", "\u{1F64D}\u{1F3FF}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_frowning_light_skin_tone", "\u{1F64D}\u{1F3FB}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_frowning_medium-dark_skin_tone", "\u{1F64D}\u{1F3FE}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_frowning_medium-light_skin_tone", "\u{1F64D}\u{1F3FC}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_frowning_medium_skin_tone", "\u{1F64D}\u{1F3FD}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_genie", "\u{1F9DE}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_gesturing_no", "\u{1F645}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_gesturing_no_dark_skin_tone", "\u{1F645}\u{1F3FF}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_gesturing_no_light_skin_tone", "\u{1F645}\u{1F3FB}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_gesturing_no_medium-dark_skin_tone", "\u{1F645}\u{1F3FE}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_gesturing_no_medium-light_skin_tone", "\u{1F645}\u{1F3FC}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_gesturing_no_medium_skin_tone", "\u{1F645}\u{1F3FD}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_gesturing_ok", "\u{1F646}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_gesturing_ok_dark_skin_tone", "\u{1F646}\u{1F3FF}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_gesturing_ok_light_skin_tone", "\u{1F646}\u{1F3FB}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_gesturing_ok_medium-dark_skin_tone", "\u{1F646}\u{1F3FE}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_gesturing_ok_medium-light_skin_tone", "\u{1F646}\u{1F3FC}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_gesturing_ok_medium_skin_tone", "\u{1F646}\u{1F3FD}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_getting_haircut", "\u{1F487}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_getting_haircut_dark_skin_tone", "\u{1F487}\u{1F3FF}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_getting_haircut_light_skin_tone", "\u{1F487}\u{1F3FB}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_getting_haircut_medium-dark_skin_tone", "\u{1F487}\u{1F3FE}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_getting_haircut_medium-light_skin_tone", "\u{1F487}\u{1F3FC}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_getting_haircut_medium_skin_tone", "\u{1F487}\u{1F3FD}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_getting_massage", "\u{1F486}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_getting_massage_dark_skin_tone", "\u{1F486}\u{1F3FF}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_getting_massage_light_skin_tone", "\u{1F486}\u{1F3FB}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_getting_massage_medium-dark_skin_tone", "\u{1F486}\u{1F3FE}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_getting_massage_medium-light_skin_tone", "\u{1F486}\u{1F3FC}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_getting_massage_medium_skin_tone", "\u{1F486}\u{1F3FD}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_golfing", "\u{1F3CC}\u{FE0F}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_golfing_dark_skin_tone", "\u{1F3CC}\u{1F3FF}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_golfing_light_skin_tone", "\u{1F3CC}\u{1F3FB}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_golfing_medium-dark_skin_tone", "\u{1F3CC}\u{1F3FE}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_golfing_medium-light_skin_tone", "\u{1F3CC}\u{1F3FC}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_golfing_medium_skin_tone", "\u{1F3CC}\u{1F3FD}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_guard", "\u{1F482}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_guard_dark_skin_tone", "\u{1F482}\u{1F3FF}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_guard_light_skin_tone", "\u{1F482}\u{1F3FB}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_guard_medium-dark_skin_tone", "\u{1F482}\u{1F3FE}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_guard_medium-light_skin_tone", "\u{1F482}\u{1F3FC}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_guard_medium_skin_tone", "\u{1F482}\u{1F3FD}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_health_worker", "\u{1F468}\u{200D}\u{2695}\u{FE0F}" },
+    .{ "man_health_worker_dark_skin_tone", "\u{1F468}\u{1F3FF}\u{200D}\u{2695}\u{FE0F}" },
+    .{ "man_health_worker_light_skin_tone", "\u{1F468}\u{1F3FB}\u{200D}\u{2695}\u{FE0F}" },
+    .{ "man_health_worker_medium-dark_skin_tone", "\u{1F468}\u{1F3FE}\u{200D}\u{2695}\u{FE0F}" },
+    .{ "man_health_worker_medium-light_skin_tone", "\u{1F468}\u{1F3FC}\u{200D}\u{2695}\u{FE0F}" },
+    .{ "man_health_worker_medium_skin_tone", "\u{1F468}\u{1F3FD}\u{200D}\u{2695}\u{FE0F}" },
+    .{ "man_in_business_suit_levitating", "\u{1F574}" },
+    .{ "man_in_lotus_position", "\u{1F9D8}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_in_lotus_position_dark_skin_tone", "\u{1F9D8}\u{1F3FF}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_in_lotus_position_light_skin_tone", "\u{1F9D8}\u{1F3FB}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_in_lotus_position_medium-dark_skin_tone", "\u{1F9D8}\u{1F3FE}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_in_lotus_position_medium-light_skin_tone", "\u{1F9D8}\u{1F3FC}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_in_lotus_position_medium_skin_tone", "\u{1F9D8}\u{1F3FD}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_in_manual_wheelchair", "\u{1F468}\u{200D}\u{1F9BD}" },
+    .{ "man_in_motorized_wheelchair", "\u{1F468}\u{200D}\u{1F9BC}" },
+    .{ "man_in_steamy_room", "\u{1F9D6}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_in_steamy_room_dark_skin_tone", "\u{1F9D6}\u{1F3FF}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_in_steamy_room_light_skin_tone", "\u{1F9D6}\u{1F3FB}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_in_steamy_room_medium-dark_skin_tone", "\u{1F9D6}\u{1F3FE}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_in_steamy_room_medium-light_skin_tone", "\u{1F9D6}\u{1F3FC}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_in_steamy_room_medium_skin_tone", "\u{1F9D6}\u{1F3FD}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_in_suit_levitating", "\u{1F574}" },
+    .{ "man_in_suit_levitating_dark_skin_tone", "\u{1F574}\u{1F3FF}" },
+    .{ "man_in_suit_levitating_light_skin_tone", "\u{1F574}\u{1F3FB}" },
+    .{ "man_in_suit_levitating_medium-dark_skin_tone", "\u{1F574}\u{1F3FE}" },
+    .{ "man_in_suit_levitating_medium-light_skin_tone", "\u{1F574}\u{1F3FC}" },
+    .{ "man_in_suit_levitating_medium_skin_tone", "\u{1F574}\u{1F3FD}" },
+    .{ "man_in_tuxedo", "\u{1F935}" },
+    .{ "man_in_tuxedo_dark_skin_tone", "\u{1F935}\u{1F3FF}" },
+    .{ "man_in_tuxedo_light_skin_tone", "\u{1F935}\u{1F3FB}" },
+    .{ "man_in_tuxedo_medium-dark_skin_tone", "\u{1F935}\u{1F3FE}" },
+    .{ "man_in_tuxedo_medium-light_skin_tone", "\u{1F935}\u{1F3FC}" },
+    .{ "man_in_tuxedo_medium_skin_tone", "\u{1F935}\u{1F3FD}" },
+    .{ "man_judge", "\u{1F468}\u{200D}\u{2696}\u{FE0F}" },
+    .{ "man_judge_dark_skin_tone", "\u{1F468}\u{1F3FF}\u{200D}\u{2696}\u{FE0F}" },
+    .{ "man_judge_light_skin_tone", "\u{1F468}\u{1F3FB}\u{200D}\u{2696}\u{FE0F}" },
+    .{ "man_judge_medium-dark_skin_tone", "\u{1F468}\u{1F3FE}\u{200D}\u{2696}\u{FE0F}" },
+    .{ "man_judge_medium-light_skin_tone", "\u{1F468}\u{1F3FC}\u{200D}\u{2696}\u{FE0F}" },
+    .{ "man_judge_medium_skin_tone", "\u{1F468}\u{1F3FD}\u{200D}\u{2696}\u{FE0F}" },
+    .{ "man_juggling", "\u{1F939}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_juggling_dark_skin_tone", "\u{1F939}\u{1F3FF}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_juggling_light_skin_tone", "\u{1F939}\u{1F3FB}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_juggling_medium-dark_skin_tone", "\u{1F939}\u{1F3FE}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_juggling_medium-light_skin_tone", "\u{1F939}\u{1F3FC}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_juggling_medium_skin_tone", "\u{1F939}\u{1F3FD}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_lifting_weights", "\u{1F3CB}\u{FE0F}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_lifting_weights_dark_skin_tone", "\u{1F3CB}\u{1F3FF}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_lifting_weights_light_skin_tone", "\u{1F3CB}\u{1F3FB}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_lifting_weights_medium-dark_skin_tone", "\u{1F3CB}\u{1F3FE}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_lifting_weights_medium-light_skin_tone", "\u{1F3CB}\u{1F3FC}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_lifting_weights_medium_skin_tone", "\u{1F3CB}\u{1F3FD}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_light_skin_tone", "\u{1F468}\u{1F3FB}" },
+    .{ "man_mage", "\u{1F9D9}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_mage_dark_skin_tone", "\u{1F9D9}\u{1F3FF}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_mage_light_skin_tone", "\u{1F9D9}\u{1F3FB}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_mage_medium-dark_skin_tone", "\u{1F9D9}\u{1F3FE}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_mage_medium-light_skin_tone", "\u{1F9D9}\u{1F3FC}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_mage_medium_skin_tone", "\u{1F9D9}\u{1F3FD}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_mechanic", "\u{1F468}\u{200D}\u{1F527}" },
+    .{ "man_mechanic_dark_skin_tone", "\u{1F468}\u{1F3FF}\u{200D}\u{1F527}" },
+    .{ "man_mechanic_light_skin_tone", "\u{1F468}\u{1F3FB}\u{200D}\u{1F527}" },
+    .{ "man_mechanic_medium-dark_skin_tone", "\u{1F468}\u{1F3FE}\u{200D}\u{1F527}" },
+    .{ "man_mechanic_medium-light_skin_tone", "\u{1F468}\u{1F3FC}\u{200D}\u{1F527}" },
+    .{ "man_mechanic_medium_skin_tone", "\u{1F468}\u{1F3FD}\u{200D}\u{1F527}" },
+    .{ "man_medium-dark_skin_tone", "\u{1F468}\u{1F3FE}" },
+    .{ "man_medium-light_skin_tone", "\u{1F468}\u{1F3FC}" },
+    .{ "man_medium_skin_tone", "\u{1F468}\u{1F3FD}" },
+    .{ "man_mountain_biking", "\u{1F6B5}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_mountain_biking_dark_skin_tone", "\u{1F6B5}\u{1F3FF}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_mountain_biking_light_skin_tone", "\u{1F6B5}\u{1F3FB}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_mountain_biking_medium-dark_skin_tone", "\u{1F6B5}\u{1F3FE}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_mountain_biking_medium-light_skin_tone", "\u{1F6B5}\u{1F3FC}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_mountain_biking_medium_skin_tone", "\u{1F6B5}\u{1F3FD}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_office_worker", "\u{1F468}\u{200D}\u{1F4BC}" },
+    .{ "man_office_worker_dark_skin_tone", "\u{1F468}\u{1F3FF}\u{200D}\u{1F4BC}" },
+    .{ "man_office_worker_light_skin_tone", "\u{1F468}\u{1F3FB}\u{200D}\u{1F4BC}" },
+    .{ "man_office_worker_medium-dark_skin_tone", "\u{1F468}\u{1F3FE}\u{200D}\u{1F4BC}" },
+    .{ "man_office_worker_medium-light_skin_tone", "\u{1F468}\u{1F3FC}\u{200D}\u{1F4BC}" },
+    .{ "man_office_worker_medium_skin_tone", "\u{1F468}\u{1F3FD}\u{200D}\u{1F4BC}" },
+    .{ "man_pilot", "\u{1F468}\u{200D}\u{2708}\u{FE0F}" },
+    .{ "man_pilot_dark_skin_tone", "\u{1F468}\u{1F3FF}\u{200D}\u{2708}\u{FE0F}" },
+    .{ "man_pilot_light_skin_tone", "\u{1F468}\u{1F3FB}\u{200D}\u{2708}\u{FE0F}" },
+    .{ "man_pilot_medium-dark_skin_tone", "\u{1F468}\u{1F3FE}\u{200D}\u{2708}\u{FE0F}" },
+    .{ "man_pilot_medium-light_skin_tone", "\u{1F468}\u{1F3FC}\u{200D}\u{2708}\u{FE0F}" },
+    .{ "man_pilot_medium_skin_tone", "\u{1F468}\u{1F3FD}\u{200D}\u{2708}\u{FE0F}" },
+    .{ "man_playing_handball", "\u{1F93E}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_playing_handball_dark_skin_tone", "\u{1F93E}\u{1F3FF}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_playing_handball_light_skin_tone", "\u{1F93E}\u{1F3FB}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_playing_handball_medium-dark_skin_tone", "\u{1F93E}\u{1F3FE}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_playing_handball_medium-light_skin_tone", "\u{1F93E}\u{1F3FC}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_playing_handball_medium_skin_tone", "\u{1F93E}\u{1F3FD}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_playing_water_polo", "\u{1F93D}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_playing_water_polo_dark_skin_tone", "\u{1F93D}\u{1F3FF}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_playing_water_polo_light_skin_tone", "\u{1F93D}\u{1F3FB}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_playing_water_polo_medium-dark_skin_tone", "\u{1F93D}\u{1F3FE}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_playing_water_polo_medium-light_skin_tone", "\u{1F93D}\u{1F3FC}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_playing_water_polo_medium_skin_tone", "\u{1F93D}\u{1F3FD}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_police_officer", "\u{1F46E}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_police_officer_dark_skin_tone", "\u{1F46E}\u{1F3FF}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_police_officer_light_skin_tone", "\u{1F46E}\u{1F3FB}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_police_officer_medium-dark_skin_tone", "\u{1F46E}\u{1F3FE}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_police_officer_medium-light_skin_tone", "\u{1F46E}\u{1F3FC}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_police_officer_medium_skin_tone", "\u{1F46E}\u{1F3FD}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_pouting", "\u{1F64E}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_pouting_dark_skin_tone", "\u{1F64E}\u{1F3FF}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_pouting_light_skin_tone", "\u{1F64E}\u{1F3FB}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_pouting_medium-dark_skin_tone", "\u{1F64E}\u{1F3FE}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_pouting_medium-light_skin_tone", "\u{1F64E}\u{1F3FC}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_pouting_medium_skin_tone", "\u{1F64E}\u{1F3FD}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_raising_hand", "\u{1F64B}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_raising_hand_dark_skin_tone", "\u{1F64B}\u{1F3FF}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_raising_hand_light_skin_tone", "\u{1F64B}\u{1F3FB}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_raising_hand_medium-dark_skin_tone", "\u{1F64B}\u{1F3FE}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_raising_hand_medium-light_skin_tone", "\u{1F64B}\u{1F3FC}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_raising_hand_medium_skin_tone", "\u{1F64B}\u{1F3FD}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_rowing_boat", "\u{1F6A3}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_rowing_boat_dark_skin_tone", "\u{1F6A3}\u{1F3FF}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_rowing_boat_light_skin_tone", "\u{1F6A3}\u{1F3FB}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_rowing_boat_medium-dark_skin_tone", "\u{1F6A3}\u{1F3FE}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_rowing_boat_medium-light_skin_tone", "\u{1F6A3}\u{1F3FC}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_rowing_boat_medium_skin_tone", "\u{1F6A3}\u{1F3FD}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_running", "\u{1F3C3}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_running_dark_skin_tone", "\u{1F3C3}\u{1F3FF}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_running_light_skin_tone", "\u{1F3C3}\u{1F3FB}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_running_medium-dark_skin_tone", "\u{1F3C3}\u{1F3FE}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_running_medium-light_skin_tone", "\u{1F3C3}\u{1F3FC}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_running_medium_skin_tone", "\u{1F3C3}\u{1F3FD}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_scientist", "\u{1F468}\u{200D}\u{1F52C}" },
+    .{ "man_scientist_dark_skin_tone", "\u{1F468}\u{1F3FF}\u{200D}\u{1F52C}" },
+    .{ "man_scientist_light_skin_tone", "\u{1F468}\u{1F3FB}\u{200D}\u{1F52C}" },
+    .{ "man_scientist_medium-dark_skin_tone", "\u{1F468}\u{1F3FE}\u{200D}\u{1F52C}" },
+    .{ "man_scientist_medium-light_skin_tone", "\u{1F468}\u{1F3FC}\u{200D}\u{1F52C}" },
+    .{ "man_scientist_medium_skin_tone", "\u{1F468}\u{1F3FD}\u{200D}\u{1F52C}" },
+    .{ "man_shrugging", "\u{1F937}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_shrugging_dark_skin_tone", "\u{1F937}\u{1F3FF}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_shrugging_light_skin_tone", "\u{1F937}\u{1F3FB}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_shrugging_medium-dark_skin_tone", "\u{1F937}\u{1F3FE}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_shrugging_medium-light_skin_tone", "\u{1F937}\u{1F3FC}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_shrugging_medium_skin_tone", "\u{1F937}\u{1F3FD}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_singer", "\u{1F468}\u{200D}\u{1F3A4}" },
+    .{ "man_singer_dark_skin_tone", "\u{1F468}\u{1F3FF}\u{200D}\u{1F3A4}" },
+    .{ "man_singer_light_skin_tone", "\u{1F468}\u{1F3FB}\u{200D}\u{1F3A4}" },
+    .{ "man_singer_medium-dark_skin_tone", "\u{1F468}\u{1F3FE}\u{200D}\u{1F3A4}" },
+    .{ "man_singer_medium-light_skin_tone", "\u{1F468}\u{1F3FC}\u{200D}\u{1F3A4}" },
+    .{ "man_singer_medium_skin_tone", "\u{1F468}\u{1F3FD}\u{200D}\u{1F3A4}" },
+    .{ "man_student", "\u{1F468}\u{200D}\u{1F393}" },
+    .{ "man_student_dark_skin_tone", "\u{1F468}\u{1F3FF}\u{200D}\u{1F393}" },
+    .{ "man_student_light_skin_tone", "\u{1F468}\u{1F3FB}\u{200D}\u{1F393}" },
+    .{ "man_student_medium-dark_skin_tone", "\u{1F468}\u{1F3FE}\u{200D}\u{1F393}" },
+    .{ "man_student_medium-light_skin_tone", "\u{1F468}\u{1F3FC}\u{200D}\u{1F393}" },
+    .{ "man_student_medium_skin_tone", "\u{1F468}\u{1F3FD}\u{200D}\u{1F393}" },
+    .{ "man_surfing", "\u{1F3C4}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_surfing_dark_skin_tone", "\u{1F3C4}\u{1F3FF}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_surfing_light_skin_tone", "\u{1F3C4}\u{1F3FB}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_surfing_medium-dark_skin_tone", "\u{1F3C4}\u{1F3FE}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_surfing_medium-light_skin_tone", "\u{1F3C4}\u{1F3FC}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_surfing_medium_skin_tone", "\u{1F3C4}\u{1F3FD}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_swimming", "\u{1F3CA}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_swimming_dark_skin_tone", "\u{1F3CA}\u{1F3FF}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_swimming_light_skin_tone", "\u{1F3CA}\u{1F3FB}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_swimming_medium-dark_skin_tone", "\u{1F3CA}\u{1F3FE}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_swimming_medium-light_skin_tone", "\u{1F3CA}\u{1F3FC}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_swimming_medium_skin_tone", "\u{1F3CA}\u{1F3FD}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_teacher", "\u{1F468}\u{200D}\u{1F3EB}" },
+    .{ "man_teacher_dark_skin_tone", "\u{1F468}\u{1F3FF}\u{200D}\u{1F3EB}" },
+    .{ "man_teacher_light_skin_tone", "\u{1F468}\u{1F3FB}\u{200D}\u{1F3EB}" },
+    .{ "man_teacher_medium-dark_skin_tone", "\u{1F468}\u{1F3FE}\u{200D}\u{1F3EB}" },
+    .{ "man_teacher_medium-light_skin_tone", "\u{1F468}\u{1F3FC}\u{200D}\u{1F3EB}" },
+    .{ "man_teacher_medium_skin_tone", "\u{1F468}\u{1F3FD}\u{200D}\u{1F3EB}" },
+    .{ "man_technologist", "\u{1F468}\u{200D}\u{1F4BB}" },
+    .{ "man_technologist_dark_skin_tone", "\u{1F468}\u{1F3FF}\u{200D}\u{1F4BB}" },
+    .{ "man_technologist_light_skin_tone", "\u{1F468}\u{1F3FB}\u{200D}\u{1F4BB}" },
+    .{ "man_technologist_medium-dark_skin_tone", "\u{1F468}\u{1F3FE}\u{200D}\u{1F4BB}" },
+    .{ "man_technologist_medium-light_skin_tone", "\u{1F468}\u{1F3FC}\u{200D}\u{1F4BB}" },
+    .{ "man_technologist_medium_skin_tone", "\u{1F468}\u{1F3FD}\u{200D}\u{1F4BB}" },
+    .{ "man_tipping_hand", "\u{1F481}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_tipping_hand_dark_skin_tone", "\u{1F481}\u{1F3FF}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_tipping_hand_light_skin_tone", "\u{1F481}\u{1F3FB}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_tipping_hand_medium-dark_skin_tone", "\u{1F481}\u{1F3FE}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_tipping_hand_medium-light_skin_tone", "\u{1F481}\u{1F3FC}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_tipping_hand_medium_skin_tone", "\u{1F481}\u{1F3FD}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_vampire", "\u{1F9DB}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_vampire_dark_skin_tone", "\u{1F9DB}\u{1F3FF}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_vampire_light_skin_tone", "\u{1F9DB}\u{1F3FB}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_vampire_medium-dark_skin_tone", "\u{1F9DB}\u{1F3FE}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_vampire_medium-light_skin_tone", "\u{1F9DB}\u{1F3FC}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_vampire_medium_skin_tone", "\u{1F9DB}\u{1F3FD}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_walking", "\u{1F6B6}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_walking_dark_skin_tone", "\u{1F6B6}\u{1F3FF}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_walking_light_skin_tone", "\u{1F6B6}\u{1F3FB}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_walking_medium-dark_skin_tone", "\u{1F6B6}\u{1F3FE}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_walking_medium-light_skin_tone", "\u{1F6B6}\u{1F3FC}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_walking_medium_skin_tone", "\u{1F6B6}\u{1F3FD}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_wearing_turban", "\u{1F473}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_wearing_turban_dark_skin_tone", "\u{1F473}\u{1F3FF}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_wearing_turban_light_skin_tone", "\u{1F473}\u{1F3FB}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_wearing_turban_medium-dark_skin_tone", "\u{1F473}\u{1F3FE}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_wearing_turban_medium-light_skin_tone", "\u{1F473}\u{1F3FC}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_wearing_turban_medium_skin_tone", "\u{1F473}\u{1F3FD}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "man_with_chinese_cap", "\u{1F472}" },
+    .{ "man_with_chinese_cap_dark_skin_tone", "\u{1F472}\u{1F3FF}" },
+    .{ "man_with_chinese_cap_light_skin_tone", "\u{1F472}\u{1F3FB}" },
+    .{ "man_with_chinese_cap_medium-dark_skin_tone", "\u{1F472}\u{1F3FE}" },
+    .{ "man_with_chinese_cap_medium-light_skin_tone", "\u{1F472}\u{1F3FC}" },
+    .{ "man_with_chinese_cap_medium_skin_tone", "\u{1F472}\u{1F3FD}" },
+    .{ "man_with_gua_pi_mao", "\u{1F472}" },
+    .{ "man_with_probing_cane", "\u{1F468}\u{200D}\u{1F9AF}" },
+    .{ "man_with_turban", "\u{1F473}" },
+    .{ "man_zombie", "\u{1F9DF}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "mango", "\u{1F96D}" },
+    .{ "mans_shoe", "\u{1F45E}" },
+    .{ "mantelpiece_clock", "\u{1F570}" },
+    .{ "manual_wheelchair", "\u{1F9BD}" },
+    .{ "map_of_japan", "\u{1F5FE}" },
+    .{ "maple_leaf", "\u{1F341}" },
+    .{ "marshall_islands", "\u{1F1F2}\u{1F1ED}" },
+    .{ "martial_arts_uniform", "\u{1F94B}" },
+    .{ "martinique", "\u{1F1F2}\u{1F1F6}" },
+    .{ "mask", "\u{1F637}" },
+    .{ "massage", "\u{1F486}" },
+    .{ "mate", "\u{1F9C9}" },
+    .{ "mauritania", "\u{1F1F2}\u{1F1F7}" },
+    .{ "mauritius", "\u{1F1F2}\u{1F1FA}" },
+    .{ "mayotte", "\u{1F1FE}\u{1F1F9}" },
+    .{ "meat_on_bone", "\u{1F356}" },
+    .{ "mechanical_arm", "\u{1F9BE}" },
+    .{ "mechanical_leg", "\u{1F9BF}" },
+    .{ "medical_symbol", "\u{2695}" },
+    .{ "medium_dark_skin_tone", "\u{1F3FE}" },
+    .{ "medium_light_skin_tone", "\u{1F3FC}" },
+    .{ "medium_skin_tone", "\u{1F3FD}" },
+    .{ "mega", "\u{1F4E3}" },
+    .{ "megaphone", "\u{1F4E3}" },
+    .{ "melon", "\u{1F348}" },
+    .{ "memo", "\u{1F4DD}" },
+    .{ "men_with_bunny_ears", "\u{1F46F}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "men_wrestling", "\u{1F93C}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "menorah", "\u{1F54E}" },
+    .{ "menorah_with_nine_branches", "\u{1F54E}" },
+    .{ "mens", "\u{1F6B9}" },
+    .{ "mermaid", "\u{1F9DC}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "mermaid_dark_skin_tone", "\u{1F9DC}\u{1F3FF}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "mermaid_light_skin_tone", "\u{1F9DC}\u{1F3FB}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "mermaid_medium-dark_skin_tone", "\u{1F9DC}\u{1F3FE}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "mermaid_medium-light_skin_tone", "\u{1F9DC}\u{1F3FC}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "mermaid_medium_skin_tone", "\u{1F9DC}\u{1F3FD}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "merman", "\u{1F9DC}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "merman_dark_skin_tone", "\u{1F9DC}\u{1F3FF}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "merman_light_skin_tone", "\u{1F9DC}\u{1F3FB}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "merman_medium-dark_skin_tone", "\u{1F9DC}\u{1F3FE}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "merman_medium-light_skin_tone", "\u{1F9DC}\u{1F3FC}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "merman_medium_skin_tone", "\u{1F9DC}\u{1F3FD}\u{200D}\u{2642}\u{FE0F}" },
+    .{ "merperson", "\u{1F9DC}" },
+    .{ "merperson_dark_skin_tone", "\u{1F9DC}\u{1F3FF}" },
+    .{ "merperson_light_skin_tone", "\u{1F9DC}\u{1F3FB}" },
+    .{ "merperson_medium-dark_skin_tone", "\u{1F9DC}\u{1F3FE}" },
+    .{ "merperson_medium-light_skin_tone", "\u{1F9DC}\u{1F3FC}" },
+    .{ "merperson_medium_skin_tone", "\u{1F9DC}\u{1F3FD}" },
+    .{ "metro", "\u{1F687}" },
+    .{ "mexico", "\u{1F1F2}\u{1F1FD}" },
+    .{ "microbe", "\u{1F9A0}" },
+    .{ "micronesia", "\u{1F1EB}\u{1F1F2}" },
+    .{ "microphone", "\u{1F3A4}" },
+    .{ "microscope", "\u{1F52C}" },
+    .{ "middle_finger", "\u{1F595}" },
+    .{ "middle_finger_dark_skin_tone", "\u{1F595}\u{1F3FF}" },
+    .{ "middle_finger_light_skin_tone", "\u{1F595}\u{1F3FB}" },
+    .{ "middle_finger_medium-dark_skin_tone", "\u{1F595}\u{1F3FE}" },
+    .{ "middle_finger_medium-light_skin_tone", "\u{1F595}\u{1F3FC}" },
+    .{ "middle_finger_medium_skin_tone", "\u{1F595}\u{1F3FD}" },
+    .{ "military_medal", "\u{1F396}" },
+    .{ "milky_way", "\u{1F30C}" },
+    .{ "minibus", "\u{1F690}" },
+    .{ "minidisc", "\u{1F4BD}" },
+    .{ "moai", "\u{1F5FF}" },
+    .{ "mobile_phone", "\u{1F4F1}" },
+    .{ "mobile_phone_off", "\u{1F4F4}" },
+    .{ "mobile_phone_with_arrow", "\u{1F4F2}" },
+    .{ "moldova", "\u{1F1F2}\u{1F1E9}" },
+    .{ "monaco", "\u{1F1F2}\u{1F1E8}" },
+    .{ "money-mouth_face", "\u{1F911}" },
+    .{ "money__mouth_face", "\u{1F911}" },
+    .{ "money_bag", "\u{1F4B0}" },
+    .{ "money_with_wings", "\u{1F4B8}" },
+    .{ "moneybag", "\u{1F4B0}" },
+    .{ "mongolia", "\u{1F1F2}\u{1F1F3}" },
+    .{ "monkey", "\u{1F412}" },
+    .{ "monkey_face", "\u{1F435}" },
+    .{ "monorail", "\u{1F69D}" },
+    .{ "montenegro", "\u{1F1F2}\u{1F1EA}" },
+    .{ "montserrat", "\u{1F1F2}\u{1F1F8}" },
+    .{ "moon", "\u{1F314}" },
+    .{ "moon_cake", "\u{1F96E}" },
+    .{ "moon_viewing_ceremony", "\u{1F391}" },
+    .{ "morocco", "\u{1F1F2}\u{1F1E6}" },
+    .{ "mortar_board", "\u{1F393}" },
+    .{ "mosque", "\u{1F54C}" },
+    .{ "mosquito", "\u{1F99F}" },
+    .{ "motor_boat", "\u{1F6E5}" },
+    .{ "motor_scooter", "\u{1F6F5}" },
+    .{ "motorcycle", "\u{1F3CD}" },
+    .{ "motorized_wheelchair", "\u{1F9BC}" },
+    .{ "motorway", "\u{1F6E3}" },
+    .{ "mount_fuji", "\u{1F5FB}" },
+    .{ "mountain", "\u{26F0}" },
+    .{ "mountain_bicyclist", "\u{1F6B5}" },
+    .{ "mountain_cableway", "\u{1F6A0}" },
+    .{ "mountain_railway", "\u{1F69E}" },
+    .{ "mouse", "\u{1F42D}" },
+    .{ "mouse2", "\u{1F401}" },
+    .{ "mouse_face", "\u{1F42D}" },
+    .{ "mouth", "\u{1F444}" },
+    .{ "movie_camera", "\u{1F3A5}" },
+    .{ "moyai", "\u{1F5FF}" },
+    .{ "mozambique", "\u{1F1F2}\u{1F1FF}" },
+    .{ "muscle", "\u{1F4AA}" },
+    .{ "mushroom", "\u{1F344}" },
+    .{ "musical_keyboard", "\u{1F3B9}" },
+    .{ "musical_note", "\u{1F3B5}" },
+    .{ "musical_notes", "\u{1F3B6}" },
+    .{ "musical_score", "\u{1F3BC}" },
+    .{ "mute", "\u{1F507}" },
+    .{ "muted_speaker", "\u{1F507}" },
+    .{ "nail_care", "\u{1F485}" },
+    .{ "nail_polish", "\u{1F485}" },
+    .{ "nail_polish_dark_skin_tone", "\u{1F485}\u{1F3FF}" },
+    .{ "nail_polish_light_skin_tone", "\u{1F485}\u{1F3FB}" },
+    .{ "nail_polish_medium-dark_skin_tone", "\u{1F485}\u{1F3FE}" },
+    .{ "nail_polish_medium-light_skin_tone", "\u{1F485}\u{1F3FC}" },
+    .{ "nail_polish_medium_skin_tone", "\u{1F485}\u{1F3FD}" },
+    .{ "name_badge", "\u{1F4DB}" },
+    .{ "namibia", "\u{1F1F3}\u{1F1E6}" },
+    .{ "national_park", "\u{1F3DE}" },
+    .{ "nauru", "\u{1F1F3}\u{1F1F7}" },
+    .{ "nauseated_face", "\u{1F922}" },
+    .{ "nazar_amulet", "\u{1F9FF}" },
+    .{ "necktie", "\u{1F454}" },
+    .{ "negative_squared_cross_mark", "\u{274E}" },
+    .{ "nepal", "\u{1F1F3}\u{1F1F5}" },
+    .{ "nerd_face", "\u{1F913}" },
+    .{ "netherlands", "\u{1F1F3}\u{1F1F1}" },
+    .{ "neutral_face", "\u{1F610}" },
+    .{ "new", "\u{1F195}" },
+    .{ "new_button", "\u{1F195}" },
+    .{ "new_caledonia", "\u{1F1F3}\u{1F1E8}" },
+    .{ "new_moon", "\u{1F311}" },
+    .{ "new_moon_face", "\u{1F31A}" },
+    .{ "new_moon_with_face", "\u{1F31A}" },
+    .{ "new_zealand", "\u{1F1F3}\u{1F1FF}" },
+    .{ "newspaper", "\u{1F4F0}" },
+    .{ "next_track_button", "\u{23ED}" },
+    .{ "ng", "\u{1F196}" },
+    .{ "ng_button", "\u{1F196}" },
+    .{ "nicaragua", "\u{1F1F3}\u{1F1EE}" },
+    .{ "niger", "\u{1F1F3}\u{1F1EA}" },
+    .{ "nigeria", "\u{1F1F3}\u{1F1EC}" },
+    .{ "night_with_stars", "\u{1F303}" },
+    .{ "nine", "\u{39}\u{FE0F}\u{20E3}" },
+    .{ "nine-thirty", "\u{1F564}" },
+    .{ "niue", "\u{1F1F3}\u{1F1FA}" },
+    .{ "no_bell", "\u{1F515}" },
+    .{ "no_bicycles", "\u{1F6B3}" },
+    .{ "no_entry", "\u{26D4}" },
+    .{ "no_entry_sign", "\u{1F6AB}" },
+    .{ "no_good", "\u{1F645}" },
+    .{ "no_littering", "\u{1F6AF}" },
+    .{ "no_mobile_phones", "\u{1F4F5}" },
+    .{ "no_mouth", "\u{1F636}" },
+    .{ "no_one_under_eighteen", "\u{1F51E}" },
+    .{ "no_pedestrians", "\u{1F6B7}" },
+    .{ "no_smoking", "\u{1F6AD}" },
+    .{ "non-potable_water", "\u{1F6B1}" },
+    .{ "non__potable_water", "\u{1F6B1}" },
+    .{ "norfolk_island", "\u{1F1F3}\u{1F1EB}" },
+    .{ "north_korea", "\u{1F1F0}\u{1F1F5}" },
+    .{ "northern_mariana_islands", "\u{1F1F2}\u{1F1F5}" },
+    .{ "norway", "\u{1F1F3}\u{1F1F4}" },
+    .{ "nose", "\u{1F443}" },
+    .{ "nose_dark_skin_tone", "\u{1F443}\u{1F3FF}" },
+    .{ "nose_light_skin_tone", "\u{1F443}\u{1F3FB}" },
+    .{ "nose_medium-dark_skin_tone", "\u{1F443}\u{1F3FE}" },
+    .{ "nose_medium-light_skin_tone", "\u{1F443}\u{1F3FC}" },
+    .{ "nose_medium_skin_tone", "\u{1F443}\u{1F3FD}" },
+    .{ "notebook", "\u{1F4D3}" },
+    .{ "notebook_with_decorative_cover", "\u{1F4D4}" },
+    .{ "notes", "\u{1F3B6}" },
+    .{ "nut_and_bolt", "\u{1F529}" },
+    .{ "o", "\u{2B55}" },
+    .{ "o2", "\u{1F17E}" },
+    .{ "ocean", "\u{1F30A}" },
+    .{ "octopus", "\u{1F419}" },
+    .{ "oden", "\u{1F362}" },
+    .{ "office", "\u{1F3E2}" },
+    .{ "office_building", "\u{1F3E2}" },
+    .{ "ogre", "\u{1F479}" },
+    .{ "oil_drum", "\u{1F6E2}" },
+    .{ "ok", "\u{1F197}" },
+    .{ "ok_button", "\u{1F197}" },
+    .{ "ok_hand", "\u{1F44C}" },
+    .{ "ok_hand_dark_skin_tone", "\u{1F44C}\u{1F3FF}" },
+    .{ "ok_hand_light_skin_tone", "\u{1F44C}\u{1F3FB}" },
+    .{ "ok_hand_medium-dark_skin_tone", "\u{1F44C}\u{1F3FE}" },
+    .{ "ok_hand_medium-light_skin_tone", "\u{1F44C}\u{1F3FC}" },
+    .{ "ok_hand_medium_skin_tone", "\u{1F44C}\u{1F3FD}" },
+    .{ "ok_woman", "\u{1F646}" },
+    .{ "old_key", "\u{1F5DD}" },
+    .{ "old_man", "\u{1F474}" },
+    .{ "old_man_dark_skin_tone", "\u{1F474}\u{1F3FF}" },
+    .{ "old_man_light_skin_tone", "\u{1F474}\u{1F3FB}" },
+    .{ "old_man_medium-dark_skin_tone", "\u{1F474}\u{1F3FE}" },
+    .{ "old_man_medium-light_skin_tone", "\u{1F474}\u{1F3FC}" },
+    .{ "old_man_medium_skin_tone", "\u{1F474}\u{1F3FD}" },
+    .{ "old_woman", "\u{1F475}" },
+    .{ "old_woman_dark_skin_tone", "\u{1F475}\u{1F3FF}" },
+    .{ "old_woman_light_skin_tone", "\u{1F475}\u{1F3FB}" },
+    .{ "old_woman_medium-dark_skin_tone", "\u{1F475}\u{1F3FE}" },
+    .{ "old_woman_medium-light_skin_tone", "\u{1F475}\u{1F3FC}" },
+    .{ "old_woman_medium_skin_tone", "\u{1F475}\u{1F3FD}" },
+    .{ "older_adult", "\u{1F9D3}" },
+    .{ "older_adult_dark_skin_tone", "\u{1F9D3}\u{1F3FF}" },
+    .{ "older_adult_light_skin_tone", "\u{1F9D3}\u{1F3FB}" },
+    .{ "older_adult_medium-dark_skin_tone", "\u{1F9D3}\u{1F3FE}" },
+    .{ "older_adult_medium-light_skin_tone", "\u{1F9D3}\u{1F3FC}" },
+    .{ "older_adult_medium_skin_tone", "\u{1F9D3}\u{1F3FD}" },
+    .{ "older_man", "\u{1F474}" },
+    .{ "older_woman", "\u{1F475}" },
+    .{ "om", "\u{1F549}" },
+    .{ "om_symbol", "\u{1F549}" },
+    .{ "oman", "\u{1F1F4}\u{1F1F2}" },
+    .{ "on", "\u{1F51B}" },
+    .{ "oncoming_automobile", "\u{1F698}" },
+    .{ "oncoming_bus", "\u{1F68D}" },
+    .{ "oncoming_fist", "\u{1F44A}" },
+    .{ "oncoming_fist_dark_skin_tone", "\u{1F44A}\u{1F3FF}" },
+    .{ "oncoming_fist_light_skin_tone", "\u{1F44A}\u{1F3FB}" },
+    .{ "oncoming_fist_medium-dark_skin_tone", "\u{1F44A}\u{1F3FE}" },
+    .{ "oncoming_fist_medium-light_skin_tone", "\u{1F44A}\u{1F3FC}" },
+    .{ "oncoming_fist_medium_skin_tone", "\u{1F44A}\u{1F3FD}" },
+    .{ "oncoming_police_car", "\u{1F694}" },
+    .{ "oncoming_taxi", "\u{1F696}" },
+    .{ "one", "\u{31}\u{FE0F}\u{20E3}" },
+    .{ "one-piece_swimsuit", "\u{1FA71}" },
+    .{ "one-thirty", "\u{1F55C}" },
+    .{ "onion", "\u{1F9C5}" },
+    .{ "open_book", "\u{1F4D6}" },
+    .{ "open_file_folder", "\u{1F4C2}" },
+    .{ "open_hands", "\u{1F450}" },
+    .{ "open_hands_dark_skin_tone", "\u{1F450}\u{1F3FF}" },
+    .{ "open_hands_light_skin_tone", "\u{1F450}\u{1F3FB}" },
+    .{ "open_hands_medium-dark_skin_tone", "\u{1F450}\u{1F3FE}" },
+    .{ "open_hands_medium-light_skin_tone", "\u{1F450}\u{1F3FC}" },
+    .{ "open_hands_medium_skin_tone", "\u{1F450}\u{1F3FD}" },
+    .{ "open_mailbox_with_lowered_flag", "\u{1F4ED}" },
+    .{ "open_mailbox_with_raised_flag", "\u{1F4EC}" },
+    .{ "open_mouth", "\u{1F62E}" },
+    .{ "ophiuchus", "\u{26CE}" },
+    .{ "optical_disk", "\u{1F4BF}" },
+    .{ "orange_book", "\u{1F4D9}" },
+    .{ "orange_circle", "\u{1F7E0}" },
+    .{ "orange_heart", "\u{1F9E1}" },
+    .{ "orange_square", "\u{1F7E7}" },
+    .{ "orangutan", "\u{1F9A7}" },
+    .{ "orthodox_cross", "\u{2626}" },
+    .{ "otter", "\u{1F9A6}" },
+    .{ "outbox_tray", "\u{1F4E4}" },
+    .{ "owl", "\u{1F989}" },
+    .{ "ox", "\u{1F402}" },
+    .{ "oyster", "\u{1F9AA}" },
+    .{ "p_button", "\u{1F17F}" },
+    .{ "package", "\u{1F4E6}" },
+    .{ "page_facing_up", "\u{1F4C4}" },
+    .{ "page_with_curl", "\u{1F4C3}" },
+    .{ "pager", "\u{1F4DF}" },
+    .{ "paintbrush", "\u{1F58C}" },
+    .{ "pakistan", "\u{1F1F5}\u{1F1F0}" },
+    .{ "palau", "\u{1F1F5}\u{1F1FC}" },
+    .{ "palestinian_territories", "\u{1F1F5}\u{1F1F8}" },
+    .{ "palm_tree", "\u{1F334}" },
+    .{ "palms_up_together", "\u{1F932}" },
+    .{ "palms_up_together_dark_skin_tone", "\u{1F932}\u{1F3FF}" },
+    .{ "palms_up_together_light_skin_tone", "\u{1F932}\u{1F3FB}" },
+    .{ "palms_up_together_medium-dark_skin_tone", "\u{1F932}\u{1F3FE}" },
+    .{ "palms_up_together_medium-light_skin_tone", "\u{1F932}\u{1F3FC}" },
+    .{ "palms_up_together_medium_skin_tone", "\u{1F932}\u{1F3FD}" },
+    .{ "panama", "\u{1F1F5}\u{1F1E6}" },
+    .{ "pancakes", "\u{1F95E}" },
+    .{ "panda_face", "\u{1F43C}" },
+    .{ "paperclip", "\u{1F4CE}" },
+    .{ "papua_new_guinea", "\u{1F1F5}\u{1F1EC}" },
+    .{ "paraguay", "\u{1F1F5}\u{1F1FE}" },
+    .{ "parking", "\u{1F17F}" },
+    .{ "parrot", "\u{1F99C}" },
+    .{ "part_alternation_mark", "\u{303D}" },
+    .{ "partly_sunny", "\u{26C5}" },
+    .{ "party_popper", "\u{1F389}" },
+    .{ "partying_face", "\u{1F973}" },
+    .{ "passenger_ship", "\u{1F6F3}" },
+    .{ "passport_control", "\u{1F6C2}" },
+    .{ "pause_button", "\u{23F8}" },
+    .{ "paw_prints", "\u{1F43E}" },
+    .{ "peace_symbol", "\u{262E}" },
+    .{ "peach", "\u{1F351}" },
+    .{ "peacock", "\u{1F99A}" },
+    .{ "peanuts", "\u{1F95C}" },
+    .{ "pear", "\u{1F350}" },
+    .{ "pen", "\u{1F58A}" },
+    .{ "pencil", "\u{1F4DD}" },
+    .{ "pencil2", "\u{270F}" },
+    .{ "penguin", "\u{1F427}" },
+    .{ "pensive", "\u{1F614}" },
+    .{ "pensive_face", "\u{1F614}" },
+    .{ "people_holding_hands", "\u{1F9D1}\u{200D}\u{1F91D}\u{200D}\u{1F9D1}" },
+    .{ "people_with_bunny_ears", "\u{1F46F}" },
+    .{ "people_wrestling", "\u{1F93C}" },
+    .{ "performing_arts", "\u{1F3AD}" },
+    .{ "persevere", "\u{1F623}" },
+    .{ "persevering_face", "\u{1F623}" },
+    .{ "person_biking", "\u{1F6B4}" },
+    .{ "person_biking_dark_skin_tone", "\u{1F6B4}\u{1F3FF}" },
+    .{ "person_biking_light_skin_tone", "\u{1F6B4}\u{1F3FB}" },
+    .{ "person_biking_medium-dark_skin_tone", "\u{1F6B4}\u{1F3FE}" },
+    .{ "person_biking_medium-light_skin_tone", "\u{1F6B4}\u{1F3FC}" },
+    .{ "person_biking_medium_skin_tone", "\u{1F6B4}\u{1F3FD}" },
+    .{ "person_bouncing_ball", "\u{26F9}" },
+    .{ "person_bouncing_ball_dark_skin_tone", "\u{26F9}\u{1F3FF}" },
+    .{ "person_bouncing_ball_light_skin_tone", "\u{26F9}\u{1F3FB}" },
+    .{ "person_bouncing_ball_medium-dark_skin_tone", "\u{26F9}\u{1F3FE}" },
+    .{ "person_bouncing_ball_medium-light_skin_tone", "\u{26F9}\u{1F3FC}" },
+    .{ "person_bouncing_ball_medium_skin_tone", "\u{26F9}\u{1F3FD}" },
+    .{ "person_bowing", "\u{1F647}" },
+    .{ "person_bowing_dark_skin_tone", "\u{1F647}\u{1F3FF}" },
+    .{ "person_bowing_light_skin_tone", "\u{1F647}\u{1F3FB}" },
+    .{ "person_bowing_medium-dark_skin_tone", "\u{1F647}\u{1F3FE}" },
+    .{ "person_bowing_medium-light_skin_tone", "\u{1F647}\u{1F3FC}" },
+    .{ "person_bowing_medium_skin_tone", "\u{1F647}\u{1F3FD}" },
+    .{ "person_cartwheeling", "\u{1F938}" },
+    .{ "person_cartwheeling_dark_skin_tone", "\u{1F938}\u{1F3FF}" },
+    .{ "person_cartwheeling_light_skin_tone", "\u{1F938}\u{1F3FB}" },
+    .{ "person_cartwheeling_medium-dark_skin_tone", "\u{1F938}\u{1F3FE}" },
+    .{ "person_cartwheeling_medium-light_skin_tone", "\u{1F938}\u{1F3FC}" },
+    .{ "person_cartwheeling_medium_skin_tone", "\u{1F938}\u{1F3FD}" },
+    .{ "person_climbing", "\u{1F9D7}" },
+    .{ "person_climbing_dark_skin_tone", "\u{1F9D7}\u{1F3FF}" },
+    .{ "person_climbing_light_skin_tone", "\u{1F9D7}\u{1F3FB}" },
+    .{ "person_climbing_medium-dark_skin_tone", "\u{1F9D7}\u{1F3FE}" },
+    .{ "person_climbing_medium-light_skin_tone", "\u{1F9D7}\u{1F3FC}" },
+    .{ "person_climbing_medium_skin_tone", "\u{1F9D7}\u{1F3FD}" },
+    .{ "person_facepalming", "\u{1F926}" },
+    .{ "person_facepalming_dark_skin_tone", "\u{1F926}\u{1F3FF}" },
+    .{ "person_facepalming_light_skin_tone", "\u{1F926}\u{1F3FB}" },
+    .{ "person_facepalming_medium-dark_skin_tone", "\u{1F926}\u{1F3FE}" },
+    .{ "person_facepalming_medium-light_skin_tone", "\u{1F926}\u{1F3FC}" },
+    .{ "person_facepalming_medium_skin_tone", "\u{1F926}\u{1F3FD}" },
+    .{ "person_fencing", "\u{1F93A}" },
+    .{ "person_frowning", "\u{1F64D}" },
+    .{ "person_frowning_dark_skin_tone", "\u{1F64D}\u{1F3FF}" },
+    .{ "person_frowning_light_skin_tone", "\u{1F64D}\u{1F3FB}" },
+    .{ "person_frowning_medium-dark_skin_tone", "\u{1F64D}\u{1F3FE}" },
+    .{ "person_frowning_medium-light_skin_tone", "\u{1F64D}\u{1F3FC}" },
+    .{ "person_frowning_medium_skin_tone", "\u{1F64D}\u{1F3FD}" },
+    .{ "person_gesturing_no", "\u{1F645}" },
+    .{ "person_gesturing_no_dark_skin_tone", "\u{1F645}\u{1F3FF}" },
+    .{ "person_gesturing_no_light_skin_tone", "\u{1F645}\u{1F3FB}" },
+    .{ "person_gesturing_no_medium-dark_skin_tone", "\u{1F645}\u{1F3FE}" },
+    .{ "person_gesturing_no_medium-light_skin_tone", "\u{1F645}\u{1F3FC}" },
+    .{ "person_gesturing_no_medium_skin_tone", "\u{1F645}\u{1F3FD}" },
+    .{ "person_gesturing_ok", "\u{1F646}" },
+    .{ "person_gesturing_ok_dark_skin_tone", "\u{1F646}\u{1F3FF}" },
+    .{ "person_gesturing_ok_light_skin_tone", "\u{1F646}\u{1F3FB}" },
+    .{ "person_gesturing_ok_medium-dark_skin_tone", "\u{1F646}\u{1F3FE}" },
+    .{ "person_gesturing_ok_medium-light_skin_tone", "\u{1F646}\u{1F3FC}" },
+    .{ "person_gesturing_ok_medium_skin_tone", "\u{1F646}\u{1F3FD}" },
+    .{ "person_getting_haircut", "\u{1F487}" },
+    .{ "person_getting_haircut_dark_skin_tone", "\u{1F487}\u{1F3FF}" },
+    .{ "person_getting_haircut_light_skin_tone", "\u{1F487}\u{1F3FB}" },
+    .{ "person_getting_haircut_medium-dark_skin_tone", "\u{1F487}\u{1F3FE}" },
+    .{ "person_getting_haircut_medium-light_skin_tone", "\u{1F487}\u{1F3FC}" },
+    .{ "person_getting_haircut_medium_skin_tone", "\u{1F487}\u{1F3FD}" },
+    .{ "person_getting_massage", "\u{1F486}" },
+    .{ "person_getting_massage_dark_skin_tone", "\u{1F486}\u{1F3FF}" },
+    .{ "person_getting_massage_light_skin_tone", "\u{1F486}\u{1F3FB}" },
+    .{ "person_getting_massage_medium-dark_skin_tone", "\u{1F486}\u{1F3FE}" },
+    .{ "person_getting_massage_medium-light_skin_tone", "\u{1F486}\u{1F3FC}" },
+    .{ "person_getting_massage_medium_skin_tone", "\u{1F486}\u{1F3FD}" },
+    .{ "person_golfing", "\u{1F3CC}" },
+    .{ "person_golfing_dark_skin_tone", "\u{1F3CC}\u{1F3FF}" },
+    .{ "person_golfing_light_skin_tone", "\u{1F3CC}\u{1F3FB}" },
+    .{ "person_golfing_medium-dark_skin_tone", "\u{1F3CC}\u{1F3FE}" },
+    .{ "person_golfing_medium-light_skin_tone", "\u{1F3CC}\u{1F3FC}" },
+    .{ "person_golfing_medium_skin_tone", "\u{1F3CC}\u{1F3FD}" },
+    .{ "person_in_bed", "\u{1F6CC}" },
+    .{ "person_in_bed_dark_skin_tone", "\u{1F6CC}\u{1F3FF}" },
+    .{ "person_in_bed_light_skin_tone", "\u{1F6CC}\u{1F3FB}" },
+    .{ "person_in_bed_medium-dark_skin_tone", "\u{1F6CC}\u{1F3FE}" },
+    .{ "person_in_bed_medium-light_skin_tone", "\u{1F6CC}\u{1F3FC}" },
+    .{ "person_in_bed_medium_skin_tone", "\u{1F6CC}\u{1F3FD}" },
+    .{ "person_in_lotus_position", "\u{1F9D8}" },
+    .{ "person_in_lotus_position_dark_skin_tone", "\u{1F9D8}\u{1F3FF}" },
+    .{ "person_in_lotus_position_light_skin_tone", "\u{1F9D8}\u{1F3FB}" },
+    .{ "person_in_lotus_position_medium-dark_skin_tone", "\u{1F9D8}\u{1F3FE}" },
+    .{ "person_in_lotus_position_medium-light_skin_tone", "\u{1F9D8}\u{1F3FC}" },
+    .{ "person_in_lotus_position_medium_skin_tone", "\u{1F9D8}\u{1F3FD}" },
+    .{ "person_in_steamy_room", "\u{1F9D6}" },
+    .{ "person_in_steamy_room_dark_skin_tone", "\u{1F9D6}\u{1F3FF}" },
+    .{ "person_in_steamy_room_light_skin_tone", "\u{1F9D6}\u{1F3FB}" },
+    .{ "person_in_steamy_room_medium-dark_skin_tone", "\u{1F9D6}\u{1F3FE}" },
+    .{ "person_in_steamy_room_medium-light_skin_tone", "\u{1F9D6}\u{1F3FC}" },
+    .{ "person_in_steamy_room_medium_skin_tone", "\u{1F9D6}\u{1F3FD}" },
+    .{ "person_juggling", "\u{1F939}" },
+    .{ "person_juggling_dark_skin_tone", "\u{1F939}\u{1F3FF}" },
+    .{ "person_juggling_light_skin_tone", "\u{1F939}\u{1F3FB}" },
+    .{ "person_juggling_medium-dark_skin_tone", "\u{1F939}\u{1F3FE}" },
+    .{ "person_juggling_medium-light_skin_tone", "\u{1F939}\u{1F3FC}" },
+    .{ "person_juggling_medium_skin_tone", "\u{1F939}\u{1F3FD}" },
+    .{ "person_kneeling", "\u{1F9CE}" },
+    .{ "person_lifting_weights", "\u{1F3CB}" },
+    .{ "person_lifting_weights_dark_skin_tone", "\u{1F3CB}\u{1F3FF}" },
+    .{ "person_lifting_weights_light_skin_tone", "\u{1F3CB}\u{1F3FB}" },
+    .{ "person_lifting_weights_medium-dark_skin_tone", "\u{1F3CB}\u{1F3FE}" },
+    .{ "person_lifting_weights_medium-light_skin_tone", "\u{1F3CB}\u{1F3FC}" },
+    .{ "person_lifting_weights_medium_skin_tone", "\u{1F3CB}\u{1F3FD}" },
+    .{ "person_mountain_biking", "\u{1F6B5}" },
+    .{ "person_mountain_biking_dark_skin_tone", "\u{1F6B5}\u{1F3FF}" },
+    .{ "person_mountain_biking_light_skin_tone", "\u{1F6B5}\u{1F3FB}" },
+    .{ "person_mountain_biking_medium-dark_skin_tone", "\u{1F6B5}\u{1F3FE}" },
+    .{ "person_mountain_biking_medium-light_skin_tone", "\u{1F6B5}\u{1F3FC}" },
+    .{ "person_mountain_biking_medium_skin_tone", "\u{1F6B5}\u{1F3FD}" },
+    .{ "person_playing_handball", "\u{1F93E}" },
+    .{ "person_playing_handball_dark_skin_tone", "\u{1F93E}\u{1F3FF}" },
+    .{ "person_playing_handball_light_skin_tone", "\u{1F93E}\u{1F3FB}" },
+    .{ "person_playing_handball_medium-dark_skin_tone", "\u{1F93E}\u{1F3FE}" },
+    .{ "person_playing_handball_medium-light_skin_tone", "\u{1F93E}\u{1F3FC}" },
+    .{ "person_playing_handball_medium_skin_tone", "\u{1F93E}\u{1F3FD}" },
+    .{ "person_playing_water_polo", "\u{1F93D}" },
+    .{ "person_playing_water_polo_dark_skin_tone", "\u{1F93D}\u{1F3FF}" },
+    .{ "person_playing_water_polo_light_skin_tone", "\u{1F93D}\u{1F3FB}" },
+    .{ "person_playing_water_polo_medium-dark_skin_tone", "\u{1F93D}\u{1F3FE}" },
+    .{ "person_playing_water_polo_medium-light_skin_tone", "\u{1F93D}\u{1F3FC}" },
+    .{ "person_playing_water_polo_medium_skin_tone", "\u{1F93D}\u{1F3FD}" },
+    .{ "person_pouting", "\u{1F64E}" },
+    .{ "person_pouting_dark_skin_tone", "\u{1F64E}\u{1F3FF}" },
+    .{ "person_pouting_light_skin_tone", "\u{1F64E}\u{1F3FB}" },
+    .{ "person_pouting_medium-dark_skin_tone", "\u{1F64E}\u{1F3FE}" },
+    .{ "person_pouting_medium-light_skin_tone", "\u{1F64E}\u{1F3FC}" },
+    .{ "person_pouting_medium_skin_tone", "\u{1F64E}\u{1F3FD}" },
+    .{ "person_raising_hand", "\u{1F64B}" },
+    .{ "person_raising_hand_dark_skin_tone", "\u{1F64B}\u{1F3FF}" },
+    .{ "person_raising_hand_light_skin_tone", "\u{1F64B}\u{1F3FB}" },
+    .{ "person_raising_hand_medium-dark_skin_tone", "\u{1F64B}\u{1F3FE}" },
+    .{ "person_raising_hand_medium-light_skin_tone", "\u{1F64B}\u{1F3FC}" },
+    .{ "person_raising_hand_medium_skin_tone", "\u{1F64B}\u{1F3FD}" },
+    .{ "person_rowing_boat", "\u{1F6A3}" },
+    .{ "person_rowing_boat_dark_skin_tone", "\u{1F6A3}\u{1F3FF}" },
+    .{ "person_rowing_boat_light_skin_tone", "\u{1F6A3}\u{1F3FB}" },
+    .{ "person_rowing_boat_medium-dark_skin_tone", "\u{1F6A3}\u{1F3FE}" },
+    .{ "person_rowing_boat_medium-light_skin_tone", "\u{1F6A3}\u{1F3FC}" },
+    .{ "person_rowing_boat_medium_skin_tone", "\u{1F6A3}\u{1F3FD}" },
+    .{ "person_running", "\u{1F3C3}" },
+    .{ "person_running_dark_skin_tone", "\u{1F3C3}\u{1F3FF}" },
+    .{ "person_running_light_skin_tone", "\u{1F3C3}\u{1F3FB}" },
+    .{ "person_running_medium-dark_skin_tone", "\u{1F3C3}\u{1F3FE}" },
+    .{ "person_running_medium-light_skin_tone", "\u{1F3C3}\u{1F3FC}" },
+    .{ "person_running_medium_skin_tone", "\u{1F3C3}\u{1F3FD}" },
+    .{ "person_shrugging", "\u{1F937}" },
+    .{ "person_shrugging_dark_skin_tone", "\u{1F937}\u{1F3FF}" },
+    .{ "person_shrugging_light_skin_tone", "\u{1F937}\u{1F3FB}" },
+    .{ "person_shrugging_medium-dark_skin_tone", "\u{1F937}\u{1F3FE}" },
+    .{ "person_shrugging_medium-light_skin_tone", "\u{1F937}\u{1F3FC}" },
+    .{ "person_shrugging_medium_skin_tone", "\u{1F937}\u{1F3FD}" },
+    .{ "person_standing", "\u{1F9CD}" },
+    .{ "person_surfing", "\u{1F3C4}" },
+    .{ "person_surfing_dark_skin_tone", "\u{1F3C4}\u{1F3FF}" },
+    .{ "person_surfing_light_skin_tone", "\u{1F3C4}\u{1F3FB}" },
+    .{ "person_surfing_medium-dark_skin_tone", "\u{1F3C4}\u{1F3FE}" },
+    .{ "person_surfing_medium-light_skin_tone", "\u{1F3C4}\u{1F3FC}" },
+    .{ "person_surfing_medium_skin_tone", "\u{1F3C4}\u{1F3FD}" },
+    .{ "person_swimming", "\u{1F3CA}" },
+    .{ "person_swimming_dark_skin_tone", "\u{1F3CA}\u{1F3FF}" },
+    .{ "person_swimming_light_skin_tone", "\u{1F3CA}\u{1F3FB}" },
+    .{ "person_swimming_medium-dark_skin_tone", "\u{1F3CA}\u{1F3FE}" },
+    .{ "person_swimming_medium-light_skin_tone", "\u{1F3CA}\u{1F3FC}" },
+    .{ "person_swimming_medium_skin_tone", "\u{1F3CA}\u{1F3FD}" },
+    .{ "person_taking_bath", "\u{1F6C0}" },
+    .{ "person_taking_bath_dark_skin_tone", "\u{1F6C0}\u{1F3FF}" },
+    .{ "person_taking_bath_light_skin_tone", "\u{1F6C0}\u{1F3FB}" },
+    .{ "person_taking_bath_medium-dark_skin_tone", "\u{1F6C0}\u{1F3FE}" },
+    .{ "person_taking_bath_medium-light_skin_tone", "\u{1F6C0}\u{1F3FC}" },
+    .{ "person_taking_bath_medium_skin_tone", "\u{1F6C0}\u{1F3FD}" },
+    .{ "person_tipping_hand", "\u{1F481}" },
+    .{ "person_tipping_hand_dark_skin_tone", "\u{1F481}\u{1F3FF}" },
+    .{ "person_tipping_hand_light_skin_tone", "\u{1F481}\u{1F3FB}" },
+    .{ "person_tipping_hand_medium-dark_skin_tone", "\u{1F481}\u{1F3FE}" },
+    .{ "person_tipping_hand_medium-light_skin_tone", "\u{1F481}\u{1F3FC}" },
+    .{ "person_tipping_hand_medium_skin_tone", "\u{1F481}\u{1F3FD}" },
+    .{ "person_walking", "\u{1F6B6}" },
+    .{ "person_walking_dark_skin_tone", "\u{1F6B6}\u{1F3FF}" },
+    .{ "person_walking_light_skin_tone", "\u{1F6B6}\u{1F3FB}" },
+    .{ "person_walking_medium-dark_skin_tone", "\u{1F6B6}\u{1F3FE}" },
+    .{ "person_walking_medium-light_skin_tone", "\u{1F6B6}\u{1F3FC}" },
+    .{ "person_walking_medium_skin_tone", "\u{1F6B6}\u{1F3FD}" },
+    .{ "person_wearing_turban", "\u{1F473}" },
+    .{ "person_wearing_turban_dark_skin_tone", "\u{1F473}\u{1F3FF}" },
+    .{ "person_wearing_turban_light_skin_tone", "\u{1F473}\u{1F3FB}" },
+    .{ "person_wearing_turban_medium-dark_skin_tone", "\u{1F473}\u{1F3FE}" },
+    .{ "person_wearing_turban_medium-light_skin_tone", "\u{1F473}\u{1F3FC}" },
+    .{ "person_wearing_turban_medium_skin_tone", "\u{1F473}\u{1F3FD}" },
+    .{ "person_with_ball", "\u{26F9}" },
+    .{ "person_with_blond_hair", "\u{1F471}" },
+    .{ "person_with_pouting_face", "\u{1F64E}" },
+    .{ "peru", "\u{1F1F5}\u{1F1EA}" },
+    .{ "petri_dish", "\u{1F9EB}" },
+    .{ "philippines", "\u{1F1F5}\u{1F1ED}" },
+    .{ "phone", "\u{260E}" },
+    .{ "pick", "\u{26CF}" },
+    .{ "pie", "\u{1F967}" },
+    .{ "pig", "\u{1F437}" },
+    .{ "pig2", "\u{1F416}" },
+    .{ "pig_face", "\u{1F437}" },
+    .{ "pig_nose", "\u{1F43D}" },
+    .{ "pile_of_poo", "\u{1F4A9}" },
+    .{ "pill", "\u{1F48A}" },
+    .{ "pinching_hand", "\u{1F90F}" },
+    .{ "pine_decoration", "\u{1F38D}" },
+    .{ "pineapple", "\u{1F34D}" },
+    .{ "ping_pong", "\u{1F3D3}" },
+    .{ "pirate_flag", "\u{1F3F4}\u{200D}\u{2620}\u{FE0F}" },
+    .{ "pisces", "\u{2653}" },
+    .{ "pistol", "\u{1F52B}" },
+    .{ "pitcairn_islands", "\u{1F1F5}\u{1F1F3}" },
+    .{ "pizza", "\u{1F355}" },
+    .{ "place_of_worship", "\u{1F6D0}" },
+    .{ "play_button", "\u{25B6}" },
+    .{ "play_or_pause_button", "\u{23EF}" },
+    .{ "pleading_face", "\u{1F97A}" },
+    .{ "point_down", "\u{1F447}" },
+    .{ "point_left", "\u{1F448}" },
+    .{ "point_right", "\u{1F449}" },
+    .{ "point_up", "\u{261D}" },
+    .{ "point_up_2", "\u{1F446}" },
+    .{ "poland", "\u{1F1F5}\u{1F1F1}" },
+    .{ "police_car", "\u{1F693}" },
+    .{ "police_car_light", "\u{1F6A8}" },
+    .{ "police_officer", "\u{1F46E}" },
+    .{ "police_officer_dark_skin_tone", "\u{1F46E}\u{1F3FF}" },
+    .{ "police_officer_light_skin_tone", "\u{1F46E}\u{1F3FB}" },
+    .{ "police_officer_medium-dark_skin_tone", "\u{1F46E}\u{1F3FE}" },
+    .{ "police_officer_medium-light_skin_tone", "\u{1F46E}\u{1F3FC}" },
+    .{ "police_officer_medium_skin_tone", "\u{1F46E}\u{1F3FD}" },
+    .{ "poodle", "\u{1F429}" },
+    .{ "pool_8_ball", "\u{1F3B1}" },
+    .{ "poop", "\u{1F4A9}" },
+    .{ "popcorn", "\u{1F37F}" },
+    .{ "portugal", "\u{1F1F5}\u{1F1F9}" },
+    .{ "post_office", "\u{1F3E3}" },
+    .{ "postal_horn", "\u{1F4EF}" },
+    .{ "postbox", "\u{1F4EE}" },
+    .{ "pot_of_food", "\u{1F372}" },
+    .{ "potable_water", "\u{1F6B0}" },
+    .{ "potato", "\u{1F954}" },
+    .{ "pouch", "\u{1F45D}" },
+    .{ "poultry_leg", "\u{1F357}" },
+    .{ "pound", "\u{1F4B7}" },
+    .{ "pound_banknote", "\u{1F4B7}" },
+    .{ "pouting_cat", "\u{1F63E}" },
+    .{ "pouting_cat_face", "\u{1F63E}" },
+    .{ "pouting_face", "\u{1F621}" },
+    .{ "pray", "\u{1F64F}" },
+    .{ "prayer_beads", "\u{1F4FF}" },
+    .{ "pregnant_woman", "\u{1F930}" },
+    .{ "pregnant_woman_dark_skin_tone", "\u{1F930}\u{1F3FF}" },
+    .{ "pregnant_woman_light_skin_tone", "\u{1F930}\u{1F3FB}" },
+    .{ "pregnant_woman_medium-dark_skin_tone", "\u{1F930}\u{1F3FE}" },
+    .{ "pregnant_woman_medium-light_skin_tone", "\u{1F930}\u{1F3FC}" },
+    .{ "pregnant_woman_medium_skin_tone", "\u{1F930}\u{1F3FD}" },
+    .{ "pretzel", "\u{1F968}" },
+    .{ "prince", "\u{1F934}" },
+    .{ "prince_dark_skin_tone", "\u{1F934}\u{1F3FF}" },
+    .{ "prince_light_skin_tone", "\u{1F934}\u{1F3FB}" },
+    .{ "prince_medium-dark_skin_tone", "\u{1F934}\u{1F3FE}" },
+    .{ "prince_medium-light_skin_tone", "\u{1F934}\u{1F3FC}" },
+    .{ "prince_medium_skin_tone", "\u{1F934}\u{1F3FD}" },
+    .{ "princess", "\u{1F478}" },
+    .{ "princess_dark_skin_tone", "\u{1F478}\u{1F3FF}" },
+    .{ "princess_light_skin_tone", "\u{1F478}\u{1F3FB}" },
+    .{ "princess_medium-dark_skin_tone", "\u{1F478}\u{1F3FE}" },
+    .{ "princess_medium-light_skin_tone", "\u{1F478}\u{1F3FC}" },
+    .{ "princess_medium_skin_tone", "\u{1F478}\u{1F3FD}" },
+    .{ "printer", "\u{1F5A8}" },
+    .{ "probing_cane", "\u{1F9AF}" },
+    .{ "prohibited", "\u{1F6AB}" },
+    .{ "puerto_rico", "\u{1F1F5}\u{1F1F7}" },
+    .{ "punch", "\u{1F44A}" },
+    .{ "purple_circle", "\u{1F7E3}" },
+    .{ "purple_heart", "\u{1F49C}" },
+    .{ "purple_square", "\u{1F7EA}" },
+    .{ "purse", "\u{1F45B}" },
+    .{ "pushpin", "\u{1F4CC}" },
+    .{ "put_litter_in_its_place", "\u{1F6AE}" },
+    .{ "qatar", "\u{1F1F6}\u{1F1E6}" },
+    .{ "question", "\u{2753}" },
+    .{ "question_mark", "\u{2753}" },
+    .{ "rabbit", "\u{1F430}" },
+    .{ "rabbit2", "\u{1F407}" },
+    .{ "rabbit_face", "\u{1F430}" },
+    .{ "raccoon", "\u{1F99D}" },
+    .{ "racehorse", "\u{1F40E}" },
+    .{ "racing_car", "\u{1F3CE}" },
+    .{ "racing_motorcycle", "\u{1F3CD}" },
+    .{ "radio", "\u{1F4FB}" },
+    .{ "radio_button", "\u{1F518}" },
+    .{ "radioactive", "\u{2622}" },
+    .{ "radioactive_sign", "\u{2622}" },
+    .{ "rage", "\u{1F621}" },
+    .{ "railway_car", "\u{1F683}" },
+    .{ "railway_track", "\u{1F6E4}" },
+    .{ "rainbow", "\u{1F308}" },
+    .{ "rainbow_flag", "\u{1F3F3}\u{FE0F}\u{200D}\u{1F308}" },
+    .{ "raised_back_of_hand", "\u{1F91A}" },
+    .{ "raised_back_of_hand_dark_skin_tone", "\u{1F91A}\u{1F3FF}" },
+    .{ "raised_back_of_hand_light_skin_tone", "\u{1F91A}\u{1F3FB}" },
+    .{ "raised_back_of_hand_medium-dark_skin_tone", "\u{1F91A}\u{1F3FE}" },
+    .{ "raised_back_of_hand_medium-light_skin_tone", "\u{1F91A}\u{1F3FC}" },
+    .{ "raised_back_of_hand_medium_skin_tone", "\u{1F91A}\u{1F3FD}" },
+    .{ "raised_fist", "\u{270A}" },
+    .{ "raised_fist_dark_skin_tone", "\u{270A}\u{1F3FF}" },
+    .{ "raised_fist_light_skin_tone", "\u{270A}\u{1F3FB}" },
+    .{ "raised_fist_medium-dark_skin_tone", "\u{270A}\u{1F3FE}" },
+    .{ "raised_fist_medium-light_skin_tone", "\u{270A}\u{1F3FC}" },
+    .{ "raised_fist_medium_skin_tone", "\u{270A}\u{1F3FD}" },
+    .{ "raised_hand", "\u{270B}" },
+    .{ "raised_hand_dark_skin_tone", "\u{270B}\u{1F3FF}" },
+    .{ "raised_hand_light_skin_tone", "\u{270B}\u{1F3FB}" },
+    .{ "raised_hand_medium-dark_skin_tone", "\u{270B}\u{1F3FE}" },
+    .{ "raised_hand_medium-light_skin_tone", "\u{270B}\u{1F3FC}" },
+    .{ "raised_hand_medium_skin_tone", "\u{270B}\u{1F3FD}" },
+    .{ "raised_hand_with_fingers_splayed", "\u{1F590}" },
+    .{ "raised_hand_with_part_between_middle_and_ring_fingers", "\u{1F596}" },
+    .{ "raised_hands", "\u{1F64C}" },
+    .{ "raising_hand", "\u{1F64B}" },
+    .{ "raising_hands", "\u{1F64C}" },
+    .{ "raising_hands_dark_skin_tone", "\u{1F64C}\u{1F3FF}" },
+    .{ "raising_hands_light_skin_tone", "\u{1F64C}\u{1F3FB}" },
+    .{ "raising_hands_medium-dark_skin_tone", "\u{1F64C}\u{1F3FE}" },
+    .{ "raising_hands_medium-light_skin_tone", "\u{1F64C}\u{1F3FC}" },
+    .{ "raising_hands_medium_skin_tone", "\u{1F64C}\u{1F3FD}" },
+    .{ "ram", "\u{1F40F}" },
+    .{ "ramen", "\u{1F35C}" },
+    .{ "rat", "\u{1F400}" },
+    .{ "razor", "\u{1FA92}" },
+    .{ "receipt", "\u{1F9FE}" },
+    .{ "record_button", "\u{23FA}" },
+    .{ "recycle", "\u{267B}" },
+    .{ "recycling_symbol", "\u{267B}" },
+    .{ "red-haired_man", "\u{1F468}\u{200D}\u{1F9B0}" },
+    .{ "red-haired_woman", "\u{1F469}\u{200D}\u{1F9B0}" },
+    .{ "red_apple", "\u{1F34E}" },
+    .{ "red_car", "\u{1F697}" },
+    .{ "red_circle", "\u{1F534}" },
+    .{ "red_envelope", "\u{1F9E7}" },
+    .{ "red_hair", "\u{1F9B0}" },
+    .{ "red_heart", "\u{2764}" },
+    .{ "red_paper_lantern", "\u{1F3EE}" },
+    .{ "red_square", "\u{1F7E5}" },
+    .{ "red_triangle_pointed_down", "\u{1F53B}" },
+    .{ "red_triangle_pointed_up", "\u{1F53A}" },
+    .{ "regional_indicator_a", "\u{1F1E6}" },
+    .{ "regional_indicator_b", "\u{1F1E7}" },
+    .{ "regional_indicator_c", "\u{1F1E8}" },
+    .{ "regional_indicator_d", "\u{1F1E9}" },
+    .{ "regional_indicator_e", "\u{1F1EA}" },
+    .{ "regional_indicator_f", "\u{1F1EB}" },
+    .{ "regional_indicator_g", "\u{1F1EC}" },
+    .{ "regional_indicator_h", "\u{1F1ED}" },
+    .{ "regional_indicator_i", "\u{1F1EE}" },
+    .{ "regional_indicator_j", "\u{1F1EF}" },
+    .{ "regional_indicator_k", "\u{1F1F0}" },
+    .{ "regional_indicator_l", "\u{1F1F1}" },
+    .{ "regional_indicator_m", "\u{1F1F2}" },
+    .{ "regional_indicator_n", "\u{1F1F3}" },
+    .{ "regional_indicator_o", "\u{1F1F4}" },
+    .{ "regional_indicator_p", "\u{1F1F5}" },
+    .{ "regional_indicator_q", "\u{1F1F6}" },
+    .{ "regional_indicator_r", "\u{1F1F7}" },
+    .{ "regional_indicator_s", "\u{1F1F8}" },
+    .{ "regional_indicator_symbol_letter_a", "\u{1F1E6}" },
+    .{ "regional_indicator_symbol_letter_b", "\u{1F1E7}" },
+    .{ "regional_indicator_symbol_letter_c", "\u{1F1E8}" },
+    .{ "regional_indicator_symbol_letter_d", "\u{1F1E9}" },
+    .{ "regional_indicator_symbol_letter_e", "\u{1F1EA}" },
+    .{ "regional_indicator_symbol_letter_f", "\u{1F1EB}" },
+    .{ "regional_indicator_symbol_letter_g", "\u{1F1EC}" },
+    .{ "regional_indicator_symbol_letter_h", "\u{1F1ED}" },
+    .{ "regional_indicator_symbol_letter_i", "\u{1F1EE}" },
+    .{ "regional_indicator_symbol_letter_j", "\u{1F1EF}" },
+    .{ "regional_indicator_symbol_letter_k", "\u{1F1F0}" },
+    .{ "regional_indicator_symbol_letter_l", "\u{1F1F1}" },
+    .{ "regional_indicator_symbol_letter_m", "\u{1F1F2}" },
+    .{ "regional_indicator_symbol_letter_n", "\u{1F1F3}" },
+    .{ "regional_indicator_symbol_letter_o", "\u{1F1F4}" },
+    .{ "regional_indicator_symbol_letter_p", "\u{1F1F5}" },
+    .{ "regional_indicator_symbol_letter_q", "\u{1F1F6}" },
+    .{ "regional_indicator_symbol_letter_r", "\u{1F1F7}" },
+    .{ "regional_indicator_symbol_letter_s", "\u{1F1F8}" },
+    .{ "regional_indicator_symbol_letter_t", "\u{1F1F9}" },
+    .{ "regional_indicator_symbol_letter_u", "\u{1F1FA}" },
+    .{ "regional_indicator_symbol_letter_v", "\u{1F1FB}" },
+    .{ "regional_indicator_symbol_letter_w", "\u{1F1FC}" },
+    .{ "regional_indicator_symbol_letter_x", "\u{1F1FD}" },
+    .{ "regional_indicator_symbol_letter_y", "\u{1F1FE}" },
+    .{ "regional_indicator_symbol_letter_z", "\u{1F1FF}" },
+    .{ "regional_indicator_t", "\u{1F1F9}" },
+    .{ "regional_indicator_u", "\u{1F1FA}" },
+    .{ "regional_indicator_v", "\u{1F1FB}" },
+    .{ "regional_indicator_w", "\u{1F1FC}" },
+    .{ "regional_indicator_x", "\u{1F1FD}" },
+    .{ "regional_indicator_y", "\u{1F1FE}" },
+    .{ "regional_indicator_z", "\u{1F1FF}" },
+    .{ "registered", "\u{AE}" },
+    .{ "relaxed", "\u{263A}" },
+    .{ "relieved", "\u{1F60C}" },
+    .{ "relieved_face", "\u{1F60C}" },
+    .{ "reminder_ribbon", "\u{1F397}" },
+    .{ "repeat", "\u{1F501}" },
+    .{ "repeat_button", "\u{1F501}" },
+    .{ "repeat_one", "\u{1F502}" },
+    .{ "repeat_single_button", "\u{1F502}" },
+    .{ "restroom", "\u{1F6BB}" },
+    .{ "reverse_button", "\u{25C0}" },
+    .{ "reversed_hand_with_middle_finger_extended", "\u{1F595}" },
+    .{ "revolving_hearts", "\u{1F49E}" },
+    .{ "rewind", "\u{23EA}" },
+    .{ "rhinoceros", "\u{1F98F}" },
+    .{ "ribbon", "\u{1F380}" },
+    .{ "rice", "\u{1F35A}" },
+    .{ "rice_ball", "\u{1F359}" },
+    .{ "rice_cracker", "\u{1F358}" },
+    .{ "rice_scene", "\u{1F391}" },
+    .{ "right-facing_fist", "\u{1F91C}" },
+    .{ "right-facing_fist_dark_skin_tone", "\u{1F91C}\u{1F3FF}" },
+    .{ "right-facing_fist_light_skin_tone", "\u{1F91C}\u{1F3FB}" },
+    .{ "right-facing_fist_medium-dark_skin_tone", "\u{1F91C}\u{1F3FE}" },
+    .{ "right-facing_fist_medium-light_skin_tone", "\u{1F91C}\u{1F3FC}" },
+    .{ "right-facing_fist_medium_skin_tone", "\u{1F91C}\u{1F3FD}" },
+    .{ "right_anger_bubble", "\u{1F5EF}" },
+    .{ "right_arrow", "\u{27A1}" },
+    .{ "right_arrow_curving_down", "\u{2935}" },
+    .{ "right_arrow_curving_left", "\u{21A9}" },
+    .{ "right_arrow_curving_up", "\u{2934}" },
+    .{ "ring", "\u{1F48D}" },
+    .{ "ringed_planet", "\u{1FA90}" },
+    .{ "roasted_sweet_potato", "\u{1F360}" },
+    .{ "robot", "\u{1F916}" },
+    .{ "robot_face", "\u{1F916}" },
+    .{ "rocket", "\u{1F680}" },
+    .{ "roll_of_paper", "\u{1F9FB}" },
+    .{ "rolled-up_newspaper", "\u{1F5DE}" },
+    .{ "rolled__up_newspaper", "\u{1F5DE}" },
+    .{ "roller_coaster", "\u{1F3A2}" },
+    .{ "rolling_on_the_floor_laughing", "\u{1F923}" },
+    .{ "romania", "\u{1F1F7}\u{1F1F4}" },
+    .{ "rooster", "\u{1F413}" },
+    .{ "rose", "\u{1F339}" },
+    .{ "rosette", "\u{1F3F5}" },
+    .{ "rotating_light", "\u{1F6A8}" },
+    .{ "round_pushpin", "\u{1F4CD}" },
+    .{ "rowboat", "\u{1F6A3}" },
+    .{ "rugby_football", "\u{1F3C9}" },
+    .{ "runner", "\u{1F3C3}" },
+    .{ "running", "\u{1F3C3}" },
+    .{ "running_shirt", "\u{1F3BD}" },
+    .{ "running_shirt_with_sash", "\u{1F3BD}" },
+    .{ "running_shoe", "\u{1F45F}" },
+    .{ "russia", "\u{1F1F7}\u{1F1FA}" },
+    .{ "rwanda", "\u{1F1F7}\u{1F1FC}" },
+    .{ "sa", "\u{1F202}" },
+    .{ "sad_but_relieved_face", "\u{1F625}" },
+    .{ "safety_pin", "\u{1F9F7}" },
+    .{ "safety_vest", "\u{1F9BA}" },
+    .{ "sagittarius", "\u{2650}" },
+    .{ "sailboat", "\u{26F5}" },
+    .{ "sake", "\u{1F376}" },
+    .{ "salt", "\u{1F9C2}" },
+    .{ "samoa", "\u{1F1FC}\u{1F1F8}" },
+    .{ "san_marino", "\u{1F1F8}\u{1F1F2}" },
+    .{ "sandal", "\u{1F461}" },
+    .{ "sandwich", "\u{1F96A}" },
+    .{ "santa", "\u{1F385}" },
+    .{ "santa_claus", "\u{1F385}" },
+    .{ "santa_claus_dark_skin_tone", "\u{1F385}\u{1F3FF}" },
+    .{ "santa_claus_light_skin_tone", "\u{1F385}\u{1F3FB}" },
+    .{ "santa_claus_medium-dark_skin_tone", "\u{1F385}\u{1F3FE}" },
+    .{ "santa_claus_medium-light_skin_tone", "\u{1F385}\u{1F3FC}" },
+    .{ "santa_claus_medium_skin_tone", "\u{1F385}\u{1F3FD}" },
+    .{ "sari", "\u{1F97B}" },
+    .{ "satellite", "\u{1F4E1}" },
+    .{ "satellite_antenna", "\u{1F4E1}" },
+    .{ "satisfied", "\u{1F606}" },
+    .{ "saudi_arabia", "\u{1F1F8}\u{1F1E6}" },
+    .{ "sauropod", "\u{1F995}" },
+    .{ "saxophone", "\u{1F3B7}" },
+    .{ "scales", "\u{2696}" },
+    .{ "scarf", "\u{1F9E3}" },
+    .{ "school", "\u{1F3EB}" },
+    .{ "school_backpack", "\u{1F392}" },
+    .{ "school_satchel", "\u{1F392}" },
+    .{ "scissors", "\u{2702}" },
+    .{ "scorpio", "\u{264F}" },
+    .{ "scorpion", "\u{1F982}" },
+    .{ "scorpius", "\u{264F}" },
+    .{ "scotland", "\u{1F3F4}\u{E0067}\u{E0062}\u{E0073}\u{E0063}\u{E0074}\u{E007F}" },
+    .{ "scream", "\u{1F631}" },
+    .{ "scream_cat", "\u{1F640}" },
+    .{ "scroll", "\u{1F4DC}" },
+    .{ "seat", "\u{1F4BA}" },
+    .{ "secret", "\u{3299}" },
+    .{ "see-no-evil_monkey", "\u{1F648}" },
+    .{ "see_no_evil", "\u{1F648}" },
+    .{ "seedling", "\u{1F331}" },
+    .{ "selfie", "\u{1F933}" },
+    .{ "selfie_dark_skin_tone", "\u{1F933}\u{1F3FF}" },
+    .{ "selfie_light_skin_tone", "\u{1F933}\u{1F3FB}" },
+    .{ "selfie_medium-dark_skin_tone", "\u{1F933}\u{1F3FE}" },
+    .{ "selfie_medium-light_skin_tone", "\u{1F933}\u{1F3FC}" },
+    .{ "selfie_medium_skin_tone", "\u{1F933}\u{1F3FD}" },
+    .{ "senegal", "\u{1F1F8}\u{1F1F3}" },
+    .{ "serbia", "\u{1F1F7}\u{1F1F8}" },
+    .{ "service_dog", "\u{1F415}\u{200D}\u{1F9BA}" },
+    .{ "seven", "\u{37}\u{FE0F}\u{20E3}" },
+    .{ "seven-thirty", "\u{1F562}" },
+    .{ "seychelles", "\u{1F1F8}\u{1F1E8}" },
+    .{ "shallow_pan_of_food", "\u{1F958}" },
+    .{ "shamrock", "\u{2618}" },
+    .{ "shark", "\u{1F988}" },
+    .{ "shaved_ice", "\u{1F367}" },
+    .{ "sheaf_of_rice", "\u{1F33E}" },
+    .{ "sheep", "\u{1F411}" },
+    .{ "shell", "\u{1F41A}" },
+    .{ "shield", "\u{1F6E1}" },
+    .{ "shinto_shrine", "\u{26E9}" },
+    .{ "ship", "\u{1F6A2}" },
+    .{ "shirt", "\u{1F455}" },
+    .{ "shit", "\u{1F4A9}" },
+    .{ "shoe", "\u{1F45E}" },
+    .{ "shooting_star", "\u{1F320}" },
+    .{ "shopping_bags", "\u{1F6CD}" },
+    .{ "shopping_cart", "\u{1F6D2}" },
+    .{ "shortcake", "\u{1F370}" },
+    .{ "shorts", "\u{1FA73}" },
+    .{ "shower", "\u{1F6BF}" },
+    .{ "shrimp", "\u{1F990}" },
+    .{ "shuffle_tracks_button", "\u{1F500}" },
+    .{ "shushing_face", "\u{1F92B}" },
+    .{ "sierra_leone", "\u{1F1F8}\u{1F1F1}" },
+    .{ "sign_of_the_horns", "\u{1F918}" },
+    .{ "sign_of_the_horns_dark_skin_tone", "\u{1F918}\u{1F3FF}" },
+    .{ "sign_of_the_horns_light_skin_tone", "\u{1F918}\u{1F3FB}" },
+    .{ "sign_of_the_horns_medium-dark_skin_tone", "\u{1F918}\u{1F3FE}" },
+    .{ "sign_of_the_horns_medium-light_skin_tone", "\u{1F918}\u{1F3FC}" },
+    .{ "sign_of_the_horns_medium_skin_tone", "\u{1F918}\u{1F3FD}" },
+    .{ "signal_strength", "\u{1F4F6}" },
+    .{ "singapore", "\u{1F1F8}\u{1F1EC}" },
+    .{ "sint_maarten", "\u{1F1F8}\u{1F1FD}" },
+    .{ "six", "\u{36}\u{FE0F}\u{20E3}" },
+    .{ "six-thirty", "\u{1F561}" },
+    .{ "six_pointed_star", "\u{1F52F}" },
+    .{ "skateboard", "\u{1F6F9}" },
+    .{ "ski", "\u{1F3BF}" },
+    .{ "skier", "\u{26F7}" },
+    .{ "skis", "\u{1F3BF}" },
+    .{ "skull", "\u{1F480}" },
+    .{ "skull_and_crossbones", "\u{2620}" },
+    .{ "skunk", "\u{1F9A8}" },
+    .{ "sled", "\u{1F6F7}" },
+    .{ "sleeping", "\u{1F634}" },
+    .{ "sleeping_accommodation", "\u{1F6CC}" },
+    .{ "sleeping_face", "\u{1F634}" },
+    .{ "sleepy", "\u{1F62A}" },
+    .{ "sleepy_face", "\u{1F62A}" },
+    .{ "sleuth_or_spy", "\u{1F575}" },
+    .{ "slightly_frowning_face", "\u{1F641}" },
+    .{ "slightly_smiling_face", "\u{1F642}" },
+    .{ "slot_machine", "\u{1F3B0}" },
+    .{ "sloth", "\u{1F9A5}" },
+    .{ "slovakia", "\u{1F1F8}\u{1F1F0}" },
+    .{ "slovenia", "\u{1F1F8}\u{1F1EE}" },
+    .{ "small_airplane", "\u{1F6E9}" },
+    .{ "small_blue_diamond", "\u{1F539}" },
+    .{ "small_orange_diamond", "\u{1F538}" },
+    .{ "small_red_triangle", "\u{1F53A}" },
+    .{ "small_red_triangle_down", "\u{1F53B}" },
+    .{ "smile", "\u{1F604}" },
+    .{ "smile_cat", "\u{1F638}" },
+    .{ "smiley", "\u{1F603}" },
+    .{ "smiley_cat", "\u{1F63A}" },
+    .{ "smiling_cat_face_with_heart-eyes", "\u{1F63B}" },
+    .{ "smiling_face", "\u{263A}" },
+    .{ "smiling_face_with_3_hearts", "\u{1F970}" },
+    .{ "smiling_face_with_halo", "\u{1F607}" },
+    .{ "smiling_face_with_heart-eyes", "\u{1F60D}" },
+    .{ "smiling_face_with_horns", "\u{1F608}" },
+    .{ "smiling_face_with_smiling_eyes", "\u{1F60A}" },
+    .{ "smiling_face_with_sunglasses", "\u{1F60E}" },
+    .{ "smiling_imp", "\u{1F608}" },
+    .{ "smirk", "\u{1F60F}" },
+    .{ "smirk_cat", "\u{1F63C}" },
+    .{ "smirking_face", "\u{1F60F}" },
+    .{ "smoking", "\u{1F6AC}" },
+    .{ "snail", "\u{1F40C}" },
+    .{ "snake", "\u{1F40D}" },
+    .{ "sneezing_face", "\u{1F927}" },
+    .{ "snow-capped_mountain", "\u{1F3D4}" },
+    .{ "snow_capped_mountain", "\u{1F3D4}" },
+    .{ "snowboarder", "\u{1F3C2}" },
+    .{ "snowboarder_dark_skin_tone", "\u{1F3C2}\u{1F3FF}" },
+    .{ "snowboarder_light_skin_tone", "\u{1F3C2}\u{1F3FB}" },
+    .{ "snowboarder_medium-dark_skin_tone", "\u{1F3C2}\u{1F3FE}" },
+    .{ "snowboarder_medium-light_skin_tone", "\u{1F3C2}\u{1F3FC}" },
+    .{ "snowboarder_medium_skin_tone", "\u{1F3C2}\u{1F3FD}" },
+    .{ "snowflake", "\u{2744}" },
+    .{ "snowman", "\u{2603}" },
+    .{ "snowman_without_snow", "\u{26C4}" },
+    .{ "soap", "\u{1F9FC}" },
+    .{ "sob", "\u{1F62D}" },
+    .{ "soccer", "\u{26BD}" },
+    .{ "soccer_ball", "\u{26BD}" },
+    .{ "socks", "\u{1F9E6}" },
+    .{ "soft_ice_cream", "\u{1F366}" },
+    .{ "softball", "\u{1F94E}" },
+    .{ "solomon_islands", "\u{1F1F8}\u{1F1E7}" },
+    .{ "somalia", "\u{1F1F8}\u{1F1F4}" },
+    .{ "soon", "\u{1F51C}" },
+    .{ "soon_arrow", "\u{1F51C}" },
+    .{ "sos", "\u{1F198}" },
+    .{ "sos_button", "\u{1F198}" },
+    .{ "sound", "\u{1F509}" },
+    .{ "south_africa", "\u{1F1FF}\u{1F1E6}" },
+    .{ "south_korea", "\u{1F1F0}\u{1F1F7}" },
+    .{ "south_sudan", "\u{1F1F8}\u{1F1F8}" },
+    .{ "space_invader", "\u{1F47E}" },
+    .{ "spade_suit", "\u{2660}" },
+    .{ "spades", "\u{2660}" },
+    .{ "spaghetti", "\u{1F35D}" },
+    .{ "spain", "\u{1F1EA}\u{1F1F8}" },
+    .{ "sparkle", "\u{2747}" },
+    .{ "sparkler", "\u{1F387}" },
+    .{ "sparkles", "\u{2728}" },
+    .{ "sparkling_heart", "\u{1F496}" },
+    .{ "speak-no-evil_monkey", "\u{1F64A}" },
+    .{ "speak_no_evil", "\u{1F64A}" },
+    .{ "speaker", "\u{1F508}" },
+    .{ "speaker_high_volume", "\u{1F50A}" },
+    .{ "speaker_low_volume", "\u{1F508}" },
+    .{ "speaker_medium_volume", "\u{1F509}" },
+    .{ "speaking_head", "\u{1F5E3}" },
+    .{ "speaking_head_in_silhouette", "\u{1F5E3}" },
+    .{ "speech_balloon", "\u{1F4AC}" },
+    .{ "speedboat", "\u{1F6A4}" },
+    .{ "spider", "\u{1F577}" },
+    .{ "spider_web", "\u{1F578}" },
+    .{ "spiral_calendar", "\u{1F5D3}" },
+    .{ "spiral_calendar_pad", "\u{1F5D3}" },
+    .{ "spiral_note_pad", "\u{1F5D2}" },
+    .{ "spiral_notepad", "\u{1F5D2}" },
+    .{ "spiral_shell", "\u{1F41A}" },
+    .{ "sponge", "\u{1F9FD}" },
+    .{ "spoon", "\u{1F944}" },
+    .{ "sport_utility_vehicle", "\u{1F699}" },
+    .{ "sports_medal", "\u{1F3C5}" },
+    .{ "spouting_whale", "\u{1F433}" },
+    .{ "squid", "\u{1F991}" },
+    .{ "squinting_face_with_tongue", "\u{1F61D}" },
+    .{ "sri_lanka", "\u{1F1F1}\u{1F1F0}" },
+    .{ "stadium", "\u{1F3DF}" },
+    .{ "star", "\u{2B50}" },
+    .{ "star-struck", "\u{1F929}" },
+    .{ "star2", "\u{1F31F}" },
+    .{ "star_and_crescent", "\u{262A}" },
+    .{ "star_of_david", "\u{2721}" },
+    .{ "stars", "\u{1F320}" },
+    .{ "station", "\u{1F689}" },
+    .{ "statue_of_liberty", "\u{1F5FD}" },
+    .{ "steam_locomotive", "\u{1F682}" },
+    .{ "steaming_bowl", "\u{1F35C}" },
+    .{ "stethoscope", "\u{1FA7A}" },
+    .{ "stew", "\u{1F372}" },
+    .{ "stop_button", "\u{23F9}" },
+    .{ "stop_sign", "\u{1F6D1}" },
+    .{ "stopwatch", "\u{23F1}" },
+    .{ "straight_ruler", "\u{1F4CF}" },
+    .{ "strawberry", "\u{1F353}" },
+    .{ "stuck_out_tongue", "\u{1F61B}" },
+    .{ "stuck_out_tongue_closed_eyes", "\u{1F61D}" },
+    .{ "stuck_out_tongue_winking_eye", "\u{1F61C}" },
+    .{ "studio_microphone", "\u{1F399}" },
+    .{ "stuffed_flatbread", "\u{1F959}" },
+    .{ "sudan", "\u{1F1F8}\u{1F1E9}" },
+    .{ "sun", "\u{2600}" },
+    .{ "sun_behind_cloud", "\u{26C5}" },
+    .{ "sun_behind_large_cloud", "\u{1F325}" },
+    .{ "sun_behind_rain_cloud", "\u{1F326}" },
+    .{ "sun_behind_small_cloud", "\u{1F324}" },
+    .{ "sun_with_face", "\u{1F31E}" },
+    .{ "sunflower", "\u{1F33B}" },
+    .{ "sunglasses", "\u{1F60E}" },
+    .{ "sunny", "\u{2600}" },
+    .{ "sunrise", "\u{1F305}" },
+    .{ "sunrise_over_mountains", "\u{1F304}" },
+    .{ "sunset", "\u{1F307}" },
+    .{ "superhero", "\u{1F9B8}" },
+    .{ "supervillain", "\u{1F9B9}" },
+    .{ "surfer", "\u{1F3C4}" },
+    .{ "suriname", "\u{1F1F8}\u{1F1F7}" },
+    .{ "sushi", "\u{1F363}" },
+    .{ "suspension_railway", "\u{1F69F}" },
+    .{ "swan", "\u{1F9A2}" },
+    .{ "swaziland", "\u{1F1F8}\u{1F1FF}" },
+    .{ "sweat", "\u{1F613}" },
+    .{ "sweat_droplets", "\u{1F4A6}" },
+    .{ "sweat_drops", "\u{1F4A6}" },
+    .{ "sweat_smile", "\u{1F605}" },
+    .{ "sweden", "\u{1F1F8}\u{1F1EA}" },
+    .{ "sweet_potato", "\u{1F360}" },
+    .{ "swimmer", "\u{1F3CA}" },
+    .{ "switzerland", "\u{1F1E8}\u{1F1ED}" },
+    .{ "symbols", "\u{1F523}" },
+    .{ "synagogue", "\u{1F54D}" },
+    .{ "syria", "\u{1F1F8}\u{1F1FE}" },
+    .{ "syringe", "\u{1F489}" },
+    .{ "t-rex", "\u{1F996}" },
+    .{ "t-shirt", "\u{1F455}" },
+    .{ "table_tennis_paddle_and_ball", "\u{1F3D3}" },
+    .{ "taco", "\u{1F32E}" },
+    .{ "tada", "\u{1F389}" },
+    .{ "taiwan", "\u{1F1F9}\u{1F1FC}" },
+    .{ "tajikistan", "\u{1F1F9}\u{1F1EF}" },
+    .{ "takeout_box", "\u{1F961}" },
+    .{ "tanabata_tree", "\u{1F38B}" },
+    .{ "tangerine", "\u{1F34A}" },
+    .{ "tanzania", "\u{1F1F9}\u{1F1FF}" },
+    .{ "taurus", "\u{2649}" },
+    .{ "taxi", "\u{1F695}" },
+    .{ "tea", "\u{1F375}" },
+    .{ "teacup_without_handle", "\u{1F375}" },
+    .{ "tear-off_calendar", "\u{1F4C6}" },
+    .{ "teddy_bear", "\u{1F9F8}" },
+    .{ "telephone", "\u{260E}" },
+    .{ "telephone_receiver", "\u{1F4DE}" },
+    .{ "telescope", "\u{1F52D}" },
+    .{ "television", "\u{1F4FA}" },
+    .{ "ten", "\u{1F51F}" },
+    .{ "ten-thirty", "\u{1F565}" },
+    .{ "tennis", "\u{1F3BE}" },
+    .{ "tent", "\u{26FA}" },
+    .{ "test_tube", "\u{1F9EA}" },
+    .{ "thailand", "\u{1F1F9}\u{1F1ED}" },
+    .{ "thermometer", "\u{1F321}" },
+    .{ "thinking_face", "\u{1F914}" },
+    .{ "thought_balloon", "\u{1F4AD}" },
+    .{ "thread", "\u{1F9F5}" },
+    .{ "three", "\u{33}\u{FE0F}\u{20E3}" },
+    .{ "three-thirty", "\u{1F55E}" },
+    .{ "three_button_mouse", "\u{1F5B1}" },
+    .{ "thumbs_down", "\u{1F44E}" },
+    .{ "thumbs_down_dark_skin_tone", "\u{1F44E}\u{1F3FF}" },
+    .{ "thumbs_down_light_skin_tone", "\u{1F44E}\u{1F3FB}" },
+    .{ "thumbs_down_medium-dark_skin_tone", "\u{1F44E}\u{1F3FE}" },
+    .{ "thumbs_down_medium-light_skin_tone", "\u{1F44E}\u{1F3FC}" },
+    .{ "thumbs_down_medium_skin_tone", "\u{1F44E}\u{1F3FD}" },
+    .{ "thumbs_up", "\u{1F44D}" },
+    .{ "thumbs_up_dark_skin_tone", "\u{1F44D}\u{1F3FF}" },
+    .{ "thumbs_up_light_skin_tone", "\u{1F44D}\u{1F3FB}" },
+    .{ "thumbs_up_medium-dark_skin_tone", "\u{1F44D}\u{1F3FE}" },
+    .{ "thumbs_up_medium-light_skin_tone", "\u{1F44D}\u{1F3FC}" },
+    .{ "thumbs_up_medium_skin_tone", "\u{1F44D}\u{1F3FD}" },
+    .{ "thumbsdown", "\u{1F44E}" },
+    .{ "thumbsup", "\u{1F44D}" },
+    .{ "thunder_cloud_and_rain", "\u{26C8}" },
+    .{ "ticket", "\u{1F3AB}" },
+    .{ "tiger", "\u{1F42F}" },
+    .{ "tiger2", "\u{1F405}" },
+    .{ "tiger_face", "\u{1F42F}" },
+    .{ "timer_clock", "\u{23F2}" },
+    .{ "timor-leste", "\u{1F1F9}\u{1F1F1}" },
+    .{ "tired_face", "\u{1F62B}" },
+    .{ "tm", "\u{2122}" },
+    .{ "togo", "\u{1F1F9}\u{1F1EC}" },
+    .{ "toilet", "\u{1F6BD}" },
+    .{ "tokelau", "\u{1F1F9}\u{1F1F0}" },
+    .{ "tokyo_tower", "\u{1F5FC}" },
+    .{ "tomato", "\u{1F345}" },
+    .{ "tonga", "\u{1F1F9}\u{1F1F4}" },
+    .{ "tongue", "\u{1F445}" },
+    .{ "toolbox", "\u{1F9F0}" },
+    .{ "tooth", "\u{1F9B7}" },
+    .{ "top", "\u{1F51D}" },
+    .{ "top_arrow", "\u{1F51D}" },
+    .{ "top_hat", "\u{1F3A9}" },
+    .{ "tophat", "\u{1F3A9}" },
+    .{ "tornado", "\u{1F32A}" },
+    .{ "trackball", "\u{1F5B2}" },
+    .{ "tractor", "\u{1F69C}" },
+    .{ "trade_mark", "\u{2122}" },
+    .{ "traffic_light", "\u{1F6A5}" },
+    .{ "train", "\u{1F68B}" },
+    .{ "train2", "\u{1F686}" },
+    .{ "tram", "\u{1F68A}" },
+    .{ "tram_car", "\u{1F68B}" },
+    .{ "triangular_flag", "\u{1F6A9}" },
+    .{ "triangular_flag_on_post", "\u{1F6A9}" },
+    .{ "triangular_ruler", "\u{1F4D0}" },
+    .{ "trident", "\u{1F531}" },
+    .{ "trident_emblem", "\u{1F531}" },
+    .{ "tristan_da_cunha", "\u{1F1F9}\u{1F1E6}" },
+    .{ "triumph", "\u{1F624}" },
+    .{ "trolleybus", "\u{1F68E}" },
+    .{ "trophy", "\u{1F3C6}" },
+    .{ "tropical_drink", "\u{1F379}" },
+    .{ "tropical_fish", "\u{1F420}" },
+    .{ "truck", "\u{1F69A}" },
+    .{ "trumpet", "\u{1F3BA}" },
+    .{ "tshirt", "\u{1F455}" },
+    .{ "tulip", "\u{1F337}" },
+    .{ "tumbler_glass", "\u{1F943}" },
+    .{ "tunisia", "\u{1F1F9}\u{1F1F3}" },
+    .{ "turkey", "\u{1F983}" },
+    .{ "turkmenistan", "\u{1F1F9}\u{1F1F2}" },
+    .{ "turtle", "\u{1F422}" },
+    .{ "tuvalu", "\u{1F1F9}\u{1F1FB}" },
+    .{ "tv", "\u{1F4FA}" },
+    .{ "twelve-thirty", "\u{1F567}" },
+    .{ "twisted_rightwards_arrows", "\u{1F500}" },
+    .{ "two", "\u{32}\u{FE0F}\u{20E3}" },
+    .{ "two-hump_camel", "\u{1F42B}" },
+    .{ "two-thirty", "\u{1F55D}" },
+    .{ "two_hearts", "\u{1F495}" },
+    .{ "two_men_holding_hands", "\u{1F46C}" },
+    .{ "two_women_holding_hands", "\u{1F46D}" },
+    .{ "u5272", "\u{1F239}" },
+    .{ "u5408", "\u{1F234}" },
+    .{ "u55b6", "\u{1F23A}" },
+    .{ "u6307", "\u{1F22F}" },
+    .{ "u6708", "\u{1F237}" },
+    .{ "u6709", "\u{1F236}" },
+    .{ "u6e80", "\u{1F235}" },
+    .{ "u7121", "\u{1F21A}" },
+    .{ "u7533", "\u{1F238}" },
+    .{ "u7981", "\u{1F232}" },
+    .{ "u7a7a", "\u{1F233}" },
+    .{ "uganda", "\u{1F1FA}\u{1F1EC}" },
+    .{ "ukraine", "\u{1F1FA}\u{1F1E6}" },
+    .{ "umbrella", "\u{2602}" },
+    .{ "umbrella_on_ground", "\u{26F1}" },
+    .{ "umbrella_with_rain_drops", "\u{2614}" },
+    .{ "unamused", "\u{1F612}" },
+    .{ "unamused_face", "\u{1F612}" },
+    .{ "underage", "\u{1F51E}" },
+    .{ "unicorn_face", "\u{1F984}" },
+    .{ "united_arab_emirates", "\u{1F1E6}\u{1F1EA}" },
+    .{ "united_kingdom", "\u{1F1EC}\u{1F1E7}" },
+    .{ "united_nations", "\u{1F1FA}\u{1F1F3}" },
+    .{ "united_states", "\u{1F1FA}\u{1F1F8}" },
+    .{ "unlock", "\u{1F513}" },
+    .{ "unlocked", "\u{1F513}" },
+    .{ "up", "\u{1F199}" },
+    .{ "up-down_arrow", "\u{2195}" },
+    .{ "up-left_arrow", "\u{2196}" },
+    .{ "up-right_arrow", "\u{2197}" },
+    .{ "up_arrow", "\u{2B06}" },
+    .{ "upside-down_face", "\u{1F643}" },
+    .{ "upside__down_face", "\u{1F643}" },
+    .{ "upwards_button", "\u{1F53C}" },
+    .{ "uruguay", "\u{1F1FA}\u{1F1FE}" },
+    .{ "uzbekistan", "\u{1F1FA}\u{1F1FF}" },
+    .{ "v", "\u{270C}" },
+    .{ "vampire", "\u{1F9DB}" },
+    .{ "vampire_dark_skin_tone", "\u{1F9DB}\u{1F3FF}" },
+    .{ "vampire_light_skin_tone", "\u{1F9DB}\u{1F3FB}" },
+    .{ "vampire_medium-dark_skin_tone", "\u{1F9DB}\u{1F3FE}" },
+    .{ "vampire_medium-light_skin_tone", "\u{1F9DB}\u{1F3FC}" },
+    .{ "vampire_medium_skin_tone", "\u{1F9DB}\u{1F3FD}" },
+    .{ "vanuatu", "\u{1F1FB}\u{1F1FA}" },
+    .{ "vatican_city", "\u{1F1FB}\u{1F1E6}" },
+    .{ "venezuela", "\u{1F1FB}\u{1F1EA}" },
+    .{ "vertical_traffic_light", "\u{1F6A6}" },
+    .{ "vhs", "\u{1F4FC}" },
+    .{ "vibration_mode", "\u{1F4F3}" },
+    .{ "victory_hand", "\u{270C}" },
+    .{ "victory_hand_dark_skin_tone", "\u{270C}\u{1F3FF}" },
+    .{ "victory_hand_light_skin_tone", "\u{270C}\u{1F3FB}" },
+    .{ "victory_hand_medium-dark_skin_tone", "\u{270C}\u{1F3FE}" },
+    .{ "victory_hand_medium-light_skin_tone", "\u{270C}\u{1F3FC}" },
+    .{ "victory_hand_medium_skin_tone", "\u{270C}\u{1F3FD}" },
+    .{ "video_camera", "\u{1F4F9}" },
+    .{ "video_game", "\u{1F3AE}" },
+    .{ "videocassette", "\u{1F4FC}" },
+    .{ "vietnam", "\u{1F1FB}\u{1F1F3}" },
+    .{ "violin", "\u{1F3BB}" },
+    .{ "virgo", "\u{264D}" },
+    .{ "volcano", "\u{1F30B}" },
+    .{ "volleyball", "\u{1F3D0}" },
+    .{ "vs", "\u{1F19A}" },
+    .{ "vs_button", "\u{1F19A}" },
+    .{ "vulcan_salute", "\u{1F596}" },
+    .{ "vulcan_salute_dark_skin_tone", "\u{1F596}\u{1F3FF}" },
+    .{ "vulcan_salute_light_skin_tone", "\u{1F596}\u{1F3FB}" },
+    .{ "vulcan_salute_medium-dark_skin_tone", "\u{1F596}\u{1F3FE}" },
+    .{ "vulcan_salute_medium-light_skin_tone", "\u{1F596}\u{1F3FC}" },
+    .{ "vulcan_salute_medium_skin_tone", "\u{1F596}\u{1F3FD}" },
+    .{ "waffle", "\u{1F9C7}" },
+    .{ "wales", "\u{1F3F4}\u{E0067}\u{E0062}\u{E0077}\u{E006C}\u{E0073}\u{E007F}" },
+    .{ "walking", "\u{1F6B6}" },
+    .{ "waning_crescent_moon", "\u{1F318}" },
+    .{ "waning_gibbous_moon", "\u{1F316}" },
+    .{ "warning", "\u{26A0}" },
+    .{ "wastebasket", "\u{1F5D1}" },
+    .{ "watch", "\u{231A}" },
+    .{ "water_buffalo", "\u{1F403}" },
+    .{ "water_closet", "\u{1F6BE}" },
+    .{ "water_wave", "\u{1F30A}" },
+    .{ "watermelon", "\u{1F349}" },
+    .{ "wave", "\u{1F44B}" },
+    .{ "waving_black_flag", "\u{1F3F4}" },
+    .{ "waving_hand", "\u{1F44B}" },
+    .{ "waving_hand_dark_skin_tone", "\u{1F44B}\u{1F3FF}" },
+    .{ "waving_hand_light_skin_tone", "\u{1F44B}\u{1F3FB}" },
+    .{ "waving_hand_medium-dark_skin_tone", "\u{1F44B}\u{1F3FE}" },
+    .{ "waving_hand_medium-light_skin_tone", "\u{1F44B}\u{1F3FC}" },
+    .{ "waving_hand_medium_skin_tone", "\u{1F44B}\u{1F3FD}" },
+    .{ "waving_white_flag", "\u{1F3F3}" },
+    .{ "wavy_dash", "\u{3030}" },
+    .{ "waxing_crescent_moon", "\u{1F312}" },
+    .{ "waxing_gibbous_moon", "\u{1F314}" },
+    .{ "wc", "\u{1F6BE}" },
+    .{ "weary", "\u{1F629}" },
+    .{ "weary_cat_face", "\u{1F640}" },
+    .{ "weary_face", "\u{1F629}" },
+    .{ "wedding", "\u{1F492}" },
+    .{ "weight_lifter", "\u{1F3CB}" },
+    .{ "western_sahara", "\u{1F1EA}\u{1F1ED}" },
+    .{ "whale", "\u{1F433}" },
+    .{ "whale2", "\u{1F40B}" },
+    .{ "wheel_of_dharma", "\u{2638}" },
+    .{ "wheelchair", "\u{267F}" },
+    .{ "wheelchair_symbol", "\u{267F}" },
+    .{ "white-haired_man", "\u{1F468}\u{200D}\u{1F9B3}" },
+    .{ "white-haired_woman", "\u{1F469}\u{200D}\u{1F9B3}" },
+    .{ "white_check_mark", "\u{2705}" },
+    .{ "white_circle", "\u{26AA}" },
+    .{ "white_exclamation_mark", "\u{2755}" },
+    .{ "white_flag", "\u{1F3F3}" },
+    .{ "white_flower", "\u{1F4AE}" },
+    .{ "white_frowning_face", "\u{2639}" },
+    .{ "white_hair", "\u{1F9B3}" },
+    .{ "white_heart", "\u{1F90D}" },
+    .{ "white_heavy_check_mark", "\u{2705}" },
+    .{ "white_large_square", "\u{2B1C}" },
+    .{ "white_medium-small_square", "\u{25FD}" },
+    .{ "white_medium_small_square", "\u{25FD}" },
+    .{ "white_medium_square", "\u{25FB}" },
+    .{ "white_medium_star", "\u{2B50}" },
+    .{ "white_question_mark", "\u{2754}" },
+    .{ "white_small_square", "\u{25AB}" },
+    .{ "white_square_button", "\u{1F533}" },
+    .{ "white_sun_behind_cloud", "\u{1F325}" },
+    .{ "white_sun_behind_cloud_with_rain", "\u{1F326}" },
+    .{ "white_sun_with_small_cloud", "\u{1F324}" },
+    .{ "wilted_flower", "\u{1F940}" },
+    .{ "wind_blowing_face", "\u{1F32C}" },
+    .{ "wind_chime", "\u{1F390}" },
+    .{ "wind_face", "\u{1F32C}" },
+    .{ "wine_glass", "\u{1F377}" },
+    .{ "wink", "\u{1F609}" },
+    .{ "winking_face", "\u{1F609}" },
+    .{ "winking_face_with_tongue", "\u{1F61C}" },
+    .{ "wolf", "\u{1F43A}" },
+    .{ "wolf_face", "\u{1F43A}" },
+    .{ "woman", "\u{1F469}" },
+    .{ "woman_artist", "\u{1F469}\u{200D}\u{1F3A8}" },
+    .{ "woman_artist_dark_skin_tone", "\u{1F469}\u{1F3FF}\u{200D}\u{1F3A8}" },
+    .{ "woman_artist_light_skin_tone", "\u{1F469}\u{1F3FB}\u{200D}\u{1F3A8}" },
+    .{ "woman_artist_medium-dark_skin_tone", "\u{1F469}\u{1F3FE}\u{200D}\u{1F3A8}" },
+    .{ "woman_artist_medium-light_skin_tone", "\u{1F469}\u{1F3FC}\u{200D}\u{1F3A8}" },
+    .{ "woman_artist_medium_skin_tone", "\u{1F469}\u{1F3FD}\u{200D}\u{1F3A8}" },
+    .{ "woman_astronaut", "\u{1F469}\u{200D}\u{1F680}" },
+    .{ "woman_astronaut_dark_skin_tone", "\u{1F469}\u{1F3FF}\u{200D}\u{1F680}" },
+    .{ "woman_astronaut_light_skin_tone", "\u{1F469}\u{1F3FB}\u{200D}\u{1F680}" },
+    .{ "woman_astronaut_medium-dark_skin_tone", "\u{1F469}\u{1F3FE}\u{200D}\u{1F680}" },
+    .{ "woman_astronaut_medium-light_skin_tone", "\u{1F469}\u{1F3FC}\u{200D}\u{1F680}" },
+    .{ "woman_astronaut_medium_skin_tone", "\u{1F469}\u{1F3FD}\u{200D}\u{1F680}" },
+    .{ "woman_biking", "\u{1F6B4}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_biking_dark_skin_tone", "\u{1F6B4}\u{1F3FF}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_biking_light_skin_tone", "\u{1F6B4}\u{1F3FB}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_biking_medium-dark_skin_tone", "\u{1F6B4}\u{1F3FE}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_biking_medium-light_skin_tone", "\u{1F6B4}\u{1F3FC}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_biking_medium_skin_tone", "\u{1F6B4}\u{1F3FD}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_bouncing_ball", "\u{26F9}\u{FE0F}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_bouncing_ball_dark_skin_tone", "\u{26F9}\u{1F3FF}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_bouncing_ball_light_skin_tone", "\u{26F9}\u{1F3FB}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_bouncing_ball_medium-dark_skin_tone", "\u{26F9}\u{1F3FE}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_bouncing_ball_medium-light_skin_tone", "\u{26F9}\u{1F3FC}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_bouncing_ball_medium_skin_tone", "\u{26F9}\u{1F3FD}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_bowing", "\u{1F647}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_bowing_dark_skin_tone", "\u{1F647}\u{1F3FF}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_bowing_light_skin_tone", "\u{1F647}\u{1F3FB}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_bowing_medium-dark_skin_tone", "\u{1F647}\u{1F3FE}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_bowing_medium-light_skin_tone", "\u{1F647}\u{1F3FC}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_bowing_medium_skin_tone", "\u{1F647}\u{1F3FD}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_cartwheeling", "\u{1F938}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_cartwheeling_dark_skin_tone", "\u{1F938}\u{1F3FF}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_cartwheeling_light_skin_tone", "\u{1F938}\u{1F3FB}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_cartwheeling_medium-dark_skin_tone", "\u{1F938}\u{1F3FE}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_cartwheeling_medium-light_skin_tone", "\u{1F938}\u{1F3FC}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_cartwheeling_medium_skin_tone", "\u{1F938}\u{1F3FD}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_climbing", "\u{1F9D7}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_climbing_dark_skin_tone", "\u{1F9D7}\u{1F3FF}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_climbing_light_skin_tone", "\u{1F9D7}\u{1F3FB}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_climbing_medium-dark_skin_tone", "\u{1F9D7}\u{1F3FE}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_climbing_medium-light_skin_tone", "\u{1F9D7}\u{1F3FC}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_climbing_medium_skin_tone", "\u{1F9D7}\u{1F3FD}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_construction_worker", "\u{1F477}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_construction_worker_dark_skin_tone", "\u{1F477}\u{1F3FF}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_construction_worker_light_skin_tone", "\u{1F477}\u{1F3FB}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_construction_worker_medium-dark_skin_tone", "\u{1F477}\u{1F3FE}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_construction_worker_medium-light_skin_tone", "\u{1F477}\u{1F3FC}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_construction_worker_medium_skin_tone", "\u{1F477}\u{1F3FD}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_cook", "\u{1F469}\u{200D}\u{1F373}" },
+    .{ "woman_cook_dark_skin_tone", "\u{1F469}\u{1F3FF}\u{200D}\u{1F373}" },
+    .{ "woman_cook_light_skin_tone", "\u{1F469}\u{1F3FB}\u{200D}\u{1F373}" },
+    .{ "woman_cook_medium-dark_skin_tone", "\u{1F469}\u{1F3FE}\u{200D}\u{1F373}" },
+    .{ "woman_cook_medium-light_skin_tone", "\u{1F469}\u{1F3FC}\u{200D}\u{1F373}" },
+    .{ "woman_cook_medium_skin_tone", "\u{1F469}\u{1F3FD}\u{200D}\u{1F373}" },
+    .{ "woman_dancing", "\u{1F483}" },
+    .{ "woman_dancing_dark_skin_tone", "\u{1F483}\u{1F3FF}" },
+    .{ "woman_dancing_light_skin_tone", "\u{1F483}\u{1F3FB}" },
+    .{ "woman_dancing_medium-dark_skin_tone", "\u{1F483}\u{1F3FE}" },
+    .{ "woman_dancing_medium-light_skin_tone", "\u{1F483}\u{1F3FC}" },
+    .{ "woman_dancing_medium_skin_tone", "\u{1F483}\u{1F3FD}" },
+    .{ "woman_dark_skin_tone", "\u{1F469}\u{1F3FF}" },
+    .{ "woman_detective", "\u{1F575}\u{FE0F}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_detective_dark_skin_tone", "\u{1F575}\u{1F3FF}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_detective_light_skin_tone", "\u{1F575}\u{1F3FB}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_detective_medium-dark_skin_tone", "\u{1F575}\u{1F3FE}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_detective_medium-light_skin_tone", "\u{1F575}\u{1F3FC}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_detective_medium_skin_tone", "\u{1F575}\u{1F3FD}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_elf", "\u{1F9DD}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_elf_dark_skin_tone", "\u{1F9DD}\u{1F3FF}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_elf_light_skin_tone", "\u{1F9DD}\u{1F3FB}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_elf_medium-dark_skin_tone", "\u{1F9DD}\u{1F3FE}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_elf_medium-light_skin_tone", "\u{1F9DD}\u{1F3FC}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_elf_medium_skin_tone", "\u{1F9DD}\u{1F3FD}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_facepalming", "\u{1F926}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_facepalming_dark_skin_tone", "\u{1F926}\u{1F3FF}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_facepalming_light_skin_tone", "\u{1F926}\u{1F3FB}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_facepalming_medium-dark_skin_tone", "\u{1F926}\u{1F3FE}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_facepalming_medium-light_skin_tone", "\u{1F926}\u{1F3FC}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_facepalming_medium_skin_tone", "\u{1F926}\u{1F3FD}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_factory_worker", "\u{1F469}\u{200D}\u{1F3ED}" },
+    .{ "woman_factory_worker_dark_skin_tone", "\u{1F469}\u{1F3FF}\u{200D}\u{1F3ED}" },
+    .{ "woman_factory_worker_light_skin_tone", "\u{1F469}\u{1F3FB}\u{200D}\u{1F3ED}" },
+    .{ "woman_factory_worker_medium-dark_skin_tone", "\u{1F469}\u{1F3FE}\u{200D}\u{1F3ED}" },
+    .{ "woman_factory_worker_medium-light_skin_tone", "\u{1F469}\u{1F3FC}\u{200D}\u{1F3ED}" },
+    .{ "woman_factory_worker_medium_skin_tone", "\u{1F469}\u{1F3FD}\u{200D}\u{1F3ED}" },
+    .{ "woman_fairy", "\u{1F9DA}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_fairy_dark_skin_tone", "\u{1F9DA}\u{1F3FF}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_fairy_light_skin_tone", "\u{1F9DA}\u{1F3FB}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_fairy_medium-dark_skin_tone", "\u{1F9DA}\u{1F3FE}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_fairy_medium-light_skin_tone", "\u{1F9DA}\u{1F3FC}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_fairy_medium_skin_tone", "\u{1F9DA}\u{1F3FD}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_farmer", "\u{1F469}\u{200D}\u{1F33E}" },
+    .{ "woman_farmer_dark_skin_tone", "\u{1F469}\u{1F3FF}\u{200D}\u{1F33E}" },
+    .{ "woman_farmer_light_skin_tone", "\u{1F469}\u{1F3FB}\u{200D}\u{1F33E}" },
+    .{ "woman_farmer_medium-dark_skin_tone", "\u{1F469}\u{1F3FE}\u{200D}\u{1F33E}" },
+    .{ "woman_farmer_medium-light_skin_tone", "\u{1F469}\u{1F3FC}\u{200D}\u{1F33E}" },
+    .{ "woman_farmer_medium_skin_tone", "\u{1F469}\u{1F3FD}\u{200D}\u{1F33E}" },
+    .{ "woman_firefighter", "\u{1F469}\u{200D}\u{1F692}" },
+    .{ "woman_firefighter_dark_skin_tone", "\u{1F469}\u{1F3FF}\u{200D}\u{1F692}" },
+    .{ "woman_firefighter_light_skin_tone", "\u{1F469}\u{1F3FB}\u{200D}\u{1F692}" },
+    .{ "woman_firefighter_medium-dark_skin_tone", "\u{1F469}\u{1F3FE}\u{200D}\u{1F692}" },
+    .{ "woman_firefighter_medium-light_skin_tone", "\u{1F469}\u{1F3FC}\u{200D}\u{1F692}" },
+    .{ "woman_firefighter_medium_skin_tone", "\u{1F469}\u{1F3FD}\u{200D}\u{1F692}" },
+    .{ "woman_frowning", "\u{1F64D}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_frowning_dark_skin_tone", "\u{1F64D}\u{1F3FF}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_frowning_light_skin_tone", "\u{1F64D}\u{1F3FB}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_frowning_medium-dark_skin_tone", "\u{1F64D}\u{1F3FE}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_frowning_medium-light_skin_tone", "\u{1F64D}\u{1F3FC}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_frowning_medium_skin_tone", "\u{1F64D}\u{1F3FD}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_genie", "\u{1F9DE}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_gesturing_no", "\u{1F645}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_gesturing_no_dark_skin_tone", "\u{1F645}\u{1F3FF}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_gesturing_no_light_skin_tone", "\u{1F645}\u{1F3FB}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_gesturing_no_medium-dark_skin_tone", "\u{1F645}\u{1F3FE}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_gesturing_no_medium-light_skin_tone", "\u{1F645}\u{1F3FC}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_gesturing_no_medium_skin_tone", "\u{1F645}\u{1F3FD}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_gesturing_ok", "\u{1F646}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_gesturing_ok_dark_skin_tone", "\u{1F646}\u{1F3FF}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_gesturing_ok_light_skin_tone", "\u{1F646}\u{1F3FB}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_gesturing_ok_medium-dark_skin_tone", "\u{1F646}\u{1F3FE}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_gesturing_ok_medium-light_skin_tone", "\u{1F646}\u{1F3FC}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_gesturing_ok_medium_skin_tone", "\u{1F646}\u{1F3FD}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_getting_haircut", "\u{1F487}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_getting_haircut_dark_skin_tone", "\u{1F487}\u{1F3FF}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_getting_haircut_light_skin_tone", "\u{1F487}\u{1F3FB}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_getting_haircut_medium-dark_skin_tone", "\u{1F487}\u{1F3FE}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_getting_haircut_medium-light_skin_tone", "\u{1F487}\u{1F3FC}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_getting_haircut_medium_skin_tone", "\u{1F487}\u{1F3FD}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_getting_massage", "\u{1F486}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_getting_massage_dark_skin_tone", "\u{1F486}\u{1F3FF}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_getting_massage_light_skin_tone", "\u{1F486}\u{1F3FB}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_getting_massage_medium-dark_skin_tone", "\u{1F486}\u{1F3FE}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_getting_massage_medium-light_skin_tone", "\u{1F486}\u{1F3FC}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_getting_massage_medium_skin_tone", "\u{1F486}\u{1F3FD}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_golfing", "\u{1F3CC}\u{FE0F}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_golfing_dark_skin_tone", "\u{1F3CC}\u{1F3FF}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_golfing_light_skin_tone", "\u{1F3CC}\u{1F3FB}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_golfing_medium-dark_skin_tone", "\u{1F3CC}\u{1F3FE}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_golfing_medium-light_skin_tone", "\u{1F3CC}\u{1F3FC}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_golfing_medium_skin_tone", "\u{1F3CC}\u{1F3FD}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_guard", "\u{1F482}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_guard_dark_skin_tone", "\u{1F482}\u{1F3FF}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_guard_light_skin_tone", "\u{1F482}\u{1F3FB}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_guard_medium-dark_skin_tone", "\u{1F482}\u{1F3FE}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_guard_medium-light_skin_tone", "\u{1F482}\u{1F3FC}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_guard_medium_skin_tone", "\u{1F482}\u{1F3FD}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_health_worker", "\u{1F469}\u{200D}\u{2695}\u{FE0F}" },
+    .{ "woman_health_worker_dark_skin_tone", "\u{1F469}\u{1F3FF}\u{200D}\u{2695}\u{FE0F}" },
+    .{ "woman_health_worker_light_skin_tone", "\u{1F469}\u{1F3FB}\u{200D}\u{2695}\u{FE0F}" },
+    .{ "woman_health_worker_medium-dark_skin_tone", "\u{1F469}\u{1F3FE}\u{200D}\u{2695}\u{FE0F}" },
+    .{ "woman_health_worker_medium-light_skin_tone", "\u{1F469}\u{1F3FC}\u{200D}\u{2695}\u{FE0F}" },
+    .{ "woman_health_worker_medium_skin_tone", "\u{1F469}\u{1F3FD}\u{200D}\u{2695}\u{FE0F}" },
+    .{ "woman_in_lotus_position", "\u{1F9D8}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_in_lotus_position_dark_skin_tone", "\u{1F9D8}\u{1F3FF}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_in_lotus_position_light_skin_tone", "\u{1F9D8}\u{1F3FB}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_in_lotus_position_medium-dark_skin_tone", "\u{1F9D8}\u{1F3FE}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_in_lotus_position_medium-light_skin_tone", "\u{1F9D8}\u{1F3FC}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_in_lotus_position_medium_skin_tone", "\u{1F9D8}\u{1F3FD}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_in_manual_wheelchair", "\u{1F469}\u{200D}\u{1F9BD}" },
+    .{ "woman_in_motorized_wheelchair", "\u{1F469}\u{200D}\u{1F9BC}" },
+    .{ "woman_in_steamy_room", "\u{1F9D6}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_in_steamy_room_dark_skin_tone", "\u{1F9D6}\u{1F3FF}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_in_steamy_room_light_skin_tone", "\u{1F9D6}\u{1F3FB}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_in_steamy_room_medium-dark_skin_tone", "\u{1F9D6}\u{1F3FE}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_in_steamy_room_medium-light_skin_tone", "\u{1F9D6}\u{1F3FC}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_in_steamy_room_medium_skin_tone", "\u{1F9D6}\u{1F3FD}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_judge", "\u{1F469}\u{200D}\u{2696}\u{FE0F}" },
+    .{ "woman_judge_dark_skin_tone", "\u{1F469}\u{1F3FF}\u{200D}\u{2696}\u{FE0F}" },
+    .{ "woman_judge_light_skin_tone", "\u{1F469}\u{1F3FB}\u{200D}\u{2696}\u{FE0F}" },
+    .{ "woman_judge_medium-dark_skin_tone", "\u{1F469}\u{1F3FE}\u{200D}\u{2696}\u{FE0F}" },
+    .{ "woman_judge_medium-light_skin_tone", "\u{1F469}\u{1F3FC}\u{200D}\u{2696}\u{FE0F}" },
+    .{ "woman_judge_medium_skin_tone", "\u{1F469}\u{1F3FD}\u{200D}\u{2696}\u{FE0F}" },
+    .{ "woman_juggling", "\u{1F939}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_juggling_dark_skin_tone", "\u{1F939}\u{1F3FF}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_juggling_light_skin_tone", "\u{1F939}\u{1F3FB}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_juggling_medium-dark_skin_tone", "\u{1F939}\u{1F3FE}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_juggling_medium-light_skin_tone", "\u{1F939}\u{1F3FC}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_juggling_medium_skin_tone", "\u{1F939}\u{1F3FD}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_lifting_weights", "\u{1F3CB}\u{FE0F}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_lifting_weights_dark_skin_tone", "\u{1F3CB}\u{1F3FF}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_lifting_weights_light_skin_tone", "\u{1F3CB}\u{1F3FB}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_lifting_weights_medium-dark_skin_tone", "\u{1F3CB}\u{1F3FE}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_lifting_weights_medium-light_skin_tone", "\u{1F3CB}\u{1F3FC}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_lifting_weights_medium_skin_tone", "\u{1F3CB}\u{1F3FD}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_light_skin_tone", "\u{1F469}\u{1F3FB}" },
+    .{ "woman_mage", "\u{1F9D9}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_mage_dark_skin_tone", "\u{1F9D9}\u{1F3FF}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_mage_light_skin_tone", "\u{1F9D9}\u{1F3FB}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_mage_medium-dark_skin_tone", "\u{1F9D9}\u{1F3FE}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_mage_medium-light_skin_tone", "\u{1F9D9}\u{1F3FC}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_mage_medium_skin_tone", "\u{1F9D9}\u{1F3FD}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_mechanic", "\u{1F469}\u{200D}\u{1F527}" },
+    .{ "woman_mechanic_dark_skin_tone", "\u{1F469}\u{1F3FF}\u{200D}\u{1F527}" },
+    .{ "woman_mechanic_light_skin_tone", "\u{1F469}\u{1F3FB}\u{200D}\u{1F527}" },
+    .{ "woman_mechanic_medium-dark_skin_tone", "\u{1F469}\u{1F3FE}\u{200D}\u{1F527}" },
+    .{ "woman_mechanic_medium-light_skin_tone", "\u{1F469}\u{1F3FC}\u{200D}\u{1F527}" },
+    .{ "woman_mechanic_medium_skin_tone", "\u{1F469}\u{1F3FD}\u{200D}\u{1F527}" },
+    .{ "woman_medium-dark_skin_tone", "\u{1F469}\u{1F3FE}" },
+    .{ "woman_medium-light_skin_tone", "\u{1F469}\u{1F3FC}" },
+    .{ "woman_medium_skin_tone", "\u{1F469}\u{1F3FD}" },
+    .{ "woman_mountain_biking", "\u{1F6B5}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_mountain_biking_dark_skin_tone", "\u{1F6B5}\u{1F3FF}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_mountain_biking_light_skin_tone", "\u{1F6B5}\u{1F3FB}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_mountain_biking_medium-dark_skin_tone", "\u{1F6B5}\u{1F3FE}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_mountain_biking_medium-light_skin_tone", "\u{1F6B5}\u{1F3FC}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_mountain_biking_medium_skin_tone", "\u{1F6B5}\u{1F3FD}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_office_worker", "\u{1F469}\u{200D}\u{1F4BC}" },
+    .{ "woman_office_worker_dark_skin_tone", "\u{1F469}\u{1F3FF}\u{200D}\u{1F4BC}" },
+    .{ "woman_office_worker_light_skin_tone", "\u{1F469}\u{1F3FB}\u{200D}\u{1F4BC}" },
+    .{ "woman_office_worker_medium-dark_skin_tone", "\u{1F469}\u{1F3FE}\u{200D}\u{1F4BC}" },
+    .{ "woman_office_worker_medium-light_skin_tone", "\u{1F469}\u{1F3FC}\u{200D}\u{1F4BC}" },
+    .{ "woman_office_worker_medium_skin_tone", "\u{1F469}\u{1F3FD}\u{200D}\u{1F4BC}" },
+    .{ "woman_pilot", "\u{1F469}\u{200D}\u{2708}\u{FE0F}" },
+    .{ "woman_pilot_dark_skin_tone", "\u{1F469}\u{1F3FF}\u{200D}\u{2708}\u{FE0F}" },
+    .{ "woman_pilot_light_skin_tone", "\u{1F469}\u{1F3FB}\u{200D}\u{2708}\u{FE0F}" },
+    .{ "woman_pilot_medium-dark_skin_tone", "\u{1F469}\u{1F3FE}\u{200D}\u{2708}\u{FE0F}" },
+    .{ "woman_pilot_medium-light_skin_tone", "\u{1F469}\u{1F3FC}\u{200D}\u{2708}\u{FE0F}" },
+    .{ "woman_pilot_medium_skin_tone", "\u{1F469}\u{1F3FD}\u{200D}\u{2708}\u{FE0F}" },
+    .{ "woman_playing_handball", "\u{1F93E}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_playing_handball_dark_skin_tone", "\u{1F93E}\u{1F3FF}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_playing_handball_light_skin_tone", "\u{1F93E}\u{1F3FB}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_playing_handball_medium-dark_skin_tone", "\u{1F93E}\u{1F3FE}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_playing_handball_medium-light_skin_tone", "\u{1F93E}\u{1F3FC}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_playing_handball_medium_skin_tone", "\u{1F93E}\u{1F3FD}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_playing_water_polo", "\u{1F93D}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_playing_water_polo_dark_skin_tone", "\u{1F93D}\u{1F3FF}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_playing_water_polo_light_skin_tone", "\u{1F93D}\u{1F3FB}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_playing_water_polo_medium-dark_skin_tone", "\u{1F93D}\u{1F3FE}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_playing_water_polo_medium-light_skin_tone", "\u{1F93D}\u{1F3FC}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_playing_water_polo_medium_skin_tone", "\u{1F93D}\u{1F3FD}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_police_officer", "\u{1F46E}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_police_officer_dark_skin_tone", "\u{1F46E}\u{1F3FF}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_police_officer_light_skin_tone", "\u{1F46E}\u{1F3FB}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_police_officer_medium-dark_skin_tone", "\u{1F46E}\u{1F3FE}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_police_officer_medium-light_skin_tone", "\u{1F46E}\u{1F3FC}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_police_officer_medium_skin_tone", "\u{1F46E}\u{1F3FD}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_pouting", "\u{1F64E}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_pouting_dark_skin_tone", "\u{1F64E}\u{1F3FF}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_pouting_light_skin_tone", "\u{1F64E}\u{1F3FB}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_pouting_medium-dark_skin_tone", "\u{1F64E}\u{1F3FE}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_pouting_medium-light_skin_tone", "\u{1F64E}\u{1F3FC}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_pouting_medium_skin_tone", "\u{1F64E}\u{1F3FD}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_raising_hand", "\u{1F64B}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_raising_hand_dark_skin_tone", "\u{1F64B}\u{1F3FF}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_raising_hand_light_skin_tone", "\u{1F64B}\u{1F3FB}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_raising_hand_medium-dark_skin_tone", "\u{1F64B}\u{1F3FE}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_raising_hand_medium-light_skin_tone", "\u{1F64B}\u{1F3FC}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_raising_hand_medium_skin_tone", "\u{1F64B}\u{1F3FD}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_rowing_boat", "\u{1F6A3}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_rowing_boat_dark_skin_tone", "\u{1F6A3}\u{1F3FF}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_rowing_boat_light_skin_tone", "\u{1F6A3}\u{1F3FB}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_rowing_boat_medium-dark_skin_tone", "\u{1F6A3}\u{1F3FE}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_rowing_boat_medium-light_skin_tone", "\u{1F6A3}\u{1F3FC}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_rowing_boat_medium_skin_tone", "\u{1F6A3}\u{1F3FD}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_running", "\u{1F3C3}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_running_dark_skin_tone", "\u{1F3C3}\u{1F3FF}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_running_light_skin_tone", "\u{1F3C3}\u{1F3FB}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_running_medium-dark_skin_tone", "\u{1F3C3}\u{1F3FE}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_running_medium-light_skin_tone", "\u{1F3C3}\u{1F3FC}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_running_medium_skin_tone", "\u{1F3C3}\u{1F3FD}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_scientist", "\u{1F469}\u{200D}\u{1F52C}" },
+    .{ "woman_scientist_dark_skin_tone", "\u{1F469}\u{1F3FF}\u{200D}\u{1F52C}" },
+    .{ "woman_scientist_light_skin_tone", "\u{1F469}\u{1F3FB}\u{200D}\u{1F52C}" },
+    .{ "woman_scientist_medium-dark_skin_tone", "\u{1F469}\u{1F3FE}\u{200D}\u{1F52C}" },
+    .{ "woman_scientist_medium-light_skin_tone", "\u{1F469}\u{1F3FC}\u{200D}\u{1F52C}" },
+    .{ "woman_scientist_medium_skin_tone", "\u{1F469}\u{1F3FD}\u{200D}\u{1F52C}" },
+    .{ "woman_shrugging", "\u{1F937}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_shrugging_dark_skin_tone", "\u{1F937}\u{1F3FF}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_shrugging_light_skin_tone", "\u{1F937}\u{1F3FB}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_shrugging_medium-dark_skin_tone", "\u{1F937}\u{1F3FE}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_shrugging_medium-light_skin_tone", "\u{1F937}\u{1F3FC}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_shrugging_medium_skin_tone", "\u{1F937}\u{1F3FD}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_singer", "\u{1F469}\u{200D}\u{1F3A4}" },
+    .{ "woman_singer_dark_skin_tone", "\u{1F469}\u{1F3FF}\u{200D}\u{1F3A4}" },
+    .{ "woman_singer_light_skin_tone", "\u{1F469}\u{1F3FB}\u{200D}\u{1F3A4}" },
+    .{ "woman_singer_medium-dark_skin_tone", "\u{1F469}\u{1F3FE}\u{200D}\u{1F3A4}" },
+    .{ "woman_singer_medium-light_skin_tone", "\u{1F469}\u{1F3FC}\u{200D}\u{1F3A4}" },
+    .{ "woman_singer_medium_skin_tone", "\u{1F469}\u{1F3FD}\u{200D}\u{1F3A4}" },
+    .{ "woman_student", "\u{1F469}\u{200D}\u{1F393}" },
+    .{ "woman_student_dark_skin_tone", "\u{1F469}\u{1F3FF}\u{200D}\u{1F393}" },
+    .{ "woman_student_light_skin_tone", "\u{1F469}\u{1F3FB}\u{200D}\u{1F393}" },
+    .{ "woman_student_medium-dark_skin_tone", "\u{1F469}\u{1F3FE}\u{200D}\u{1F393}" },
+    .{ "woman_student_medium-light_skin_tone", "\u{1F469}\u{1F3FC}\u{200D}\u{1F393}" },
+    .{ "woman_student_medium_skin_tone", "\u{1F469}\u{1F3FD}\u{200D}\u{1F393}" },
+    .{ "woman_surfing", "\u{1F3C4}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_surfing_dark_skin_tone", "\u{1F3C4}\u{1F3FF}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_surfing_light_skin_tone", "\u{1F3C4}\u{1F3FB}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_surfing_medium-dark_skin_tone", "\u{1F3C4}\u{1F3FE}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_surfing_medium-light_skin_tone", "\u{1F3C4}\u{1F3FC}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_surfing_medium_skin_tone", "\u{1F3C4}\u{1F3FD}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_swimming", "\u{1F3CA}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_swimming_dark_skin_tone", "\u{1F3CA}\u{1F3FF}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_swimming_light_skin_tone", "\u{1F3CA}\u{1F3FB}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_swimming_medium-dark_skin_tone", "\u{1F3CA}\u{1F3FE}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_swimming_medium-light_skin_tone", "\u{1F3CA}\u{1F3FC}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_swimming_medium_skin_tone", "\u{1F3CA}\u{1F3FD}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_teacher", "\u{1F469}\u{200D}\u{1F3EB}" },
+    .{ "woman_teacher_dark_skin_tone", "\u{1F469}\u{1F3FF}\u{200D}\u{1F3EB}" },
+    .{ "woman_teacher_light_skin_tone", "\u{1F469}\u{1F3FB}\u{200D}\u{1F3EB}" },
+    .{ "woman_teacher_medium-dark_skin_tone", "\u{1F469}\u{1F3FE}\u{200D}\u{1F3EB}" },
+    .{ "woman_teacher_medium-light_skin_tone", "\u{1F469}\u{1F3FC}\u{200D}\u{1F3EB}" },
+    .{ "woman_teacher_medium_skin_tone", "\u{1F469}\u{1F3FD}\u{200D}\u{1F3EB}" },
+    .{ "woman_technologist", "\u{1F469}\u{200D}\u{1F4BB}" },
+    .{ "woman_technologist_dark_skin_tone", "\u{1F469}\u{1F3FF}\u{200D}\u{1F4BB}" },
+    .{ "woman_technologist_light_skin_tone", "\u{1F469}\u{1F3FB}\u{200D}\u{1F4BB}" },
+    .{ "woman_technologist_medium-dark_skin_tone", "\u{1F469}\u{1F3FE}\u{200D}\u{1F4BB}" },
+    .{ "woman_technologist_medium-light_skin_tone", "\u{1F469}\u{1F3FC}\u{200D}\u{1F4BB}" },
+    .{ "woman_technologist_medium_skin_tone", "\u{1F469}\u{1F3FD}\u{200D}\u{1F4BB}" },
+    .{ "woman_tipping_hand", "\u{1F481}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_tipping_hand_dark_skin_tone", "\u{1F481}\u{1F3FF}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_tipping_hand_light_skin_tone", "\u{1F481}\u{1F3FB}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_tipping_hand_medium-dark_skin_tone", "\u{1F481}\u{1F3FE}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_tipping_hand_medium-light_skin_tone", "\u{1F481}\u{1F3FC}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_tipping_hand_medium_skin_tone", "\u{1F481}\u{1F3FD}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_vampire", "\u{1F9DB}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_vampire_dark_skin_tone", "\u{1F9DB}\u{1F3FF}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_vampire_light_skin_tone", "\u{1F9DB}\u{1F3FB}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_vampire_medium-dark_skin_tone", "\u{1F9DB}\u{1F3FE}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_vampire_medium-light_skin_tone", "\u{1F9DB}\u{1F3FC}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_vampire_medium_skin_tone", "\u{1F9DB}\u{1F3FD}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_walking", "\u{1F6B6}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_walking_dark_skin_tone", "\u{1F6B6}\u{1F3FF}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_walking_light_skin_tone", "\u{1F6B6}\u{1F3FB}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_walking_medium-dark_skin_tone", "\u{1F6B6}\u{1F3FE}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_walking_medium-light_skin_tone", "\u{1F6B6}\u{1F3FC}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_walking_medium_skin_tone", "\u{1F6B6}\u{1F3FD}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_wearing_turban", "\u{1F473}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_wearing_turban_dark_skin_tone", "\u{1F473}\u{1F3FF}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_wearing_turban_light_skin_tone", "\u{1F473}\u{1F3FB}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_wearing_turban_medium-dark_skin_tone", "\u{1F473}\u{1F3FE}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_wearing_turban_medium-light_skin_tone", "\u{1F473}\u{1F3FC}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_wearing_turban_medium_skin_tone", "\u{1F473}\u{1F3FD}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "woman_with_headscarf", "\u{1F9D5}" },
+    .{ "woman_with_headscarf_dark_skin_tone", "\u{1F9D5}\u{1F3FF}" },
+    .{ "woman_with_headscarf_light_skin_tone", "\u{1F9D5}\u{1F3FB}" },
+    .{ "woman_with_headscarf_medium-dark_skin_tone", "\u{1F9D5}\u{1F3FE}" },
+    .{ "woman_with_headscarf_medium-light_skin_tone", "\u{1F9D5}\u{1F3FC}" },
+    .{ "woman_with_headscarf_medium_skin_tone", "\u{1F9D5}\u{1F3FD}" },
+    .{ "woman_with_probing_cane", "\u{1F469}\u{200D}\u{1F9AF}" },
+    .{ "woman_zombie", "\u{1F9DF}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "womans_clothes", "\u{1F45A}" },
+    .{ "womans_hat", "\u{1F452}" },
+    .{ "women_with_bunny_ears", "\u{1F46F}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "women_wrestling", "\u{1F93C}\u{200D}\u{2640}\u{FE0F}" },
+    .{ "womens", "\u{1F6BA}" },
+    .{ "woozy_face", "\u{1F974}" },
+    .{ "world_map", "\u{1F5FA}" },
+    .{ "worried", "\u{1F61F}" },
+    .{ "worried_face", "\u{1F61F}" },
+    .{ "wrapped_gift", "\u{1F381}" },
+    .{ "wrench", "\u{1F527}" },
+    .{ "writing_hand", "\u{270D}" },
+    .{ "writing_hand_dark_skin_tone", "\u{270D}\u{1F3FF}" },
+    .{ "writing_hand_light_skin_tone", "\u{270D}\u{1F3FB}" },
+    .{ "writing_hand_medium-dark_skin_tone", "\u{270D}\u{1F3FE}" },
+    .{ "writing_hand_medium-light_skin_tone", "\u{270D}\u{1F3FC}" },
+    .{ "writing_hand_medium_skin_tone", "\u{270D}\u{1F3FD}" },
+    .{ "x", "\u{274C}" },
+    .{ "yarn", "\u{1F9F6}" },
+    .{ "yawning_face", "\u{1F971}" },
+    .{ "yellow_circle", "\u{1F7E1}" },
+    .{ "yellow_heart", "\u{1F49B}" },
+    .{ "yellow_square", "\u{1F7E8}" },
+    .{ "yemen", "\u{1F1FE}\u{1F1EA}" },
+    .{ "yen", "\u{1F4B4}" },
+    .{ "yen_banknote", "\u{1F4B4}" },
+    .{ "yin_yang", "\u{262F}" },
+    .{ "yo-yo", "\u{1FA80}" },
+    .{ "yum", "\u{1F60B}" },
+    .{ "zambia", "\u{1F1FF}\u{1F1F2}" },
+    .{ "zany_face", "\u{1F92A}" },
+    .{ "zap", "\u{26A1}" },
+    .{ "zebra", "\u{1F993}" },
+    .{ "zero", "\u{30}\u{FE0F}\u{20E3}" },
+    .{ "zimbabwe", "\u{1F1FF}\u{1F1FC}" },
+    .{ "zipper-mouth_face", "\u{1F910}" },
+    .{ "zipper__mouth_face", "\u{1F910}" },
+    .{ "zombie", "\u{1F9DF}" },
+    .{ "zzz", "\u{1F4A4}" },
+};
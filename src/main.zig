@@ -1,12 +1,29 @@
 const std = @import("std");
 const octomark = @import("octomark.zig");
 
+const usage = "usage: octomark [--cache-dir DIR] [--cache-max-mb N] [--stats] [--sanitize] < input.md > output.html\n";
+
 pub fn main() !void {
     const allocator = std.heap.page_allocator;
 
-    var parser: octomark.OctomarkParser = undefined;
-    try parser.init(allocator);
-    defer parser.deinit(allocator);
+    var cache_dir: ?[]const u8 = null;
+    var cache_max_mb: u64 = 256;
+    var show_stats = false;
+    var options: octomark.OctomarkOptions = .{};
+    var args = try std.process.argsWithAllocator(allocator);
+    defer args.deinit();
+    _ = args.skip();
+    while (args.next()) |arg| {
+        if (std.mem.eql(u8, arg, "--cache-dir")) {
+            cache_dir = args.next() orelse fail();
+        } else if (std.mem.eql(u8, arg, "--cache-max-mb")) {
+            cache_max_mb = std.fmt.parseInt(u64, args.next() orelse fail(), 10) catch fail();
+        } else if (std.mem.eql(u8, arg, "--stats")) {
+            show_stats = true;
+        } else if (std.mem.eql(u8, arg, "--sanitize")) {
+            options.sanitize = true;
+        } else fail();
+    }
 
     const stdin = std.fs.File.stdin();
     const stdout = std.fs.File.stdout();
@@ -17,6 +34,30 @@ pub fn main() !void {
     var reader = stdin.reader(&read_buffer);
     var writer = stdout.writer(&write_buffer);
 
+    if (cache_dir) |path| {
+        // The key covers the whole input, so it is read before rendering.
+        const max_bytes = std.math.mul(u64, cache_max_mb, 1024 * 1024) catch fail();
+        var cache = try octomark.RenderCache.open(allocator, path, max_bytes);
+        defer cache.close();
+        const input = try reader.interface.allocRemaining(allocator, .unlimited);
+        defer allocator.free(input);
+        try octomark.OctomarkParser.renderCached(&cache, allocator, input, options, &writer.interface);
+        if (show_stats) std.debug.print("render cache: {d} hits, {d} misses\n", .{ cache.hits, cache.misses });
+        try writer.interface.flush();
+        return;
+    }
+
+    var parser: octomark.OctomarkParser = undefined;
+    try parser.init(allocator);
+    defer parser.deinit(allocator);
+    parser.setOptions(options);
+
     try parser.parse(&reader.interface, &writer.interface, allocator);
     try writer.interface.flush();
+    if (show_stats) parser.dumpStats();
+}
+
+fn fail() noreturn {
+    std.debug.print(usage, .{});
+    std.process.exit(2);
 }
@@ -1,7 +1,17 @@
 const std = @import("std");
 const builtin = @import("builtin");
+const perfect_hash = @import("perfect_hash.zig");
+const emoji = @import("emoji.zig");
+pub const RenderCache = @import("render_cache.zig").RenderCache;
+/// Hash of the library sources, computed by the build; part of every render cache key, so a
+/// build with any change to the renderer never serves output cached by another.
+pub const source_hash: u64 = @import("build_options").source_hash;
 const MAX_BLOCK_NESTING = 32;
 const MAX_INLINE_NESTING = 32;
+const MAX_FOOTNOTE_LABEL = 255;
+const MAX_WIKI_LINK = 512;
+/// Longest leaf block source, in bytes, whose output `memo_entries` keeps.
+const MAX_MEMO_BLOCK = 4096;
 const BlockType = enum(u8) {
     unordered_list,
     ordered_list,
@@ -29,6 +39,18 @@ const block_close_tags = [_][]const u8{
     "</p>\n",
 };
 const TableAlignment = enum { none, left, center, right };
+const table_header_open_tags = [_][]const u8{
+    "<th>",
+    "<th style=\"text-align:left\">",
+    "<th style=\"text-align:center\">",
+    "<th style=\"text-align:right\">",
+};
+const table_data_open_tags = [_][]const u8{
+    "<td>",
+    "<td style=\"text-align:left\">",
+    "<td style=\"text-align:center\">",
+    "<td style=\"text-align:right\">",
+};
 const BlockEntry = struct {
     block_type: BlockType,
     indent_level: i32,
@@ -42,15 +64,366 @@ const BlockEntry = struct {
     list_start: u32 = 0,
 };
 const Buffer = std.ArrayListUnmanaged(u8);
+/// Writer adapter that appends rendered output to a `Buffer`.
+const BufferSink = struct {
+    list: *Buffer,
+    allocator: std.mem.Allocator,
+    /// Where wiki links written to `list` record their openings; only sinks that can receive
+    /// wiki links set it.
+    wiki_marks: ?*WikiMarks = null,
+    pub fn writeAll(self: BufferSink, bytes: []const u8) AllocError!void {
+        try self.list.appendSlice(self.allocator, bytes);
+    }
+    pub fn writeByte(self: BufferSink, byte: u8) AllocError!void {
+        try self.list.append(self.allocator, byte);
+    }
+};
+/// A wiki link opening tag waiting for the resolver: it goes before byte `offset` of the buffer
+/// the mark belongs to.
+const WikiMark = struct {
+    offset: usize,
+    page: u32,
+};
+const WikiMarks = std.ArrayListUnmanaged(WikiMark);
 const AllocError = std.mem.Allocator.Error;
 const ParseError = AllocError || std.fs.File.WriteError || error{
     NestingTooDeep,
-    TooManyTableColumns,
+    InvalidUtf8,
+};
+/// Handling of byte sequences in the input that are not valid UTF-8.
+pub const Utf8Policy = enum {
+    /// Fail `feed`/`finish` with error.InvalidUtf8.
+    reject,
+    /// Replace each maximal invalid subpart with U+FFFD.
+    replace,
+    /// Pass bytes through unchecked; inline parsing then decodes defensively.
+    pass_through,
+};
+/// Constructs compiled into a parser. Disabled constructs are removed entirely, including their
+/// first-byte dispatch, and their syntax renders as plain text.
+pub const Dialect = struct {
+    /// Raw HTML blocks and inline tags (further gated at runtime by `enable_html`).
+    html: bool = true,
+    /// `$...$` inline math and `$$` blocks.
+    math: bool = true,
+    tables: bool = true,
+    definition_lists: bool = true,
+    task_lists: bool = true,
+    /// GFM extended autolinks (`www.`, `http://`, `https://`, `ftp://` and bare emails). Off by
+    /// default since they change CommonMark output.
+    autolinks: bool = false,
+    /// GFM footnotes: `[^label]` references and `[^label]: text` definitions, listed at `finish`.
+    footnotes: bool = false,
+    /// `:shortcode:` emoji, expanded to their UTF-8 sequence.
+    emoji: bool = false,
+    /// `@user` mentions, `#123` and `owner/repo#123` issue references, and `#topic` hashtags,
+    /// linked through `OctomarkOptions.reference_resolver` and reported by `references()`.
+    references: bool = false,
+    /// `[[Page]]` and `[[Page|label]]` links, resolved in batches by `OctomarkOptions.wiki_resolver`.
+    wiki_links: bool = false,
+    /// Curly quotes, `--`/`---` as en/em dashes and `...` as an ellipsis in inline text.
+    smart_punctuation: bool = false,
+};
+/// A mention, issue reference or hashtag found while rendering.
+pub const Reference = struct {
+    pub const Kind = enum { mention, issue, hashtag };
+    kind: Kind,
+    /// As written, including the `@` or `#`: `@octocat`, `#123`, `owner/repo#45`, `#release`.
+    text: []const u8,
+};
+/// Maps references to hrefs. Each distinct reference is resolved at most once per document.
+pub const ReferenceResolver = struct {
+    context: ?*anyopaque = null,
+    /// Href for `ref`, or null to leave it as text. The href is copied before the next call.
+    resolve: *const fn (context: ?*anyopaque, ref: Reference) anyerror!?[]const u8,
+};
+/// Highlights fenced code blocks. Each block in a language the hook wants is delivered once:
+/// `begin` with the language, `line` for each raw (unescaped) body line without its newline, and
+/// `end`. The hook writes the HTML between `<pre><code ...>` and `</code></pre>` to `out`.
+pub const CodeHook = struct {
+    context: ?*anyopaque = null,
+    /// Whether blocks in `language` (the first word of the info string, possibly empty) go to the
+    /// hook. Declined blocks are escaped line by line as usual.
+    wants: *const fn (context: ?*anyopaque, language: []const u8) bool,
+    begin: *const fn (context: ?*anyopaque, language: []const u8, out: *std.Io.Writer) anyerror!void,
+    line: *const fn (context: ?*anyopaque, line: []const u8, out: *std.Io.Writer) anyerror!void,
+    end: *const fn (context: ?*anyopaque, out: *std.Io.Writer) anyerror!void,
+};
+/// Renders TeX for `$...$` spans and `$$` blocks. The output replaces the escaped source inside
+/// `<span class="math">` and `<div class="math">`. A parser calls it only from the thread driving
+/// it, since table rows stay off the worker pool while a hook is set, so the hook itself need not
+/// be thread-safe. Hooks of parsers on different threads may still run at once; `MathCache` is
+/// the part they can share.
+pub const MathHook = struct {
+    context: ?*anyopaque = null,
+    /// Write the HTML for the raw `tex` source to `out`; `display` is set for `$$` blocks.
+    render: *const fn (context: ?*anyopaque, tex: []const u8, display: bool, out: *std.Io.Writer) anyerror!void,
+};
+/// Hit and miss counts of a result cache.
+pub const CacheStats = struct {
+    hits: usize,
+    misses: usize,
+    pub fn hitRate(s: CacheStats) f64 {
+        const total = s.hits + s.misses;
+        return if (total == 0) 0 else @as(f64, @floatFromInt(s.hits)) / @as(f64, @floatFromInt(total));
+    }
+};
+/// Rendered math shared by any number of parsers and threads: a direct-mapped table keyed by a
+/// hash of the TeX and display mode, guarded by a mutex. A hit is confirmed against the stored
+/// TeX, and a colliding formula replaces the entry, so memory stays bounded by `capacity`
+/// formulas.
+pub const MathCache = struct {
+    allocator: std.mem.Allocator,
+    mutex: std.Thread.Mutex = .{},
+    entries: []Entry,
+    hits: usize = 0,
+    misses: usize = 0,
+    const Entry = struct {
+        hash: u64 = 0,
+        display: bool = false,
+        tex: []u8 = &.{},
+        html: []u8 = &.{},
+    };
+    pub const Stats = CacheStats;
+    pub fn init(allocator: std.mem.Allocator, capacity: usize) !MathCache {
+        const entries = try allocator.alloc(Entry, @max(capacity, 1));
+        @memset(entries, .{});
+        return .{ .allocator = allocator, .entries = entries };
+    }
+    pub fn deinit(self: *MathCache) void {
+        for (self.entries) |entry| {
+            self.allocator.free(entry.tex);
+            self.allocator.free(entry.html);
+        }
+        self.allocator.free(self.entries);
+    }
+    pub fn stats(self: *MathCache) Stats {
+        self.mutex.lock();
+        defer self.mutex.unlock();
+        return .{ .hits = self.hits, .misses = self.misses };
+    }
+    /// Append the cached HTML for `tex`, whose hash is `hash`, to `out`. Counts a hit or a miss.
+    fn lookup(self: *MathCache, hash: u64, tex: []const u8, display: bool, out: *Buffer, allocator: std.mem.Allocator) !bool {
+        self.mutex.lock();
+        defer self.mutex.unlock();
+        const entry = &self.entries[hash % self.entries.len];
+        if (entry.hash != hash or entry.html.len == 0 or entry.display != display or !std.mem.eql(u8, entry.tex, tex)) {
+            self.misses += 1;
+            return false;
+        }
+        self.hits += 1;
+        try out.appendSlice(allocator, entry.html);
+        return true;
+    }
+    fn store(self: *MathCache, hash: u64, tex: []const u8, display: bool, html: []const u8) !void {
+        const owned_tex = try self.allocator.dupe(u8, tex);
+        errdefer self.allocator.free(owned_tex);
+        const owned = try self.allocator.dupe(u8, html);
+        self.mutex.lock();
+        defer self.mutex.unlock();
+        const entry = &self.entries[hash % self.entries.len];
+        self.allocator.free(entry.tex);
+        self.allocator.free(entry.html);
+        entry.* = .{ .hash = hash, .display = display, .tex = owned_tex, .html = owned };
+    }
+};
+/// Part of the document a search token was taken from.
+pub const TokenField = enum { heading, body, code, link };
+/// A run of letters, digits and non-ASCII bytes from rendered text.
+pub const Token = struct {
+    /// Slice of the parser's normalized input; valid only during the callback.
+    text: []const u8,
+    /// Byte offset of `text` in the input as fed, before normalization. A token holding a
+    /// replaced byte (U+FFFD) may span a different number of raw bytes than `text.len`.
+    offset: usize,
+    field: TokenField,
+};
+/// Receives search tokens in document order as text is rendered.
+pub const TokenSink = struct {
+    context: ?*anyopaque = null,
+    token: *const fn (context: ?*anyopaque, token: Token) anyerror!void,
+};
+/// Counts over the visible text of a rendered document. Markup, URLs, raw HTML and image
+/// descriptions are not counted.
+pub const DocumentStats = struct {
+    words: usize = 0,
+    /// Code points of visible inline text, spaces included.
+    characters: usize = 0,
+    /// Lines of fenced and indented code blocks.
+    code_lines: usize = 0,
+    images: usize = 0,
+    links: usize = 0,
+    /// Whole minutes to read `words` at `words_per_minute`, rounded up; 0 for a rate of 0.
+    pub fn readingMinutes(s: DocumentStats, words_per_minute: usize) usize {
+        if (words_per_minute == 0) return 0;
+        return (s.words + words_per_minute - 1) / words_per_minute;
+    }
+};
+/// A distinct wiki link target, handed to `WikiResolver`.
+pub const WikiPage = struct {
+    /// Page name as written, trimmed.
+    target: []const u8,
+    /// Set by the resolver; the link points at `target` itself when left null.
+    href: ?[]const u8 = null,
+    /// Cleared by the resolver for missing pages, which get `class="wiki new"`.
+    exists: bool = true,
+};
+/// Resolves wiki link targets in batches: every page first linked since the previous call is
+/// passed at once, so a document below `wiki_batch_bytes` of output costs a single call.
+pub const WikiResolver = struct {
+    context: ?*anyopaque = null,
+    /// Fill in `href` and `exists` for each page. Hrefs are copied when the call returns.
+    resolve: *const fn (context: ?*anyopaque, pages: []WikiPage) anyerror!void,
+};
+/// Front matter found at the start of the input. Offsets index the input as fed, before
+/// normalization, so the caller can slice its own buffer without a copy.
+pub const FrontMatter = struct {
+    pub const Kind = enum { yaml, toml };
+    kind: Kind,
+    /// Raw content between the fence lines.
+    start: usize,
+    end: usize,
+    /// Just past the closing fence line, where Markdown parsing begins.
+    block_end: usize,
+};
+/// A top-level block boundary where rendering can resume with a fresh parser: nothing is open
+/// and no later output depends on earlier lines.
+pub const Checkpoint = struct {
+    /// Offset of the block's first line in the input as fed, before normalization.
+    offset: u64,
+    /// Top-level blocks before this one.
+    block: u64,
+    const magic = "OMCK\x01";
+    /// Write checkpoints as a side file: a magic and version, the count, then each offset and
+    /// block as a LEB128 delta from the previous checkpoint. Entries take 3 to 4 bytes at
+    /// typical intervals.
+    pub fn writeIndex(checkpoints: []const Checkpoint, w: *std.Io.Writer) std.Io.Writer.Error!void {
+        try w.writeAll(magic);
+        try writeLeb128(w, checkpoints.len);
+        var prev: Checkpoint = .{ .offset = 0, .block = 0 };
+        for (checkpoints) |cp| {
+            try writeLeb128(w, cp.offset - prev.offset);
+            try writeLeb128(w, cp.block - prev.block);
+            prev = cp;
+        }
+    }
+    /// Decode a side file written by `writeIndex`. The caller owns the returned slice.
+    pub fn readIndex(allocator: std.mem.Allocator, bytes: []const u8) (AllocError || error{InvalidCheckpointIndex})![]Checkpoint {
+        if (!std.mem.startsWith(u8, bytes, magic)) return error.InvalidCheckpointIndex;
+        var pos: usize = magic.len;
+        const count = try readLeb128(bytes, &pos);
+        // Every entry takes at least two bytes, which bounds the allocation for corrupt counts.
+        if (count > (bytes.len - pos) / 2) return error.InvalidCheckpointIndex;
+        const checkpoints = try allocator.alloc(Checkpoint, @intCast(count));
+        errdefer allocator.free(checkpoints);
+        var prev: Checkpoint = .{ .offset = 0, .block = 0 };
+        for (checkpoints) |*cp| {
+            cp.* = .{
+                .offset = std.math.add(u64, prev.offset, try readLeb128(bytes, &pos)) catch return error.InvalidCheckpointIndex,
+                .block = std.math.add(u64, prev.block, try readLeb128(bytes, &pos)) catch return error.InvalidCheckpointIndex,
+            };
+            prev = cp.*;
+        }
+        return checkpoints;
+    }
+    /// The last checkpoint at or before `block`, where rendering for it starts.
+    pub fn find(checkpoints: []const Checkpoint, block: u64) ?Checkpoint {
+        var lo: usize = 0;
+        var hi = checkpoints.len;
+        while (lo < hi) {
+            const mid = lo + (hi - lo) / 2;
+            if (checkpoints[mid].block <= block) lo = mid + 1 else hi = mid;
+        }
+        return if (lo > 0) checkpoints[lo - 1] else null;
+    }
 };
+fn writeLeb128(w: *std.Io.Writer, value: u64) std.Io.Writer.Error!void {
+    var v = value;
+    while (v >= 0x80) : (v >>= 7) try w.writeByte(@as(u8, @truncate(v)) | 0x80);
+    try w.writeByte(@intCast(v));
+}
+fn readLeb128(bytes: []const u8, pos: *usize) error{InvalidCheckpointIndex}!u64 {
+    var value: u64 = 0;
+    var shift: u7 = 0;
+    while (pos.* < bytes.len and shift < 64) : (shift += 7) {
+        const b = bytes[pos.*];
+        pos.* += 1;
+        value |= @as(u64, b & 0x7F) << @intCast(shift);
+        if (b < 0x80) return value;
+    }
+    return error.InvalidCheckpointIndex;
+}
+/// Options that do not change the HTML, left out of render cache keys.
+fn isOutputNeutral(comptime name: []const u8) bool {
+    const neutral = [_][]const u8{
+        "table_threads",
+        "table_batch_rows",
+        "wiki_batch_bytes",
+        "code_cache_entries",
+        "math_cache",
+        "document_stats",
+        "token_sink",
+        "checkpoint_interval",
+        "memo_entries",
+    };
+    for (neutral) |n| if (std.mem.eql(u8, n, name)) return true;
+    return false;
+}
 pub const OctomarkOptions = struct {
     enable_html: bool = true,
+    /// Collapse CRLF and lone CR to LF and replace NUL with U+FFFD as chunks are fed, so later
+    /// stages only ever see LF-terminated lines.
+    normalize_input: bool = true,
+    /// Filter raw HTML through the tag and attribute allowlists and empty dangerous link URLs while
+    /// rendering, so the output is safe to publish without a separate sanitizer.
+    sanitize: bool = false,
+    /// Skip a leading YAML (`---`) or TOML (`+++`) front-matter block instead of rendering it; its
+    /// byte range is available from `frontMatter()`.
+    front_matter: bool = false,
+    /// Validation of input UTF-8, performed in the same pass as normalization.
+    utf8_policy: Utf8Policy = .replace,
+    /// Worker threads that render top-level table bodies in row batches; 0 renders rows inline.
+    /// The parser allocator must be thread-safe when this is non-zero. Rows are rendered inline
+    /// whenever a hook, resolver or sink is set, so callbacks are only ever called from the thread
+    /// driving the parser.
+    table_threads: usize = 0,
+    /// Table body rows collected before a batch is rendered.
+    table_batch_rows: usize = 1024,
+    /// Links references for the `references` dialect; without it they are only reported.
+    reference_resolver: ?ReferenceResolver = null,
+    /// Resolves targets for the `wiki_links` dialect; without it every page exists at its own name.
+    wiki_resolver: ?WikiResolver = null,
+    /// Output held after the first wiki link before the pending targets are resolved and the
+    /// output is flushed; otherwise everything is flushed at `finish`.
+    wiki_batch_bytes: usize = 1 << 20,
+    /// Highlighter for fenced code blocks.
+    code_hook: ?CodeHook = null,
+    /// Hook results kept by hash of language and body, so repeated blocks skip the hook; 0
+    /// disables the cache.
+    code_cache_entries: usize = 64,
+    /// Renderer for math spans and blocks.
+    math_hook: ?MathHook = null,
+    /// Cache for `math_hook` results, typically shared by every parser in the process.
+    math_cache: ?*MathCache = null,
+    /// Collect `documentStats()` while rendering.
+    document_stats: bool = false,
+    /// Record a `Checkpoint` at the first top-level block boundary at least this many input bytes
+    /// after the previous one; 0 records none.
+    checkpoint_interval: usize = 0,
+    /// Output of paragraphs, ATX headings and table rows kept by hash of their source, so an
+    /// identical block later in the document replays it instead of being parsed again; 0
+    /// disables. Blocks over 4 KB are always parsed.
+    memo_entries: usize = 0,
+    /// Receives the words of headings, text, code and link labels with their input offsets, for
+    /// full-text indexing without re-tokenizing the HTML.
+    token_sink: ?TokenSink = null,
 };
-const special_chars = "\\['*`&<>\"'_~!$\n";
+/// Bytes that stop the plain-text scan in inline parsing; `$` only when math is enabled, `-` and
+/// `.` only with smart punctuation.
+fn specialChars(comptime dialect: Dialect) []const u8 {
+    const base = if (dialect.math) "\\['*`&<>\"'_~!$\n" else "\\['*`&<>\"'_~!\n";
+    return if (dialect.smart_punctuation) base ++ "-." else base;
+}
 const punct_symbol_ranges = [_][2]u32{
     .{ 0x00A1, 0x00BF },
     .{ 0x2000, 0x206F },
@@ -99,6 +472,411 @@ const html_escape_map = blk: {
     map['\''] = "&#39;";
     break :blk map;
 };
+/// Block parsers that can possibly match a line, keyed by its first non-space byte.
+const BlockStart = struct {
+    const list: u8 = 1 << 0;
+    const definition: u8 = 1 << 1;
+    const thematic: u8 = 1 << 2;
+    const setext: u8 = 1 << 3;
+    const quote: u8 = 1 << 4;
+    const leaf: u8 = 1 << 5;
+};
+/// Candidate bytes that only inline extensions look at: `:`, `.` and `@` for extended
+/// autolinks, `:` for emoji shortcodes, and `@` and `#` for references.
+fn extensionCandidates(comptime dialect: Dialect) []const u8 {
+    var stops: []const u8 = "";
+    if (dialect.autolinks or dialect.emoji) stops = stops ++ ":";
+    if (dialect.autolinks) stops = stops ++ ".";
+    if (dialect.autolinks or dialect.references) stops = stops ++ "@";
+    if (dialect.references) stops = stops ++ "#";
+    return stops;
+}
+/// Index of the next byte at or after `start` that `scanInline` has to look at, or `bytes.len`.
+fn indexOfInlineCandidate(bytes: []const u8, start: usize, comptime dialect: Dialect) usize {
+    const stops = "*_`~<\\[!" ++ comptime extensionCandidates(dialect);
+    const V = @Vector(16, u8);
+    var i = start;
+    while (i + 16 <= bytes.len) : (i += 16) {
+        const v: V = bytes[i..][0..16].*;
+        var mask: u16 = 0;
+        inline for (stops) |c| mask |= @as(u16, @bitCast(v == @as(V, @splat(c))));
+        if (mask != 0) return i + @ctz(mask);
+    }
+    return std.mem.indexOfAnyPos(u8, bytes, i, stops) orelse bytes.len;
+}
+
+const emoji_names = names: {
+    @setEvalBranchQuota(emoji.entries.len * 4);
+    var names: [emoji.entries.len][]const u8 = undefined;
+    for (emoji.entries, 0..) |entry, k| names[k] = entry[0];
+    break :names names;
+};
+const emoji_shortcodes = perfect_hash.Set(&emoji_names);
+const EmojiMatch = struct {
+    /// UTF-8 sequence to emit.
+    glyph: []const u8,
+    /// Just past the closing colon.
+    end: usize,
+};
+/// Match an emoji shortcode `:name:` whose opening colon is at `i`. The name scan is bounded by
+/// the longest known shortcode, so runs of colons stay linear.
+fn matchEmoji(text: []const u8, i: usize) ?EmojiMatch {
+    const limit = @min(text.len, i + 2 + emoji_shortcodes.max_len);
+    var j = i + 1;
+    while (j < limit and isShortcodeChar(text[j])) j += 1;
+    if (j == limit or text[j] != ':') return null;
+    const k = emoji_shortcodes.index(text[i + 1 .. j]) orelse return null;
+    return .{ .glyph = emoji.entries[k][1], .end = j + 1 };
+}
+fn isShortcodeChar(c: u8) bool {
+    return std.ascii.isLower(c) or std.ascii.isDigit(c) or c == '_' or c == '+' or c == '-';
+}
+/// Bytes of search tokens: ASCII letters and digits, and every byte of a non-ASCII sequence.
+fn isTokenByte(c: u8) bool {
+    return std.ascii.isAlphanumeric(c) or c >= 0x80;
+}
+
+const ReferenceMatch = struct {
+    kind: Reference.Kind,
+    start: usize,
+    end: usize,
+};
+/// Match a reference at the sigil `i`: `@user` or `@org/team`, `#123` or `owner/repo#123`, or a
+/// `#topic` hashtag. The reference has to start after whitespace, `(` or an emphasis delimiter,
+/// and an `owner/repo` prefix is looked for no further back than `floor`.
+fn matchReference(text: []const u8, i: usize, floor: usize) ?ReferenceMatch {
+    var end = referenceNameEnd(text, i + 1);
+    if (end == i + 1 or !std.ascii.isAlphanumeric(text[i + 1])) return null;
+    if (text[i] == '@') {
+        if (!isAutolinkBoundary(text, i)) return null;
+        if (end + 1 < text.len and text[end] == '/' and std.ascii.isAlphanumeric(text[end + 1])) {
+            end = referenceNameEnd(text, end + 1);
+        }
+        return .{ .kind = .mention, .start = i, .end = end };
+    }
+    const number = for (text[i + 1 .. end]) |c| {
+        if (!std.ascii.isDigit(c)) break false;
+    } else true;
+    if (!number) {
+        if (!std.ascii.isAlphabetic(text[i + 1]) or !isAutolinkBoundary(text, i)) return null;
+        return .{ .kind = .hashtag, .start = i, .end = end };
+    }
+    if (isAutolinkBoundary(text, i)) return .{ .kind = .issue, .start = i, .end = end };
+    var slash = i;
+    while (slash > floor and isRepoChar(text[slash - 1])) slash -= 1;
+    if (slash == i or slash == floor or text[slash - 1] != '/') return null;
+    var start = slash - 1;
+    while (start > floor and isReferenceChar(text[start - 1])) start -= 1;
+    if (start == slash - 1 or !isAutolinkBoundary(text, start)) return null;
+    return .{ .kind = .issue, .start = start, .end = end };
+}
+/// End of a user, team or tag name starting at `start`. Trailing `_` and `-` are left out so a
+/// closing emphasis delimiter still matches.
+fn referenceNameEnd(text: []const u8, start: usize) usize {
+    var end = start;
+    while (end < text.len and isReferenceChar(text[end])) end += 1;
+    while (end > start and (text[end - 1] == '_' or text[end - 1] == '-')) end -= 1;
+    return end;
+}
+fn isReferenceChar(c: u8) bool {
+    return std.ascii.isAlphanumeric(c) or c == '-' or c == '_';
+}
+fn isRepoChar(c: u8) bool {
+    return isReferenceChar(c) or c == '.';
+}
+
+const WikiLinkMatch = struct {
+    target: []const u8,
+    /// Text after `|`, rendered as inline Markdown; the target is shown as-is without it.
+    label: ?[]const u8,
+    end: usize,
+};
+/// Match `[[target]]` or `[[target|label]]` at `i`. Neither part may contain brackets or a
+/// newline, and the search for `]]` is bounded, so unclosed `[[` stays linear.
+fn matchWikiLink(text: []const u8, i: usize) ?WikiLinkMatch {
+    if (i + 1 >= text.len or text[i + 1] != '[') return null;
+    const limit = @min(text.len, i + 4 + MAX_WIKI_LINK);
+    const close = std.mem.indexOfPos(u8, text[0..limit], i + 2, "]]") orelse return null;
+    const inner = text[i + 2 .. close];
+    if (std.mem.indexOfAny(u8, inner, "[]\n") != null) return null;
+    const bar = std.mem.indexOfScalar(u8, inner, '|');
+    const target = std.mem.trim(u8, inner[0 .. bar orelse inner.len], " \t");
+    if (target.len == 0) return null;
+    var label: ?[]const u8 = null;
+    if (bar) |b| {
+        const l = std.mem.trim(u8, inner[b + 1 ..], " \t");
+        if (l.len > 0) label = l;
+    }
+    return .{ .target = target, .label = label, .end = close + 2 };
+}
+
+/// Scripts written without spaces, where each ideograph or kana counts as a word.
+fn isIdeograph(c: u32) bool {
+    return (c >= 0x3040 and c <= 0x30FF) or (c >= 0x3400 and c <= 0x4DBF) or (c >= 0x4E00 and c <= 0x9FFF) or
+        (c >= 0xF900 and c <= 0xFAFF) or (c >= 0x20000 and c <= 0x2FFFF);
+}
+
+const ExtendedAutolink = struct {
+    start: usize,
+    end: usize,
+    /// Prepended to the href.
+    prefix: []const u8,
+};
+/// Match a GFM extended autolink around the candidate byte at `i` (the `:` of `scheme://`, the
+/// `.` of `www.`, or the `@` of an email), looking back no further than `floor`.
+fn matchExtendedAutolink(text: []const u8, i: usize, floor: usize) ?ExtendedAutolink {
+    switch (text[i]) {
+        ':' => {
+            if (i + 2 >= text.len or text[i + 1] != '/' or text[i + 2] != '/') return null;
+            const start = for ([_][]const u8{ "https", "http", "ftp" }) |scheme| {
+                if (i >= floor + scheme.len and std.ascii.eqlIgnoreCase(text[i - scheme.len .. i], scheme)) break i - scheme.len;
+            } else return null;
+            if (!isAutolinkBoundary(text, start)) return null;
+            const end = extendedAutolinkEnd(text, i + 3) orelse return null;
+            return .{ .start = start, .end = end, .prefix = "" };
+        },
+        '.' => {
+            if (i < floor + 3 or !std.ascii.eqlIgnoreCase(text[i - 3 .. i], "www")) return null;
+            if (!isAutolinkBoundary(text, i - 3)) return null;
+            const end = extendedAutolinkEnd(text, i - 3) orelse return null;
+            return .{ .start = i - 3, .end = end, .prefix = "http://" };
+        },
+        '@' => {
+            var start = i;
+            while (start > floor and isEmailLocalChar(text[start - 1])) start -= 1;
+            if (start == i) return null;
+            var end = i + 1;
+            while (end < text.len and isDomainChar(text[end])) end += 1;
+            while (end > i + 1 and text[end - 1] == '.') end -= 1;
+            if (end == i + 1 or text[end - 1] == '-' or text[end - 1] == '_') return null;
+            if (std.mem.indexOfScalar(u8, text[i + 1 .. end], '.') == null) return null;
+            return .{ .start = start, .end = end, .prefix = "mailto:" };
+        },
+        else => return null,
+    }
+}
+fn isAutolinkBoundary(text: []const u8, start: usize) bool {
+    if (start == 0) return true;
+    return switch (text[start - 1]) {
+        ' ', '\t', '\n', '\r', '*', '_', '~', '(' => true,
+        else => false,
+    };
+}
+fn isDomainChar(c: u8) bool {
+    return std.ascii.isAlphanumeric(c) or c == '-' or c == '_' or c == '.';
+}
+fn isEmailLocalChar(c: u8) bool {
+    return std.ascii.isAlphanumeric(c) or c == '.' or c == '-' or c == '_' or c == '+';
+}
+/// End of an extended autolink whose domain starts at `domain_start`, or null without a valid
+/// domain. The link runs to whitespace or `<`; trailing punctuation, unmatched closing
+/// parentheses and a trailing entity reference are left out, all settled in one forward pass.
+fn extendedAutolinkEnd(text: []const u8, domain_start: usize) ?usize {
+    var domain_end = domain_start;
+    while (domain_end < text.len and isDomainChar(text[domain_end])) domain_end += 1;
+    var domain = text[domain_start..domain_end];
+    while (domain.len > 0 and (domain[domain.len - 1] == '.' or domain[domain.len - 1] == '_')) domain = domain[0 .. domain.len - 1];
+    // At least one period, and no underscore in the last two segments.
+    const last_dot = std.mem.lastIndexOfScalar(u8, domain, '.') orelse return null;
+    const prev_dot = std.mem.lastIndexOfScalar(u8, domain[0..last_dot], '.') orelse 0;
+    if (std.mem.indexOfScalar(u8, domain[prev_dot..], '_') != null) return null;
+
+    var end = domain_start;
+    var parens: isize = 0;
+    var amp: ?usize = null;
+    var amp_end: usize = 0;
+    var k = domain_start;
+    while (k < text.len and text[k] > ' ' and text[k] != '<') : (k += 1) {
+        const c = text[k];
+        switch (c) {
+            '?', '!', '.', ',', ':', '*', '_', '~' => {},
+            '(' => {
+                parens += 1;
+                end = k + 1;
+            },
+            ')' => {
+                parens -= 1;
+                if (parens >= 0) end = k + 1;
+            },
+            '&' => {
+                amp = k;
+                amp_end = end;
+                end = k + 1;
+            },
+            ';' => end = if (amp != null and k > amp.? + 1) amp_end else k + 1,
+            else => end = k + 1,
+        }
+        if (c != '&' and !std.ascii.isAlphanumeric(c)) amp = null;
+    }
+    return if (end > domain_start + last_dot) end else null;
+}
+
+/// Byte classes for URLs written into attributes; runs of `.safe` bytes are copied verbatim.
+const UrlClass = enum(u8) { safe, encode, quote, ampersand, percent, backslash };
+const url_class_table = blk: {
+    var table = [_]UrlClass{.encode} ** 256;
+    for ("abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789-._~!$()*+,;=:@/?#") |c| table[c] = .safe;
+    table['\''] = .quote;
+    table['&'] = .ampersand;
+    table['%'] = .percent;
+    table['\\'] = .backslash;
+    break :blk table;
+};
+fn byteRangeMask(v: @Vector(16, u8), lo: u8, hi: u8) u16 {
+    const V = @Vector(16, u8);
+    return @as(u16, @bitCast(v >= @as(V, @splat(lo)))) & @as(u16, @bitCast(v <= @as(V, @splat(hi))));
+}
+/// Index of the first byte at or after `start` that is not `.safe` in `url_class_table`, or
+/// `bytes.len`. The vector path tests the safe set as four ranges and four single bytes.
+fn indexOfUrlUnsafe(bytes: []const u8, start: usize) usize {
+    const V = @Vector(16, u8);
+    var i = start;
+    while (i + 16 <= bytes.len) : (i += 16) {
+        const v: V = bytes[i..][0..16].*;
+        const safe = byteRangeMask(v, '#', '$') | byteRangeMask(v, '(', ';') | byteRangeMask(v, '?', 'Z') |
+            byteRangeMask(v, 'a', 'z') | @as(u16, @bitCast(v == @as(V, @splat('!')))) |
+            @as(u16, @bitCast(v == @as(V, @splat('=')))) | @as(u16, @bitCast(v == @as(V, @splat('_')))) |
+            @as(u16, @bitCast(v == @as(V, @splat('~'))));
+        if (safe != 0xFFFF) return i + @ctz(~safe);
+    }
+    while (i < bytes.len and url_class_table[bytes[i]] == .safe) i += 1;
+    return i;
+}
+fn percentEscape(c: u8) [3]u8 {
+    const hex = "0123456789ABCDEF";
+    return .{ '%', hex[c >> 4], hex[c & 0xF] };
+}
+/// Tags and attributes kept by `sanitize`; everything else is dropped.
+const sanitize_tags = perfect_hash.Set(&.{
+    "a",       "abbr", "b",        "bdo",        "blockquote", "br",      "caption", "cite",
+    "code",    "col",  "colgroup", "dd",         "del",        "details", "dfn",     "div",
+    "dl",      "dt",   "em",       "figcaption", "figure",     "h1",      "h2",      "h3",
+    "h4",      "h5",   "h6",       "hr",         "i",          "img",     "ins",     "kbd",
+    "li",      "mark", "ol",       "p",          "pre",        "q",       "rp",      "rt",
+    "ruby",    "s",    "samp",     "small",      "span",       "strike",  "strong",  "sub",
+    "summary", "sup",  "table",    "tbody",      "td",         "tfoot",   "th",      "thead",
+    "time",    "tr",   "tt",       "u",          "ul",         "var",     "wbr",
+});
+const sanitize_attributes = perfect_hash.Set(&.{
+    "abbr",    "align", "alt",  "cite",    "colspan", "datetime", "dir", "height",
+    "href",    "lang",  "open", "rowspan", "scope",   "span",     "src", "start",
+    "summary", "title", "type", "valign",  "width",
+});
+fn isAttributeNameChar(c: u8) bool {
+    return std.ascii.isAlphanumeric(c) or c == '_' or c == '.' or c == ':' or c == '-';
+}
+fn isUrlAttribute(name: []const u8) bool {
+    return std.ascii.eqlIgnoreCase(name, "href") or std.ascii.eqlIgnoreCase(name, "src") or
+        std.ascii.eqlIgnoreCase(name, "cite") or std.ascii.eqlIgnoreCase(name, "action") or
+        std.ascii.eqlIgnoreCase(name, "formaction");
+}
+/// Whether `url` has a javascript:, vbscript: or file: scheme, or is data: other than a common
+/// image type. The check runs on the URL's canonical prefix (see `canonicalUrlPrefix`), so a
+/// scheme obfuscated with entities, escapes or control characters is seen as the browser sees it.
+fn isDangerousUrl(url: []const u8) bool {
+    var buf: [32]u8 = undefined;
+    const canon = canonicalUrlPrefix(url, &buf);
+    const colon = for (canon, 0..) |c, k| {
+        if (c == ':') break k;
+        if (c == '/' or c == '?' or c == '#') return false;
+    } else return false;
+    const scheme = canon[0..colon];
+    for (scheme) |c| {
+        if (!(std.ascii.isAlphanumeric(c) or c == '+' or c == '-' or c == '.')) return true;
+    }
+    if (std.mem.eql(u8, scheme, "data")) {
+        const rest = canon[colon + 1 ..];
+        for ([_][]const u8{ "image/png", "image/gif", "image/jpeg", "image/webp" }) |t| {
+            if (std.mem.startsWith(u8, rest, t)) return false;
+        }
+        return true;
+    }
+    return std.mem.eql(u8, scheme, "javascript") or std.mem.eql(u8, scheme, "vbscript") or
+        std.mem.eql(u8, scheme, "file");
+}
+/// The start of `url` as a browser resolves it, lowercased, in `buf`: character references
+/// (numeric with or without `;`, and the named ones that can form a scheme), `%XX` escapes and
+/// backslash escapes are decoded, and ASCII whitespace and control characters are dropped. A
+/// reference it cannot decode keeps its `&`, which is not a scheme character, so the URL errs
+/// toward dangerous.
+fn canonicalUrlPrefix(url: []const u8, buf: []u8) []const u8 {
+    var n: usize = 0;
+    var i: usize = 0;
+    while (i < url.len and n < buf.len) {
+        var c = url[i];
+        i += 1;
+        switch (c) {
+            '&' => if (decodeUrlReference(url[i..])) |ref| {
+                c = ref.byte;
+                i += ref.len;
+            },
+            '%' => if (i + 1 < url.len and std.ascii.isHex(url[i]) and std.ascii.isHex(url[i + 1])) {
+                c = std.fmt.parseInt(u8, url[i .. i + 2], 16) catch unreachable;
+                i += 2;
+            },
+            '\\' => if (i < url.len and std.ascii.isPrint(url[i]) and
+                !std.ascii.isAlphanumeric(url[i]) and url[i] != ' ')
+            {
+                c = url[i];
+                i += 1;
+            },
+            else => {},
+        }
+        if (c <= ' ' or c == 0x7F) continue;
+        buf[n] = std.ascii.toLower(c);
+        n += 1;
+    }
+    return buf[0..n];
+}
+/// The ASCII byte of the character reference after an `&`, and the bytes it spans. References to
+/// non-ASCII code points return 0x80, which is not a scheme character either.
+fn decodeUrlReference(text: []const u8) ?struct { byte: u8, len: usize } {
+    if (text.len > 0 and text[0] == '#') {
+        var j: usize = 1;
+        const hex = j < text.len and (text[j] | 0x20) == 'x';
+        if (hex) j += 1;
+        const digits = j;
+        var cp: u32 = 0;
+        while (j < text.len) : (j += 1) {
+            const d = std.fmt.charToDigit(text[j], if (hex) 16 else 10) catch break;
+            cp = @min(cp *| (if (hex) @as(u32, 16) else 10) +| d, 0x110000);
+        }
+        if (j == digits) return null;
+        if (j < text.len and text[j] == ';') j += 1;
+        return .{ .byte = if (cp < 0x80) @intCast(cp) else 0x80, .len = j };
+    }
+    const names = [_]struct { []const u8, u8 }{
+        .{ "colon;", ':' },
+        .{ "Tab;", '\t' },
+        .{ "NewLine;", '\n' },
+        .{ "sol;", '/' },
+        .{ "quest;", '?' },
+        .{ "num;", '#' },
+        .{ "period;", '.' },
+        .{ "plus;", '+' },
+        .{ "amp;", '&' },
+        .{ "amp", '&' },
+    };
+    for (names) |entry| {
+        if (std.mem.startsWith(u8, text, entry[0])) return .{ .byte = entry[1], .len = entry[0].len };
+    }
+    return null;
+}
+/// First-byte dispatch for `dialect`; bytes that only start disabled constructs stay clear.
+fn blockStartTable(comptime dialect: Dialect) [256]u8 {
+    var table = [_]u8{0} ** 256;
+    for ("-*+0123456789") |c| table[c] |= BlockStart.list;
+    if (dialect.definition_lists) table[':'] |= BlockStart.definition;
+    for ("-*_") |c| table[c] |= BlockStart.thematic;
+    for ("=-") |c| table[c] |= BlockStart.setext;
+    table['>'] |= BlockStart.quote;
+    for ("#`~-*_>") |c| table[c] |= BlockStart.leaf;
+    if (dialect.math) table['$'] |= BlockStart.leaf;
+    if (dialect.tables) table['|'] |= BlockStart.leaf;
+    if (dialect.html) table['<'] |= BlockStart.leaf;
+    if (dialect.footnotes) table['['] |= BlockStart.leaf;
+    return table;
+}
 
 fn leadingIndent(line: []const u8) struct { idx: usize, columns: usize } {
     if (line.len == 0 or (line[0] != ' ' and line[0] != '\t' and line[0] != '\r')) return .{ .idx = 0, .columns = 0 };
@@ -113,6 +891,160 @@ fn leadingIndent(line: []const u8) struct { idx: usize, columns: usize } {
     return .{ .idx = idx, .columns = columns };
 }
 
+/// Index of the first byte at or after `start` that the input stage must look at (CR and NUL when
+/// `newlines`, non-ASCII when `utf8`), or `bytes.len`.
+fn indexOfInputSpecial(bytes: []const u8, start: usize, newlines: bool, utf8: bool) usize {
+    const V = @Vector(16, u8);
+    var i = start;
+    while (i + 16 <= bytes.len) : (i += 16) {
+        const v: V = bytes[i..][0..16].*;
+        var mask: u16 = 0;
+        if (newlines) mask |= @as(u16, @bitCast(v == @as(V, @splat('\r')))) | @as(u16, @bitCast(v == @as(V, @splat(0))));
+        if (utf8) mask |= @as(u16, @bitCast(v >= @as(V, @splat(0x80))));
+        if (mask != 0) return i + @ctz(mask);
+    }
+    while (i < bytes.len) : (i += 1) {
+        const c = bytes[i];
+        if ((newlines and (c == '\r' or c == 0)) or (utf8 and c >= 0x80)) return i;
+    }
+    return bytes.len;
+}
+
+/// End of the run of whole 16-byte blocks from `start` (a sequence boundary) that are valid
+/// UTF-8, backed off to the last sequence boundary. With `newlines`, a block holding CR or NUL
+/// ends the run, as those are rewritten. Every lane is classified at once, with the one to three
+/// preceding bytes shifted in from the previous block:
+/// - a byte is a continuation exactly when a lead 1, 2 or 3 bytes back demands one;
+/// - C0, C1 and F5-FF never occur;
+/// - the byte after E0, ED, F0 or F4 is range-limited (overlongs, surrogates, above U+10FFFF).
+/// The scalar check takes over at the first failing block for exact replacement.
+fn validUtf8Run(bytes: []const u8, start: usize, newlines: bool) usize {
+    const V = @Vector(16, u8);
+    const S = struct {
+        fn mask(b: @Vector(16, bool)) u16 {
+            return @bitCast(b);
+        }
+        /// Lanes shifted right by `n`, filled from the end of `prev`.
+        fn back(v: V, prev: V, comptime n: i32) V {
+            comptime var m: [16]i32 = undefined;
+            inline for (0..16) |k| {
+                const lane: i32 = k;
+                m[k] = if (lane >= n) lane - n else ~(16 - n + lane);
+            }
+            return @shuffle(u8, v, prev, m);
+        }
+        fn splat(c: u8) V {
+            return @splat(c);
+        }
+    };
+    var prev: V = @splat(0);
+    var i = start;
+    while (i + 16 <= bytes.len) : (i += 16) {
+        const v: V = bytes[i..][0..16].*;
+        if (newlines and S.mask(v == S.splat('\r')) | S.mask(v == S.splat(0)) != 0) break;
+        const p1 = S.back(v, prev, 1);
+        const p2 = S.back(v, prev, 2);
+        const p3 = S.back(v, prev, 3);
+        const cont = S.mask((v & S.splat(0xC0)) == S.splat(0x80));
+        const need = S.mask(p1 >= S.splat(0xC0)) | S.mask(p2 >= S.splat(0xE0)) | S.mask(p3 >= S.splat(0xF0));
+        var bad = (cont ^ need) | S.mask(v >= S.splat(0xF5)) | S.mask((v & S.splat(0xFE)) == S.splat(0xC0));
+        bad |= S.mask(p1 == S.splat(0xE0)) & S.mask(v < S.splat(0xA0));
+        bad |= S.mask(p1 == S.splat(0xED)) & S.mask(v >= S.splat(0xA0));
+        bad |= S.mask(p1 == S.splat(0xF0)) & S.mask(v < S.splat(0x90));
+        bad |= S.mask(p1 == S.splat(0xF4)) & S.mask(v >= S.splat(0x90));
+        if (bad != 0) break;
+        prev = v;
+    }
+    // The continuations of a sequence opened in the last block were not checked.
+    var k: usize = 1;
+    while (k <= 3 and k <= i - start) : (k += 1) {
+        const b = bytes[i - k];
+        if (b < 0x80) break;
+        if (b >= 0xC0) {
+            const len: usize = if (b >= 0xF0) 4 else if (b >= 0xE0) 3 else 2;
+            if (len > k) return i - k;
+            break;
+        }
+    }
+    return i;
+}
+
+const Utf8Check = union(enum) {
+    valid: u3,
+    /// Length of the maximal subpart to replace.
+    invalid: u3,
+    incomplete,
+};
+
+/// Check the UTF-8 sequence at the start of `bytes` (Unicode Table 3-7), rejecting overlongs,
+/// surrogates and code points above U+10FFFF.
+fn checkUtf8Sequence(bytes: []const u8) Utf8Check {
+    const b0 = bytes[0];
+    const len: usize = switch (b0) {
+        0x00...0x7F => return .{ .valid = 1 },
+        0xC2...0xDF => 2,
+        0xE0...0xEF => 3,
+        0xF0...0xF4 => 4,
+        else => return .{ .invalid = 1 },
+    };
+    const lo: u8 = switch (b0) {
+        0xE0 => 0xA0,
+        0xF0 => 0x90,
+        else => 0x80,
+    };
+    const hi: u8 = switch (b0) {
+        0xED => 0x9F,
+        0xF4 => 0x8F,
+        else => 0xBF,
+    };
+    var k: usize = 1;
+    while (k < len) : (k += 1) {
+        if (k >= bytes.len) return .incomplete;
+        const b = bytes[k];
+        const ok = if (k == 1) (b >= lo and b <= hi) else (b >= 0x80 and b <= 0xBF);
+        if (!ok) return .{ .invalid = @intCast(k) };
+    }
+    return .{ .valid = @intCast(len) };
+}
+
+/// Decode one code point from input that already passed UTF-8 validation.
+fn decodeUtf8Unchecked(bytes: []const u8) u32 {
+    return switch (bytes.len) {
+        0 => 0xFFFD,
+        1 => bytes[0],
+        2 => (@as(u32, bytes[0] & 0x1F) << 6) | (bytes[1] & 0x3F),
+        3 => (@as(u32, bytes[0] & 0x0F) << 12) | (@as(u32, bytes[1] & 0x3F) << 6) | (bytes[2] & 0x3F),
+        else => (@as(u32, bytes[0] & 0x07) << 18) | (@as(u32, bytes[1] & 0x3F) << 12) |
+            (@as(u32, bytes[2] & 0x3F) << 6) | (bytes[3] & 0x3F),
+    };
+}
+
+fn utf8LengthUnchecked(lead: u8) usize {
+    return if (lead < 0xC0) 1 else if (lead < 0xE0) 2 else if (lead < 0xF0) 3 else 4;
+}
+
+/// Whether `line` is `fence` followed only by spaces or tabs.
+fn isFence(line: []const u8, fence: []const u8) bool {
+    return std.mem.eql(u8, std.mem.trimRight(u8, line, " \t"), fence);
+}
+fn closesFrontMatter(kind: FrontMatter.Kind, line: []const u8) bool {
+    return switch (kind) {
+        .yaml => isFence(line, "---") or isFence(line, "..."),
+        .toml => isFence(line, "+++"),
+    };
+}
+/// Label of a `[^label]` footnote marker at `start`, and the offset just past its `]`.
+fn parseFootnoteMarker(text: []const u8, start: usize) ?struct { label: []const u8, end: usize } {
+    if (start + 3 > text.len or text[start] != '[' or text[start + 1] != '^') return null;
+    var k = start + 2;
+    while (k < text.len and k - (start + 2) <= MAX_FOOTNOTE_LABEL) : (k += 1) {
+        const c = text[k];
+        if (c == ']') break;
+        if (c <= ' ' or c == '[') return null;
+    }
+    if (k >= text.len or text[k] != ']' or k == start + 2 or k - (start + 2) > MAX_FOOTNOTE_LABEL) return null;
+    return .{ .label = text[start + 2 .. k], .end = k + 1 };
+}
 fn stripIndentColumns(line: []const u8, columns: usize) []const u8 {
     var idx: usize = 0;
     var col: usize = 0;
@@ -137,1523 +1069,2373 @@ fn isThematicBreakLine(line: []const u8) bool {
     return count >= 3;
 }
 
-pub const OctomarkParser = struct {
-    table_alignments: [64]TableAlignment = [_]TableAlignment{.none} ** 64,
-    table_column_count: usize = 0,
-    block_stack: [MAX_BLOCK_NESTING]BlockEntry = undefined,
-    stack_depth: usize = 0,
-    pending_buffer: Buffer = .{},
-    paragraph_content: std.ArrayList(u8) = undefined,
-    pending_code_blank_lines: std.ArrayList(usize) = undefined,
-    delimiter_stack: [MAX_INLINE_NESTING]Delimiter = undefined,
-    delimiter_stack_len: usize = 0,
-    replacements: std.ArrayList(Replacement) = undefined,
-    allocator: std.mem.Allocator = undefined,
-    options: OctomarkOptions = .{},
-    stats: if (builtin.mode == .Debug) Stats else struct {} = .{},
-    pending_task_marker: u8 = 0,
-    pending_loose_idx: ?usize = null,
-    prev_line_blank: bool = false,
-    active_list_stack_idx: i32 = -1,
-    blockquote_depth: u8 = 0,
-    list_buffers: std.ArrayListUnmanaged(ListBuffer) = .{},
-    timer: if (builtin.mode == .Debug) std.time.Timer else struct {} = undefined,
-    const ListMetaTag = enum(u8) {
-        item,
-        paragraph,
-    };
-    const ListMeta = struct {
-        tag: ListMetaTag,
-        start: usize,
-        end: usize = 0,
-        flags: u8 = 0,
-    };
-    const ListMetaFlags = struct {
-        const has_block: u8 = 1 << 0;
-        const has_p: u8 = 1 << 1;
-    };
-    const ListBuffer = struct {
-        bytes: std.ArrayListUnmanaged(u8),
-        meta: std.ArrayListUnmanaged(ListMeta),
-        last_item_idx: ?usize = null,
-        para_count: usize = 0,
-    };
-    const Delimiter = struct {
-        pos: usize,
-        content_end: usize,
-        char: u8,
-        count: usize,
-        can_open: bool,
-        can_close: bool,
-        active: bool,
-    };
-    const Replacement = struct {
-        pos: usize,
-        end: usize,
-        text: []const u8,
-    };
-    const Stats = struct {
-        const C = struct {
-            count: usize = 0,
-            time_ns: u64 = 0,
+/// Parser specialized for `dialect` at compile time.
+pub fn Octomark(comptime dialect: Dialect) type {
+    return struct {
+        const Self = @This();
+        const block_start = blockStartTable(dialect);
+        const special = specialChars(dialect);
+
+        table_alignments: std.ArrayListUnmanaged(TableAlignment) = .{},
+        table_cell_tags: std.ArrayListUnmanaged([]const u8) = .{},
+        table_cells: std.ArrayListUnmanaged([]const u8) = .{},
+        table_batch: Buffer = .{},
+        table_row_ends: std.ArrayListUnmanaged(usize) = .{},
+        table_workers: std.ArrayListUnmanaged(TableWorker) = .{},
+        table_pool: ?*std.Thread.Pool = null,
+        block_stack: [MAX_BLOCK_NESTING]BlockEntry = undefined,
+        stack_depth: usize = 0,
+        pending_buffer: Buffer = .{},
+        held_line_end: ?usize = null,
+        scan_pos: usize = 0,
+        pending_cr: bool = false,
+        utf8_carry: [4]u8 = undefined,
+        utf8_carry_len: usize = 0,
+        front_matter: ?FrontMatter = null,
+        /// Footnotes by lowercased label; keys are owned by the map.
+        footnotes: std.StringHashMapUnmanaged(Footnote) = .{},
+        /// Referenced labels in first-use order.
+        footnote_order: std.ArrayListUnmanaged([]const u8) = .{},
+        /// Rendered definition bodies, listed at `finish`.
+        footnote_bodies: Buffer = .{},
+        /// Wiki link openings in `footnote_bodies`.
+        footnote_wiki_marks: WikiMarks = .{},
+        /// Current paragraph of the open definition.
+        footnote_text: Buffer = .{},
+        footnote_open: ?[]const u8 = null,
+        /// The open definition repeats an earlier label; its body is dropped when it closes.
+        footnote_duplicate: bool = false,
+        footnote_blank: bool = false,
+        footnote_body_start: usize = 0,
+        footnote_marks_start: usize = 0,
+        /// Resolved hrefs (null when unresolved) by reference text; keys and hrefs are owned.
+        reference_hrefs: std.StringHashMapUnmanaged(?[]const u8) = .{},
+        /// Distinct references in first-use order; texts point at `reference_hrefs` keys.
+        reference_list: std.ArrayListUnmanaged(Reference) = .{},
+        /// Set while rendering link text and image descriptions, where references stay text.
+        in_link_label: bool = false,
+        /// Wiki link targets in first-use order; targets and resolved hrefs are owned.
+        wiki_pages: std.ArrayListUnmanaged(WikiPage) = .{},
+        /// Index into `wiki_pages` by target; keys are the page targets.
+        wiki_page_index: std.StringHashMapUnmanaged(u32) = .{},
+        /// Pages before this index have been through the resolver.
+        wiki_resolved: usize = 0,
+        /// Top-level output held from the first wiki link until `finish`, written out whenever
+        /// it reaches `wiki_batch_bytes`. Link opening tags are not in it; `wiki_marks` records
+        /// where each one goes.
+        wiki_output: Buffer = .{},
+        wiki_marks: WikiMarks = .{},
+        wiki_holding: bool = false,
+        /// Decoded first word of the current fenced block's info string.
+        code_language: Buffer = .{},
+        /// Raw body of a fenced block bound for `code_hook`, one newline-terminated line at a time.
+        code_body: Buffer = .{},
+        code_hooked: bool = false,
+        /// Direct-mapped cache of hook output, allocated on first use.
+        code_cache: []CacheEntry = &.{},
+        /// Direct-mapped table of leaf block output for `memo_entries`, allocated on first use.
+        memo: []CacheEntry = &.{},
+        memo_scratch: Buffer = .{},
+        memo_hits: usize = 0,
+        memo_misses: usize = 0,
+        /// Raw TeX of the open `$$` block when `math_hook` is set.
+        math_body: Buffer = .{},
+        math_scratch: Buffer = .{},
+        doc_stats: DocumentStats = .{},
+        /// Whether the last visible text counted ended inside a run of non-space code points,
+        /// and whether that run has been counted as a word yet.
+        stats_in_word: bool = false,
+        stats_word_counted: bool = false,
+        /// Offset of `pending_buffer[0]` in the normalized input; advances as `feed` compacts.
+        stream_base: usize = 0,
+        /// Normalized input offset of each slice appended to `paragraph_content`, kept with
+        /// `token_sink`.
+        paragraph_sources: std.ArrayListUnmanaged(SourceSpan) = .{},
+        token_field: TokenField = .body,
+        /// Where normalization changed the length of the input, kept while offsets are reported
+        /// (see `tracksOffsets`), in input order.
+        rewrites: std.ArrayListUnmanaged(Rewrite) = .{},
+        /// Top-level blocks started, counted while checkpoints or a page limit are in use.
+        top_blocks: u64 = 0,
+        /// Block at which rendering from `startAt` stops.
+        page_end: ?u64 = null,
+        page_done: bool = false,
+        checkpoint_list: std.ArrayListUnmanaged(Checkpoint) = .{},
+        /// Resume offset of the closing-fence scan; null once front matter detection is settled.
+        front_matter_scan: ?usize = 0,
+        paragraph_content: std.ArrayList(u8) = undefined,
+        pending_code_blank_lines: std.ArrayList(usize) = undefined,
+        delimiter_stack: [MAX_INLINE_NESTING]Delimiter = undefined,
+        delimiter_stack_len: usize = 0,
+        replacements: std.ArrayList(Replacement) = undefined,
+        allocator: std.mem.Allocator = undefined,
+        options: OctomarkOptions = .{},
+        stats: if (builtin.mode == .Debug) Stats else struct {} = .{},
+        pending_task_marker: u8 = 0,
+        pending_loose_idx: ?usize = null,
+        prev_line_blank: bool = false,
+        active_list_stack_idx: i32 = -1,
+        blockquote_depth: u8 = 0,
+        list_buffers: std.ArrayListUnmanaged(ListBuffer) = .{},
+        timer: if (builtin.mode == .Debug) std.time.Timer else struct {} = undefined,
+        const ListMetaTag = enum(u8) {
+            item,
+            paragraph,
         };
-        feed: C = .{},
-        processSingleLine: C = .{},
-        parseInlineContent: C = .{},
-        parseHeader: C = .{},
-        parseHorizontalRule: C = .{},
-        parseFencedCodeBlock: C = .{},
-        parseMathBlock: C = .{},
-        parseListItem: C = .{},
-        parseTable: C = .{},
-        parseDefinitionList: C = .{},
-        parseDefinitionTerm: C = .{},
-        esc: C = .{},
-        findSpec: C = .{},
-        renderTop: C = .{},
-        pushBlock: C = .{},
-        pop: C = .{},
-        parseHtmlTag: C = .{},
-        splitTableRowCells: C = .{},
-        isBlockStartMarker: C = .{},
-        isNextLineTableSeparator: C = .{},
-        finish: C = .{},
-        closeP: C = .{},
-        tryCloseLeaf: C = .{},
-        scanDelimiters: C = .{},
-        scanInline: C = .{},
-        renderInline: C = .{},
-        parseIndentedCodeBlock: C = .{},
-        processLeafBlockContinuation: C = .{},
-        processParagraph: C = .{},
-        init: C = .{},
-        deinit: C = .{},
-        setOptions: C = .{},
-        parse: C = .{},
-        pushBlockExtra: C = .{},
-        currentListBufferIndex: C = .{},
-        listItemStart: C = .{},
-        listItemEnd: C = .{},
-        listItemMarkBlock: C = .{},
-        listItemMarkParagraph: C = .{},
-        listItemRecordParagraphSpan: C = .{},
-        applyPendingLoose: C = .{},
-        findLabelEnd: C = .{},
-        parseInlineLink: C = .{},
-        labelHasLinkLike: C = .{},
-        parseInlineContentScoped: C = .{},
-    };
-    inline fn startCall(self: *OctomarkParser, comptime field: std.meta.FieldEnum(Stats)) u64 {
-        if (builtin.mode == .Debug) {
-            @field(self.stats, @tagName(field)).count += 1;
-            return self.timer.read();
-        }
-        return 0;
-    }
-    inline fn endCall(self: *OctomarkParser, comptime field: std.meta.FieldEnum(Stats), s: u64) void {
-        if (builtin.mode == .Debug) {
-            @field(self.stats, @tagName(field)).time_ns += self.timer.read() - s;
-        }
-    }
-    pub fn init(self: *OctomarkParser, allocator: std.mem.Allocator) !void {
-        self.* = .{
-            .allocator = allocator,
-            .paragraph_content = .{},
-            .pending_code_blank_lines = .{},
-            .replacements = .{},
-            .pending_task_marker = 0,
-            .pending_loose_idx = null,
-            .active_list_stack_idx = -1,
-            .blockquote_depth = 0,
-            .list_buffers = .{},
+        const ListMeta = struct {
+            tag: ListMetaTag,
+            start: usize,
+            end: usize = 0,
+            flags: u8 = 0,
         };
-        if (builtin.mode == .Debug) self.timer = try std.time.Timer.start();
-        self.pending_buffer = .{};
-        try self.pending_buffer.ensureTotalCapacity(allocator, 4096);
-    }
-    pub fn deinit(self: *OctomarkParser, allocator: std.mem.Allocator) void {
-        self.pending_buffer.deinit(allocator);
-        self.paragraph_content.deinit(allocator);
-        self.pending_code_blank_lines.deinit(allocator);
-        self.replacements.deinit(allocator);
-        for (self.list_buffers.items) |*lb| {
-            lb.bytes.deinit(allocator);
-            lb.meta.deinit(allocator);
-        }
-        self.list_buffers.deinit(allocator);
-    }
-    pub fn setOptions(self: *OctomarkParser, options: OctomarkOptions) void {
-        const _s = self.startCall(.setOptions);
-        defer self.endCall(.setOptions, _s);
-        self.options = options;
-    }
-    pub fn parse(self: *OctomarkParser, reader: anytype, writer: anytype, allocator: std.mem.Allocator) !void {
-        const _s = self.startCall(.parse);
-        defer self.endCall(.parse, _s);
-        var buf: [65536]u8 = undefined;
-        const R = if (@typeInfo(@TypeOf(reader)) == .pointer) std.meta.Child(@TypeOf(reader)) else @TypeOf(reader);
-        while (true) {
-            const n = try if (@hasField(R, "interface")) reader.interface.readSliceShort(&buf) else if (@hasDecl(R, "read")) reader.read(&buf) else reader.readSliceShort(&buf);
-            if (n == 0) break;
-            try self.feed(buf[0..n], writer, allocator);
-        }
-        try self.finish(writer);
-    }
-    pub fn dumpStats(self: *const OctomarkParser) void {
-        if (builtin.mode == .Debug) {
-            std.debug.print("\n--- Octomark Stats ---\n{s: <25} | {s: >10} | {s: >15} | {s: >15}\n", .{
-                "Function",
-                "Calls",
-                "Total Time",
-                "Avg Call",
-            });
-            inline for (std.meta.fields(Stats)) |f| {
-                const c = @field(self.stats, f.name);
-                const avg = if (c.count > 0) c.time_ns / c.count else 0;
-                std.debug.print("{s: <25} | {d: >10} | {d: >12.3} ms | {d: >12.3} ns\n", .{
-                    f.name,
-                    c.count,
-                    @as(f64, @floatFromInt(c.time_ns)) / 1e6,
-                    @as(f64, @floatFromInt(avg)),
-                });
+        const ListMetaFlags = struct {
+            const has_block: u8 = 1 << 0;
+            const has_p: u8 = 1 << 1;
+        };
+        const ListBuffer = struct {
+            bytes: std.ArrayListUnmanaged(u8),
+            meta: std.ArrayListUnmanaged(ListMeta),
+            last_item_idx: ?usize = null,
+            para_count: usize = 0,
+            wiki_marks: WikiMarks = .{},
+        };
+        const Delimiter = struct {
+            pos: usize,
+            content_end: usize,
+            char: u8,
+            count: usize,
+            can_open: bool,
+            can_close: bool,
+            active: bool,
+        };
+        const Footnote = struct {
+            /// Position in first-use order; 0 until referenced.
+            number: usize = 0,
+            defined: bool = false,
+            body_start: usize = 0,
+            body_end: usize = 0,
+            /// Range of `footnote_wiki_marks` inside the body.
+            marks_start: usize = 0,
+            marks_end: usize = 0,
+        };
+        /// From normalized offset `at` on, raw offsets are `shift` bytes further along.
+        const Rewrite = struct {
+            at: usize,
+            shift: i64,
+        };
+        /// A direct-mapped cache slot. `key` is the hashed input, concatenated, so that a hash
+        /// collision is a miss instead of another block's output.
+        const CacheEntry = struct {
+            hash: u64 = 0,
+            key: []u8 = &.{},
+            html: []u8 = &.{},
+            fn hashOf(parts: []const []const u8) u64 {
+                var hasher = std.hash.Wyhash.init(0);
+                for (parts) |part| hasher.update(part);
+                return hasher.final();
+            }
+            fn matches(entry: CacheEntry, hash: u64, parts: []const []const u8) bool {
+                if (entry.hash != hash or entry.html.len == 0) return false;
+                var rest: []const u8 = entry.key;
+                for (parts) |part| {
+                    if (!std.mem.startsWith(u8, rest, part)) return false;
+                    rest = rest[part.len..];
+                }
+                return rest.len == 0;
+            }
+            /// Replace the slot with `html`, which the entry takes ownership of.
+            fn replace(entry: *CacheEntry, allocator: std.mem.Allocator, hash: u64, parts: []const []const u8, html: []u8) !void {
+                const key = std.mem.concat(allocator, u8, parts) catch |err| {
+                    allocator.free(html);
+                    return err;
+                };
+                entry.free(allocator);
+                entry.* = .{ .hash = hash, .key = key, .html = html };
+            }
+            fn free(entry: CacheEntry, allocator: std.mem.Allocator) void {
+                allocator.free(entry.key);
+                allocator.free(entry.html);
+            }
+        };
+        /// `paragraph_content` from byte `at` on was copied from input offset `source`; null when
+        /// the slice did not come straight from the input.
+        const SourceSpan = struct {
+            at: usize,
+            source: ?usize,
+        };
+        const Replacement = struct {
+            pos: usize,
+            end: usize,
+            /// Literal markup for `.literal`; the href prefix for `.autolink`; the UTF-8 sequence
+            /// for `.emoji`.
+            text: []const u8,
+            kind: enum { literal, autolink, emoji, mention, issue, hashtag } = .literal,
+        };
+        /// Renders a contiguous range of batched table rows into its own buffer on a pool thread.
+        const TableWorker = struct {
+            parser: Self,
+            out: Buffer = .{},
+            first_row: usize = 0,
+            end_row: usize = 0,
+            err: ?anyerror = null,
+            fn run(w: *TableWorker, src: *const Self) void {
+                w.renderRows(src) catch |e| {
+                    w.err = e;
+                };
+            }
+            fn renderRows(w: *TableWorker, src: *const Self) !void {
+                const sink = BufferSink{ .list = &w.out, .allocator = w.parser.allocator };
+                const ends = src.table_row_ends.items;
+                var row = w.first_row;
+                while (row < w.end_row) : (row += 1) {
+                    const start = if (row == 0) 0 else ends[row - 1];
+                    try w.parser.renderTableRow(src.table_batch.items[start..ends[row]], src.table_cell_tags.items, sink);
+                }
+            }
+        };
+        const Stats = struct {
+            const C = struct {
+                count: usize = 0,
+                time_ns: u64 = 0,
+            };
+            feed: C = .{},
+            processSingleLine: C = .{},
+            parseInlineContent: C = .{},
+            parseHeader: C = .{},
+            parseHorizontalRule: C = .{},
+            parseFencedCodeBlock: C = .{},
+            parseMathBlock: C = .{},
+            parseListItem: C = .{},
+            parseTable: C = .{},
+            parseDefinitionList: C = .{},
+            parseDefinitionTerm: C = .{},
+            esc: C = .{},
+            findSpec: C = .{},
+            renderTop: C = .{},
+            pushBlock: C = .{},
+            pop: C = .{},
+            parseHtmlTag: C = .{},
+            splitTableRowCells: C = .{},
+            isBlockStartMarker: C = .{},
+            isNextLineTableSeparator: C = .{},
+            finish: C = .{},
+            closeP: C = .{},
+            tryCloseLeaf: C = .{},
+            flushTableBatch: C = .{},
+            scanDelimiters: C = .{},
+            scanInline: C = .{},
+            renderInline: C = .{},
+            parseIndentedCodeBlock: C = .{},
+            processLeafBlockContinuation: C = .{},
+            processParagraph: C = .{},
+            consumeParagraphRun: C = .{},
+            init: C = .{},
+            deinit: C = .{},
+            setOptions: C = .{},
+            parse: C = .{},
+            pushBlockExtra: C = .{},
+            currentListBufferIndex: C = .{},
+            listItemStart: C = .{},
+            listItemEnd: C = .{},
+            listItemMarkBlock: C = .{},
+            listItemMarkParagraph: C = .{},
+            listItemRecordParagraphSpan: C = .{},
+            applyPendingLoose: C = .{},
+            findLabelEnd: C = .{},
+            parseInlineLink: C = .{},
+            labelHasLinkLike: C = .{},
+            parseInlineContentScoped: C = .{},
+        };
+        inline fn startCall(self: *Self, comptime field: std.meta.FieldEnum(Stats)) u64 {
+            if (builtin.mode == .Debug) {
+                @field(self.stats, @tagName(field)).count += 1;
+                return self.timer.read();
             }
+            return 0;
         }
-    }
-    inline fn writeAll(p: *OctomarkParser, writer: anytype, bytes: []const u8) !void {
-        if (p.currentListBuffer()) |lb| {
-            try lb.bytes.appendSlice(p.allocator, bytes);
-            return;
+        inline fn endCall(self: *Self, comptime field: std.meta.FieldEnum(Stats), s: u64) void {
+            if (builtin.mode == .Debug) {
+                @field(self.stats, @tagName(field)).time_ns += self.timer.read() - s;
+            }
         }
-        const W = if (@typeInfo(@TypeOf(writer)) == .pointer) std.meta.Child(@TypeOf(writer)) else @TypeOf(writer);
-        if (comptime @hasField(W, "interface")) try writer.interface.writeAll(bytes) else try writer.writeAll(bytes);
-    }
-    inline fn writeByte(p: *OctomarkParser, writer: anytype, byte: u8) !void {
-        if (p.currentListBuffer()) |lb| {
-            try lb.bytes.append(p.allocator, byte);
-            return;
+        pub fn init(self: *Self, allocator: std.mem.Allocator) !void {
+            self.* = .{
+                .allocator = allocator,
+                .paragraph_content = .{},
+                .pending_code_blank_lines = .{},
+                .replacements = .{},
+                .pending_task_marker = 0,
+                .pending_loose_idx = null,
+                .active_list_stack_idx = -1,
+                .blockquote_depth = 0,
+                .list_buffers = .{},
+            };
+            if (builtin.mode == .Debug) self.timer = try std.time.Timer.start();
+            self.pending_buffer = .{};
+            try self.pending_buffer.ensureTotalCapacity(allocator, 4096);
         }
-        const W = if (@typeInfo(@TypeOf(writer)) == .pointer) std.meta.Child(@TypeOf(writer)) else @TypeOf(writer);
-        if (comptime @hasField(W, "interface")) try writer.interface.writeByte(byte) else try writer.writeByte(byte);
-    }
-    inline fn writeHex(p: *OctomarkParser, writer: anytype, byte: u8) !void {
-        const hex = "0123456789ABCDEF";
-        try p.writeByte(writer, hex[byte >> 4]);
-        try p.writeByte(writer, hex[byte & 0xF]);
-    }
-    /// Feed a chunk into the parser. Returns error.OutOfMemory or writer errors.
-    pub fn feed(self: *OctomarkParser, chunk: []const u8, output: anytype, allocator: std.mem.Allocator) !void {
-        const _s = self.startCall(.feed);
-        defer self.endCall(.feed, _s);
-        try self.pending_buffer.appendSlice(allocator, chunk);
-        const data = self.pending_buffer.items;
-        const size = self.pending_buffer.items.len;
-        var pos: usize = 0;
-        while (pos < size) {
-            const next = std.mem.indexOfScalar(u8, data[pos..], '\n');
-            if (next == null) break;
-            const line_len = next.?;
-            const skip = try self.processSingleLine(data[pos .. pos + line_len], data, pos + line_len + 1, output);
-            pos += line_len + 1;
-            if (skip) {
-                const nn = std.mem.indexOfScalar(u8, data[pos..], '\n');
-                if (nn) |offset| {
-                    pos += offset + 1;
-                } else {
-                    pos = size;
-                }
+        pub fn deinit(self: *Self, allocator: std.mem.Allocator) void {
+            self.pending_buffer.deinit(allocator);
+            self.paragraph_content.deinit(allocator);
+            self.pending_code_blank_lines.deinit(allocator);
+            self.replacements.deinit(allocator);
+            self.table_alignments.deinit(allocator);
+            self.table_cell_tags.deinit(allocator);
+            self.table_cells.deinit(allocator);
+            self.table_batch.deinit(allocator);
+            self.table_row_ends.deinit(allocator);
+            for (self.table_workers.items) |*w| {
+                w.parser.deinit(allocator);
+                w.out.deinit(allocator);
+            }
+            self.table_workers.deinit(allocator);
+            if (self.table_pool) |pool| {
+                pool.deinit();
+                allocator.destroy(pool);
+            }
+            for (self.list_buffers.items) |*lb| {
+                lb.bytes.deinit(allocator);
+                lb.meta.deinit(allocator);
+                lb.wiki_marks.deinit(allocator);
             }
+            self.list_buffers.deinit(allocator);
+            var keys = self.footnotes.keyIterator();
+            while (keys.next()) |key| allocator.free(key.*);
+            self.footnotes.deinit(allocator);
+            self.footnote_order.deinit(allocator);
+            self.footnote_bodies.deinit(allocator);
+            self.footnote_wiki_marks.deinit(allocator);
+            self.footnote_text.deinit(allocator);
+            var refs = self.reference_hrefs.iterator();
+            while (refs.next()) |entry| {
+                allocator.free(entry.key_ptr.*);
+                if (entry.value_ptr.*) |href| allocator.free(href);
+            }
+            self.reference_hrefs.deinit(allocator);
+            self.reference_list.deinit(allocator);
+            for (self.wiki_pages.items) |page| {
+                allocator.free(page.target);
+                if (page.href) |href| allocator.free(href);
+            }
+            self.wiki_pages.deinit(allocator);
+            self.wiki_page_index.deinit(allocator);
+            self.wiki_output.deinit(allocator);
+            self.wiki_marks.deinit(allocator);
+            self.code_language.deinit(allocator);
+            self.code_body.deinit(allocator);
+            for (self.code_cache) |entry| entry.free(allocator);
+            allocator.free(self.code_cache);
+            for (self.memo) |entry| entry.free(allocator);
+            allocator.free(self.memo);
+            self.memo_scratch.deinit(allocator);
+            self.math_body.deinit(allocator);
+            self.math_scratch.deinit(allocator);
+            self.paragraph_sources.deinit(allocator);
+            self.checkpoint_list.deinit(allocator);
+            self.rewrites.deinit(allocator);
         }
-        if (pos > 0) {
-            const rem = size - pos;
-            if (rem > 0) std.mem.copyForwards(u8, self.pending_buffer.items[0..rem], self.pending_buffer.items[pos .. pos + rem]);
-            self.pending_buffer.items.len = rem;
+        pub fn setOptions(self: *Self, options: OctomarkOptions) void {
+            const _s = self.startCall(.setOptions);
+            defer self.endCall(.setOptions, _s);
+            self.options = options;
         }
-    }
-    /// Finalize parsing and close any open blocks. Returns writer errors.
-    pub fn finish(self: *OctomarkParser, output: anytype) !void {
-        const _s = self.startCall(.finish);
-        defer self.endCall(.finish, _s);
-        if (self.pending_buffer.items.len > 0) {
-            _ = try self.processSingleLine(
-                self.pending_buffer.items[0..self.pending_buffer.items.len],
-                self.pending_buffer.items,
-                self.pending_buffer.items.len,
-                output,
-            );
-        }
-        while (self.stack_depth > 0) try self.renderTop(output);
-    }
-    fn pushBlock(p: *OctomarkParser, t: BlockType, i: i32) !void {
-        const _s = p.startCall(.pushBlock);
-        defer p.endCall(.pushBlock, _s);
-        try p.pushBlockExtra(t, i, 0);
-    }
-    fn pushBlockExtra(p: *OctomarkParser, t: BlockType, i: i32, extra: u8) !void {
-        const _s = p.startCall(.pushBlockExtra);
-        defer p.endCall(.pushBlockExtra, _s);
-        if (p.stack_depth >= MAX_BLOCK_NESTING) return error.NestingTooDeep;
-        p.block_stack[p.stack_depth] = .{ .block_type = t, .indent_level = i, .content_indent = i, .loose = false, .extra_type = extra };
-        if (t == .blockquote) p.blockquote_depth += 1;
-        if (t == .unordered_list or t == .ordered_list) {
-            p.listItemMarkBlock();
-            const idx = self_list_buf_idx: {
-                try p.list_buffers.append(p.allocator, .{
-                    .bytes = .{},
-                    .meta = .{},
-                    .last_item_idx = null,
-                    .para_count = 0,
-                });
-                break :self_list_buf_idx p.list_buffers.items.len - 1;
-            };
-            p.block_stack[p.stack_depth].buffer_index = @intCast(idx);
-            p.active_list_stack_idx = @intCast(p.stack_depth);
-        } else if (t != .paragraph) {
-            p.listItemMarkBlock();
+        pub fn parse(self: *Self, reader: anytype, writer: anytype, allocator: std.mem.Allocator) !void {
+            const _s = self.startCall(.parse);
+            defer self.endCall(.parse, _s);
+            var buf: [65536]u8 = undefined;
+            const R = if (@typeInfo(@TypeOf(reader)) == .pointer) std.meta.Child(@TypeOf(reader)) else @TypeOf(reader);
+            while (true) {
+                const n = try if (@hasField(R, "interface")) reader.interface.readSliceShort(&buf) else if (@hasDecl(R, "read")) reader.read(&buf) else reader.readSliceShort(&buf);
+                if (n == 0) break;
+                try self.feed(buf[0..n], writer, allocator);
+                if (self.page_done) break;
+            }
+            try self.finish(writer);
         }
-        p.stack_depth += 1;
-    }
-    fn pop(p: *OctomarkParser) void {
-        const _s = p.startCall(.pop);
-        defer p.endCall(.pop, _s);
-        if (p.stack_depth > 0) {
-            const popped_idx = p.stack_depth - 1;
-            const popped = p.block_stack[popped_idx];
-            p.stack_depth -= 1;
-            if (popped.block_type == .blockquote) p.blockquote_depth -= 1;
-            if (p.active_list_stack_idx == @as(i32, @intCast(popped_idx))) {
-                p.active_list_stack_idx = -1;
-                var i = p.stack_depth;
-                while (i > 0) {
-                    i -= 1;
-                    const bt = p.block_stack[i].block_type;
-                    if (bt == .unordered_list or bt == .ordered_list) {
-                        p.active_list_stack_idx = @intCast(i);
-                        break;
-                    }
+        pub fn dumpStats(self: *const Self) void {
+            if (builtin.mode == .Debug) {
+                std.debug.print("\n--- Octomark Stats ---\n{s: <25} | {s: >10} | {s: >15} | {s: >15}\n", .{
+                    "Function",
+                    "Calls",
+                    "Total Time",
+                    "Avg Call",
+                });
+                inline for (std.meta.fields(Stats)) |f| {
+                    const c = @field(self.stats, f.name);
+                    const avg = if (c.count > 0) c.time_ns / c.count else 0;
+                    std.debug.print("{s: <25} | {d: >10} | {d: >12.3} ms | {d: >12.3} ns\n", .{
+                        f.name,
+                        c.count,
+                        @as(f64, @floatFromInt(c.time_ns)) / 1e6,
+                        @as(f64, @floatFromInt(avg)),
+                    });
+                }
+                if (self.options.math_cache) |cache| {
+                    const ms = cache.stats();
+                    std.debug.print("math cache: {d} hits, {d} misses ({d:.1}% hit rate)\n", .{ ms.hits, ms.misses, ms.hitRate() * 100.0 });
+                }
+                if (self.options.memo_entries > 0) {
+                    const ms = self.memoStats();
+                    std.debug.print("block memo: {d} hits, {d} misses ({d:.1}% hit rate)\n", .{ ms.hits, ms.misses, ms.hitRate() * 100.0 });
                 }
             }
         }
-    }
-    fn topT(p: *const OctomarkParser) ?BlockType {
-        return if (p.stack_depth > 0) p.block_stack[p.stack_depth - 1].block_type else null;
-    }
-    fn renderTop(p: *OctomarkParser, o: anytype) !void {
-        if (p.stack_depth == 0) return;
-        const s = p.startCall(.renderTop);
-        defer p.endCall(.renderTop, s);
-        const t = p.block_stack[p.stack_depth - 1].block_type;
-        if (t == .paragraph and p.paragraph_content.items.len == 0) {
-            p.pop();
-            return;
-        }
-        if (t == .indented_code) p.pending_code_blank_lines.clearRetainingCapacity();
-        if (t == .unordered_list or t == .ordered_list) {
-            const list_loose = p.block_stack[p.stack_depth - 1].loose;
-            try p.flushListParagraph(o, list_loose);
-            p.listItemEnd();
-            const close_tag = block_close_tags[@intFromEnum(t)];
-            const lb_idx: usize = @intCast(p.block_stack[p.stack_depth - 1].buffer_index);
-            var lb = &p.list_buffers.items[lb_idx];
-            if (lb.last_item_idx) |idx| {
-                var last_item = &lb.meta.items[idx];
-                if (last_item.tag == .item and last_item.end == 0) last_item.end = lb.bytes.items.len;
+        inline fn writeAll(p: *Self, writer: anytype, bytes: []const u8) !void {
+            if (p.currentListBuffer()) |lb| {
+                try lb.bytes.appendSlice(p.allocator, bytes);
+                return;
             }
-            p.pop();
-            if (list_loose and lb.para_count > 0) {
-                var cursor: usize = 0;
-                var i: usize = 0;
-                while (i < lb.meta.items.len) : (i += 1) {
-                    const p_meta = lb.meta.items[i];
-                    if (p_meta.tag != .paragraph) continue;
-                    if (p_meta.start < cursor or p_meta.end < p_meta.start or p_meta.end > lb.bytes.items.len) {
-                        try p.writeAll(o, lb.bytes.items[cursor..]);
-                        cursor = lb.bytes.items.len;
+            if (dialect.wiki_links and p.wiki_holding and @TypeOf(writer) != BufferSink) return p.holdOutput(writer, bytes);
+            const W = if (@typeInfo(@TypeOf(writer)) == .pointer) std.meta.Child(@TypeOf(writer)) else @TypeOf(writer);
+            if (comptime @hasField(W, "interface")) try writer.interface.writeAll(bytes) else try writer.writeAll(bytes);
+        }
+        inline fn writeByte(p: *Self, writer: anytype, byte: u8) !void {
+            if (p.currentListBuffer()) |lb| {
+                try lb.bytes.append(p.allocator, byte);
+                return;
+            }
+            if (dialect.wiki_links and p.wiki_holding and @TypeOf(writer) != BufferSink) return p.holdOutput(writer, &.{byte});
+            const W = if (@typeInfo(@TypeOf(writer)) == .pointer) std.meta.Child(@TypeOf(writer)) else @TypeOf(writer);
+            if (comptime @hasField(W, "interface")) try writer.interface.writeByte(byte) else try writer.writeByte(byte);
+        }
+        /// Feed a chunk into the parser. Returns error.OutOfMemory, error.InvalidUtf8 (with the
+        /// `.reject` policy) or writer errors.
+        /// A line is processed only once the line after it is complete (or at `finish`), so table and
+        /// definition lookahead never depends on where a chunk boundary falls. The last complete line
+        /// is held back in `pending_buffer` with its newline offset, so it is never rescanned.
+        /// `allocator` is ignored and kept only for API compatibility: every buffer is grown and
+        /// freed with the allocator passed to `init`.
+        pub fn feed(self: *Self, chunk: []const u8, output: anytype, allocator: std.mem.Allocator) !void {
+            const _s = self.startCall(.feed);
+            defer self.endCall(.feed, _s);
+            _ = allocator;
+            if (self.page_done) return;
+            try self.appendInput(chunk);
+            const data = self.pending_buffer.items;
+            const size = self.pending_buffer.items.len;
+            var pos: usize = 0;
+            if (self.front_matter_scan != null) {
+                // Nothing has been parsed yet, so the buffer still starts at input offset 0.
+                pos = self.scanFrontMatter(false) orelse return;
+                self.scan_pos = pos;
+            }
+            var line_end: ?usize = self.held_line_end;
+            var scan_from: usize = self.scan_pos;
+            while (true) {
+                if (line_end == null) {
+                    line_end = std.mem.indexOfScalarPos(u8, data, scan_from, '\n') orelse {
+                        scan_from = size;
                         break;
+                    };
+                    scan_from = line_end.? + 1;
+                }
+                if (self.inTopLevelParagraph()) {
+                    const run_end = try self.consumeParagraphRun(data, pos);
+                    if (run_end != pos) {
+                        pos = run_end;
+                        line_end = null;
+                        scan_from = pos;
+                        continue;
                     }
-                    try p.writeAll(o, lb.bytes.items[cursor..p_meta.start]);
-                    try p.writeAll(o, "<p>");
-                    try p.writeAll(o, lb.bytes.items[p_meta.start..p_meta.end]);
-                    try p.writeAll(o, "</p>\n");
-                    cursor = p_meta.end;
                 }
-                if (cursor < lb.bytes.items.len) try p.writeAll(o, lb.bytes.items[cursor..]);
-                try p.writeAll(o, close_tag);
-            } else {
-                try p.writeAll(o, lb.bytes.items);
-                try p.writeAll(o, close_tag);
+                const cur_end = line_end.?;
+                const next_end = std.mem.indexOfScalarPos(u8, data, scan_from, '\n') orelse {
+                    scan_from = size;
+                    break;
+                };
+                const skip = try self.processSingleLine(data[pos..cur_end], data, cur_end + 1, output);
+                if (self.page_done) {
+                    line_end = null;
+                    break;
+                }
+                pos = cur_end + 1;
+                line_end = next_end;
+                scan_from = next_end + 1;
+                if (skip) {
+                    pos = next_end + 1;
+                    line_end = null;
+                }
             }
-            if (p.pending_loose_idx) |idx| {
-                if (p.stack_depth == 0 or idx >= p.stack_depth) p.pending_loose_idx = null;
+            if (pos > 0) {
+                const rem = size - pos;
+                if (rem > 0) std.mem.copyForwards(u8, self.pending_buffer.items[0..rem], self.pending_buffer.items[pos .. pos + rem]);
+                self.pending_buffer.items.len = rem;
+                self.stream_base += pos;
+                self.foldRewrites();
             }
-            return;
+            self.held_line_end = if (line_end) |e| e - pos else null;
+            self.scan_pos = scan_from - pos;
         }
-        if (p.paragraph_content.items.len > 0) {
-            if (t == .paragraph) {
-                p.listItemMarkParagraph();
-                try p.writeAll(o, "<p>");
-            }
-            const start_pos = if (p.currentListBuffer()) |lb| lb.bytes.items.len else 0;
-            try p.parseInlineContent(p.paragraph_content.items, o);
-            if (t != .paragraph) {
-                if (p.currentListBuffer()) |lb| p.listItemRecordParagraphSpan(start_pos, lb.bytes.items.len);
-            }
-            p.paragraph_content.clearRetainingCapacity();
+        /// Front matter skipped at the start of the input, if any.
+        pub fn frontMatter(self: *const Self) ?FrontMatter {
+            return self.front_matter;
         }
-        p.pop();
-        if (p.pending_loose_idx) |idx| {
-            if (p.stack_depth == 0 or idx >= p.stack_depth) p.pending_loose_idx = null;
+        /// Checkpoints recorded with `checkpoint_interval`, in input order. Valid until `deinit`.
+        pub fn checkpoints(self: *const Self) []const Checkpoint {
+            return self.checkpoint_list.items;
         }
-        try p.writeAll(o, block_close_tags[@intFromEnum(t)]);
-    }
-    fn closeP(p: *OctomarkParser, o: anytype) !void {
-        const _s = p.startCall(.closeP);
-        defer p.endCall(.closeP, _s);
-        if (p.topT() == .paragraph) try p.renderTop(o);
-    }
-    fn tryCloseLeaf(p: *OctomarkParser, o: anytype) !void {
-        const _s = p.startCall(.tryCloseLeaf);
-        defer p.endCall(.tryCloseLeaf, _s);
-        const t = p.topT() orelse return;
-        if (t == .paragraph or @intFromEnum(t) >= @intFromEnum(BlockType.code)) {
-            try p.renderTop(o);
-        } else if (p.paragraph_content.items.len > 0) {
-            try p.parseInlineContent(p.paragraph_content.items, o);
-            p.paragraph_content.clearRetainingCapacity();
+        /// Render from `checkpoint` instead of the start of the document, with the input fed from
+        /// `checkpoint.offset` on. With `blocks` set, rendering ends before the top-level block
+        /// that many blocks later; later input is ignored, and `pageDone()` tells the caller to
+        /// stop reading. Call before the first `feed`. Footnote numbers restart on each page.
+        pub fn startAt(self: *Self, checkpoint: Checkpoint, blocks: ?u64) void {
+            self.stream_base = @intCast(checkpoint.offset);
+            self.top_blocks = checkpoint.block;
+            self.page_end = if (blocks) |n| checkpoint.block + n else null;
+            _ = self.settleFrontMatter(null);
         }
-    }
-    fn currentListBufferIndex(p: *OctomarkParser) ?usize {
-        const _s = p.startCall(.currentListBufferIndex);
-        defer p.endCall(.currentListBufferIndex, _s);
-        if (p.active_list_stack_idx >= 0) {
-            const idx = p.block_stack[@intCast(p.active_list_stack_idx)].buffer_index;
-            if (idx >= 0) return @intCast(idx);
-        }
-        return null;
-    }
-    fn currentListBuffer(p: *OctomarkParser) ?*ListBuffer {
-        return if (p.currentListBufferIndex()) |idx| &p.list_buffers.items[idx] else null;
-    }
-    fn listItemStart(p: *OctomarkParser) void {
-        const _s = p.startCall(.listItemStart);
-        defer p.endCall(.listItemStart, _s);
-        const idx = p.currentListBufferIndex() orelse return;
-        var lb = &p.list_buffers.items[idx];
-        lb.meta.append(p.allocator, .{
-            .tag = .item,
-            .start = lb.bytes.items.len,
-        }) catch {};
-        lb.last_item_idx = if (lb.meta.items.len > 0) lb.meta.items.len - 1 else null;
-    }
-    fn listItemEnd(p: *OctomarkParser) void {
-        const _s = p.startCall(.listItemEnd);
-        defer p.endCall(.listItemEnd, _s);
-        const idx = p.currentListBufferIndex() orelse return;
-        var lb = &p.list_buffers.items[idx];
-        if (lb.last_item_idx) |item_idx| {
-            var item = &lb.meta.items[item_idx];
-            if (item.tag == .item and item.end == 0) item.end = lb.bytes.items.len;
+        /// Whether the page requested by `startAt` has been rendered.
+        pub fn pageDone(self: *const Self) bool {
+            return self.page_done;
         }
-    }
-    fn listItemMarkBlock(p: *OctomarkParser) void {
-        const _s = p.startCall(.listItemMarkBlock);
-        defer p.endCall(.listItemMarkBlock, _s);
-        const idx = p.currentListBufferIndex() orelse return;
-        var lb = &p.list_buffers.items[idx];
-        if (lb.last_item_idx) |item_idx| {
-            var item = &lb.meta.items[item_idx];
-            if (item.tag == .item) item.flags |= ListMetaFlags.has_block;
+        /// Statistics gathered with `document_stats`; complete after `finish`.
+        pub fn documentStats(self: *const Self) DocumentStats {
+            return self.doc_stats;
         }
-    }
-    fn listItemMarkParagraph(p: *OctomarkParser) void {
-        const _s = p.startCall(.listItemMarkParagraph);
-        defer p.endCall(.listItemMarkParagraph, _s);
-        const idx = p.currentListBufferIndex() orelse return;
-        var lb = &p.list_buffers.items[idx];
-        if (lb.last_item_idx) |item_idx| {
-            var item = &lb.meta.items[item_idx];
-            if (item.tag == .item) item.flags |= ListMetaFlags.has_p;
+        /// Leaf blocks replayed and rendered through the `memo_entries` table.
+        pub fn memoStats(self: *const Self) CacheStats {
+            return .{ .hits = self.memo_hits, .misses = self.memo_misses };
         }
-    }
-    fn listItemRecordParagraphSpan(p: *OctomarkParser, start: usize, end: usize) void {
-        const _s = p.startCall(.listItemRecordParagraphSpan);
-        defer p.endCall(.listItemRecordParagraphSpan, _s);
-        const idx = p.currentListBufferIndex() orelse return;
-        var lb = &p.list_buffers.items[idx];
-        if (lb.last_item_idx == null or end <= start) return;
-        lb.meta.append(p.allocator, .{
-            .tag = .paragraph,
-            .start = start,
-            .end = end,
-        }) catch {};
-        lb.para_count += 1;
-    }
-    inline fn flushListParagraph(p: *OctomarkParser, o: anytype, wrap_paragraph: bool) !void {
-        if (p.paragraph_content.items.len == 0) return;
-        if (wrap_paragraph) {
-            p.listItemMarkParagraph();
-            try p.writeAll(o, "<p>");
-            try p.parseInlineContent(p.paragraph_content.items, o);
-            try p.writeAll(o, "</p>\n");
-        } else {
-            const start_pos = if (p.currentListBuffer()) |lb| lb.bytes.items.len else 0;
-            try p.parseInlineContent(p.paragraph_content.items, o);
-            if (p.currentListBuffer()) |lb| p.listItemRecordParagraphSpan(start_pos, lb.bytes.items.len);
-        }
-        p.paragraph_content.clearRetainingCapacity();
-    }
-    inline fn handleBlankLine(p: *OctomarkParser, o: anytype, suppress_after_idx: ?usize, close_containers: bool) !bool {
-        const top_bt = p.topT();
-        if (top_bt == .paragraph or top_bt == .table or top_bt == .code or top_bt == .math) try p.renderTop(o);
-        const l_idx: ?usize = if (p.active_list_stack_idx >= 0) @intCast(p.active_list_stack_idx) else null;
-        if (l_idx != null and p.paragraph_content.items.len > 0) {
-            const list_loose = p.block_stack[l_idx.?].loose;
-            try p.flushListParagraph(o, list_loose);
-        }
-        if (l_idx) |idx| {
-            const suppress = if (suppress_after_idx) |bq_idx| bq_idx > idx else false;
-            if (!suppress) p.pending_loose_idx = idx;
-        }
-        if (close_containers) {
-            while (p.stack_depth > 0 and p.topT() != null and @intFromEnum(p.topT().?) >=
-                @intFromEnum(BlockType.blockquote))
-            {
-                try p.renderTop(o);
+        /// Distinct references rendered so far, in first-use order. Valid until `deinit`.
+        pub fn references(self: *const Self) []const Reference {
+            return self.reference_list.items;
+        }
+        /// Look for front matter at the start of `pending_buffer`, resuming the newline scan where
+        /// the previous feed stopped. Returns where Markdown parsing starts (past the block, or 0
+        /// without one), or null while an opened block still needs input. At `at_end` an unclosed
+        /// block is parsed as Markdown.
+        fn scanFrontMatter(p: *Self, at_end: bool) ?usize {
+            if (!p.options.front_matter) return p.settleFrontMatter(null);
+            const data = p.pending_buffer.items;
+            const first_end = std.mem.indexOfScalar(u8, data, '\n') orelse
+                return if (at_end) p.settleFrontMatter(null) else null;
+            const kind: FrontMatter.Kind = if (isFence(data[0..first_end], "---"))
+                .yaml
+            else if (isFence(data[0..first_end], "+++"))
+                .toml
+            else
+                return p.settleFrontMatter(null);
+            var line_start = @max(p.front_matter_scan.?, first_end + 1);
+            while (line_start < data.len) {
+                const nl = std.mem.indexOfScalarPos(u8, data, line_start, '\n') orelse {
+                    if (!at_end) break;
+                    if (closesFrontMatter(kind, data[line_start..])) {
+                        return p.settleFrontMatter(.{ .kind = kind, .start = first_end + 1, .end = line_start, .block_end = data.len });
+                    }
+                    break;
+                };
+                if (closesFrontMatter(kind, data[line_start..nl])) {
+                    return p.settleFrontMatter(.{ .kind = kind, .start = first_end + 1, .end = line_start, .block_end = nl + 1 });
+                }
+                line_start = nl + 1;
             }
+            if (at_end) return p.settleFrontMatter(null);
+            p.front_matter_scan = line_start;
+            return null;
         }
-        return false;
-    }
-    fn applyPendingLoose(p: *OctomarkParser, o: anytype) !void {
-        const _s = p.startCall(.applyPendingLoose);
-        defer p.endCall(.applyPendingLoose, _s);
-        _ = o;
-        if (p.pending_loose_idx) |idx| {
-            if (idx < p.stack_depth) {
-                p.block_stack[idx].loose = true;
+        /// Store the front matter with raw offsets; returns where parsing starts in `pending_buffer`.
+        fn settleFrontMatter(p: *Self, found: ?FrontMatter) usize {
+            p.front_matter_scan = null;
+            // With only front matter asking for offsets, the log is no longer needed.
+            defer if (!p.tracksOffsets()) p.rewrites.clearAndFree(p.allocator);
+            const f = found orelse {
+                p.front_matter = null;
+                return 0;
+            };
+            p.front_matter = .{
+                .kind = f.kind,
+                .start = p.rawOffset(f.start),
+                .end = p.rawOffset(f.end),
+                .block_end = p.rawOffset(f.block_end),
+            };
+            return f.block_end;
+        }
+        /// Append `chunk` to `pending_buffer`, normalizing line endings and NUL and validating UTF-8 in
+        /// one pass. Clean runs are copied in bulk. A CR ending a chunk is emitted as LF immediately and
+        /// a LF opening the next chunk is dropped; a UTF-8 sequence split by a chunk boundary is carried
+        /// over and completed by the next chunk.
+        fn appendInput(p: *Self, chunk: []const u8) !void {
+            const newlines = p.options.normalize_input;
+            const utf8 = p.options.utf8_policy != .pass_through;
+            if (!newlines and !utf8) {
+                try p.pending_buffer.appendSlice(p.allocator, chunk);
+                return;
+            }
+            var i: usize = 0;
+            if (p.pending_cr and chunk.len > 0) {
+                p.pending_cr = false;
+                if (chunk[0] == '\n') {
+                    try p.noteRewrite(1, 0);
+                    i = 1;
+                }
+            }
+            if (p.utf8_carry_len > 0) i += try p.completeCarriedSequence(chunk[i..]);
+            var run_start = i;
+            while (i < chunk.len) {
+                const j = indexOfInputSpecial(chunk, i, newlines, utf8);
+                if (j == chunk.len) {
+                    i = j;
+                    break;
+                }
+                const c = chunk[j];
+                if (c < 0x80) {
+                    try p.pending_buffer.appendSlice(p.allocator, chunk[run_start..j]);
+                    if (c == 0) {
+                        try p.pending_buffer.appendSlice(p.allocator, "\u{FFFD}");
+                        i = j + 1;
+                        try p.noteRewrite(1, 3);
+                    } else {
+                        try p.pending_buffer.append(p.allocator, '\n');
+                        if (j + 1 == chunk.len) p.pending_cr = true;
+                        i = if (j + 1 < chunk.len and chunk[j + 1] == '\n') j + 2 else j + 1;
+                        try p.noteRewrite(i - j, 1);
+                    }
+                } else {
+                    // Whole valid blocks in one step; the scalar check locates errors exactly.
+                    const run_end = validUtf8Run(chunk, j, newlines);
+                    if (run_end > j) {
+                        i = run_end;
+                        continue;
+                    }
+                    switch (checkUtf8Sequence(chunk[j..])) {
+                        .valid => |n| {
+                            i = j + n;
+                            continue;
+                        },
+                        .invalid => |n| {
+                            try p.pending_buffer.appendSlice(p.allocator, chunk[run_start..j]);
+                            try p.appendInvalidUtf8(chunk[j .. j + n]);
+                            i = j + n;
+                        },
+                        .incomplete => {
+                            try p.pending_buffer.appendSlice(p.allocator, chunk[run_start..j]);
+                            const rest = chunk[j..];
+                            @memcpy(p.utf8_carry[0..rest.len], rest);
+                            p.utf8_carry_len = rest.len;
+                            i = chunk.len;
+                        },
+                    }
+                }
+                run_start = i;
             }
-            p.pending_loose_idx = null;
+            try p.pending_buffer.appendSlice(p.allocator, chunk[run_start..i]);
         }
-    }
-    fn esc(p: *OctomarkParser, text: []const u8, o: anytype) !void {
-        const _s = p.startCall(.esc);
-        defer p.endCall(.esc, _s);
-        var i: usize = 0;
-        while (i < text.len) {
-            if (std.mem.indexOfAny(u8, text[i..], "&<>\"'")) |off| {
-                const j = i + off;
-                if (j > i) try p.writeAll(o, text[i..j]);
-                try p.writeAll(o, html_escape_map[text[j]].?);
-                i = j + 1;
-            } else {
-                try p.writeAll(o, text[i..]);
-                break;
+        /// Normalization has just replaced `raw_len` input bytes with the last `len` bytes of
+        /// `pending_buffer`.
+        fn noteRewrite(p: *Self, raw_len: usize, len: usize) !void {
+            if (raw_len == len or !p.tracksOffsets()) return;
+            const rewrites = p.rewrites.items;
+            const shift = if (rewrites.len > 0) rewrites[rewrites.len - 1].shift else 0;
+            const delta = @as(i64, @intCast(raw_len)) - @as(i64, @intCast(len));
+            try p.rewrites.append(p.allocator, .{ .at = p.stream_base + p.pending_buffer.items.len, .shift = shift + delta });
+        }
+        /// Whether offsets are reported to the caller, through tokens, checkpoints or front matter
+        /// that is still being scanned.
+        fn tracksOffsets(p: *const Self) bool {
+            return p.options.token_sink != null or p.options.checkpoint_interval > 0 or
+                (p.options.front_matter and p.front_matter_scan != null);
+        }
+        /// Drop the rewrites no offset can be looked up below any more, keeping the last of them
+        /// as the shift at the new floor, so the log only spans input that is still buffered.
+        /// The floor is `stream_base`, or an earlier line of a paragraph still being collected.
+        fn foldRewrites(p: *Self) void {
+            var floor = p.stream_base;
+            for (p.paragraph_sources.items) |span| {
+                if (span.source) |source| floor = @min(floor, source);
             }
+            const rewrites = p.rewrites.items;
+            var k: usize = 0;
+            while (k < rewrites.len and rewrites[k].at <= floor) k += 1;
+            if (k < 2) return;
+            const keep = rewrites.len - (k - 1);
+            std.mem.copyForwards(Rewrite, rewrites[0..keep], rewrites[k - 1 ..]);
+            p.rewrites.items.len = keep;
         }
-    }
-    fn stripBlockquotePrefixes(p: *const OctomarkParser, line: []const u8) struct { slice: []const u8, extra_indent_columns: usize, ok: bool } {
-        var text_slice = line;
-        var extra_indent_columns: usize = 0;
-        var ok = true;
-        var i: usize = 0;
-        while (i < p.stack_depth) : (i += 1) {
-            const block = p.block_stack[i];
-            if (block.block_type == .blockquote) {
-                var idx: usize = 0;
-                var col: usize = 0;
-                while (idx < text_slice.len) {
-                    const c = text_slice[idx];
-                    if (c == ' ') {
-                        idx += 1;
-                        col += 1;
-                    } else if (c == '\t') {
-                        idx += 1;
-                        col += 4 - (col % 4);
-                    } else break;
+        /// Raw input offset of normalized offset `offset`: the offset in the bytes as fed, before
+        /// line endings, NUL and invalid UTF-8 were rewritten.
+        fn rawOffset(p: *const Self, offset: usize) usize {
+            const rewrites = p.rewrites.items;
+            var lo: usize = 0;
+            var hi = rewrites.len;
+            while (lo < hi) {
+                const mid = lo + (hi - lo) / 2;
+                if (rewrites[mid].at <= offset) lo = mid + 1 else hi = mid;
+            }
+            if (lo == 0) return offset;
+            return @intCast(@as(i64, @intCast(offset)) + rewrites[lo - 1].shift);
+        }
+        /// Complete the UTF-8 sequence carried over from the previous chunk. Returns the number of
+        /// bytes of `chunk` consumed.
+        fn completeCarriedSequence(p: *Self, chunk: []const u8) !usize {
+            const carried = p.utf8_carry_len;
+            var seq: [4]u8 = undefined;
+            @memcpy(seq[0..carried], p.utf8_carry[0..carried]);
+            const take = @min(seq.len - carried, chunk.len);
+            @memcpy(seq[carried .. carried + take], chunk[0..take]);
+            switch (checkUtf8Sequence(seq[0 .. carried + take])) {
+                .valid => |n| {
+                    p.utf8_carry_len = 0;
+                    try p.pending_buffer.appendSlice(p.allocator, seq[0..n]);
+                    return @as(usize, n) - carried;
+                },
+                .invalid => |n| {
+                    p.utf8_carry_len = 0;
+                    try p.appendInvalidUtf8(seq[0..n]);
+                    return @as(usize, n) - carried;
+                },
+                .incomplete => {
+                    @memcpy(p.utf8_carry[carried .. carried + take], chunk[0..take]);
+                    p.utf8_carry_len = carried + take;
+                    return take;
+                },
+            }
+        }
+        fn appendInvalidUtf8(p: *Self, bytes: []const u8) !void {
+            switch (p.options.utf8_policy) {
+                .reject => return error.InvalidUtf8,
+                .replace => {
+                    try p.pending_buffer.appendSlice(p.allocator, "\u{FFFD}");
+                    try p.noteRewrite(bytes.len, 3);
+                },
+                .pass_through => try p.pending_buffer.appendSlice(p.allocator, bytes),
+            }
+        }
+        /// Finalize parsing and close any open blocks. Returns writer errors.
+        pub fn finish(self: *Self, output: anytype) !void {
+            const _s = self.startCall(.finish);
+            defer self.endCall(.finish, _s);
+            if (self.utf8_carry_len > 0) {
+                // A sequence truncated by end of input.
+                const carried = self.utf8_carry_len;
+                self.utf8_carry_len = 0;
+                try self.appendInvalidUtf8(self.utf8_carry[0..carried]);
+            }
+            const data = self.pending_buffer.items;
+            var pos: usize = 0;
+            if (self.front_matter_scan != null) pos = self.scanFrontMatter(true).?;
+            while (pos < data.len and !self.page_done) {
+                const line_end = std.mem.indexOfScalarPos(u8, data, pos, '\n') orelse data.len;
+                const skip = try self.processSingleLine(data[pos..line_end], data, @min(line_end + 1, data.len), output);
+                pos = line_end + 1;
+                if (skip and pos < data.len) {
+                    pos = (std.mem.indexOfScalarPos(u8, data, pos, '\n') orelse data.len) + 1;
                 }
-                if (idx < text_slice.len and text_slice[idx] == '>') {
-                    idx += 1;
-                    col += 1;
-                    if (idx < text_slice.len) {
-                        const next = text_slice[idx];
-                        if (next == ' ') {
-                            idx += 1;
-                            col += 1;
-                        } else if (next == '\t') {
-                            const tab_width = 4 - (col % 4);
-                            idx += 1;
-                            col += tab_width;
-                            if (tab_width > 0) extra_indent_columns += tab_width - 1;
+            }
+            self.stream_base += data.len;
+            self.pending_buffer.clearRetainingCapacity();
+            self.held_line_end = null;
+            self.scan_pos = 0;
+            self.pending_cr = false;
+            if (dialect.footnotes) try self.closeFootnote();
+            while (self.stack_depth > 0) try self.renderTop(output);
+            if (dialect.footnotes) try self.writeFootnotes(output);
+            if (dialect.wiki_links and self.wiki_holding) try self.flushWikiOutput(output);
+        }
+        fn pushBlock(p: *Self, t: BlockType, i: i32) !void {
+            const _s = p.startCall(.pushBlock);
+            defer p.endCall(.pushBlock, _s);
+            try p.pushBlockExtra(t, i, 0);
+        }
+        fn pushBlockExtra(p: *Self, t: BlockType, i: i32, extra: u8) !void {
+            const _s = p.startCall(.pushBlockExtra);
+            defer p.endCall(.pushBlockExtra, _s);
+            if (p.stack_depth >= MAX_BLOCK_NESTING) return error.NestingTooDeep;
+            p.block_stack[p.stack_depth] = .{ .block_type = t, .indent_level = i, .content_indent = i, .loose = false, .extra_type = extra };
+            if (t == .blockquote) p.blockquote_depth += 1;
+            if (t == .unordered_list or t == .ordered_list) {
+                p.listItemMarkBlock();
+                const idx = self_list_buf_idx: {
+                    try p.list_buffers.append(p.allocator, .{
+                        .bytes = .{},
+                        .meta = .{},
+                        .last_item_idx = null,
+                        .para_count = 0,
+                    });
+                    break :self_list_buf_idx p.list_buffers.items.len - 1;
+                };
+                p.block_stack[p.stack_depth].buffer_index = @intCast(idx);
+                p.active_list_stack_idx = @intCast(p.stack_depth);
+            } else if (t != .paragraph) {
+                p.listItemMarkBlock();
+            }
+            p.stack_depth += 1;
+        }
+        fn pop(p: *Self) void {
+            const _s = p.startCall(.pop);
+            defer p.endCall(.pop, _s);
+            if (p.stack_depth > 0) {
+                const popped_idx = p.stack_depth - 1;
+                const popped = p.block_stack[popped_idx];
+                p.stack_depth -= 1;
+                if (popped.block_type == .blockquote) p.blockquote_depth -= 1;
+                if (p.active_list_stack_idx == @as(i32, @intCast(popped_idx))) {
+                    p.active_list_stack_idx = -1;
+                    var i = p.stack_depth;
+                    while (i > 0) {
+                        i -= 1;
+                        const bt = p.block_stack[i].block_type;
+                        if (bt == .unordered_list or bt == .ordered_list) {
+                            p.active_list_stack_idx = @intCast(i);
+                            break;
                         }
                     }
-                    text_slice = text_slice[idx..];
+                }
+            }
+        }
+        fn topT(p: *const Self) ?BlockType {
+            return if (p.stack_depth > 0) p.block_stack[p.stack_depth - 1].block_type else null;
+        }
+        fn renderTop(p: *Self, o: anytype) !void {
+            if (p.stack_depth == 0) return;
+            const s = p.startCall(.renderTop);
+            defer p.endCall(.renderTop, s);
+            const t = p.block_stack[p.stack_depth - 1].block_type;
+            if (t == .paragraph and p.paragraph_content.items.len == 0) {
+                p.pop();
+                return;
+            }
+            if (t == .table) try p.flushTableBatch(o);
+            if (t == .code and p.code_hooked) try p.writeHookedCode(o);
+            if (t == .math and p.options.math_hook != null) {
+                try p.writeMath(std.mem.trimRight(u8, p.math_body.items, "\n"), true, o);
+                p.math_body.clearRetainingCapacity();
+            }
+            if (t == .indented_code) p.pending_code_blank_lines.clearRetainingCapacity();
+            if (t == .unordered_list or t == .ordered_list) {
+                const list_loose = p.block_stack[p.stack_depth - 1].loose;
+                try p.flushListParagraph(o, list_loose);
+                p.listItemEnd();
+                const close_tag = block_close_tags[@intFromEnum(t)];
+                const lb_idx: usize = @intCast(p.block_stack[p.stack_depth - 1].buffer_index);
+                var lb = &p.list_buffers.items[lb_idx];
+                if (lb.last_item_idx) |idx| {
+                    var last_item = &lb.meta.items[idx];
+                    if (last_item.tag == .item and last_item.end == 0) last_item.end = lb.bytes.items.len;
+                }
+                p.pop();
+                var marks: []const WikiMark = lb.wiki_marks.items;
+                if (list_loose and lb.para_count > 0) {
+                    var cursor: usize = 0;
+                    var i: usize = 0;
+                    while (i < lb.meta.items.len) : (i += 1) {
+                        const p_meta = lb.meta.items[i];
+                        if (p_meta.tag != .paragraph) continue;
+                        if (p_meta.start < cursor or p_meta.end < p_meta.start or p_meta.end > lb.bytes.items.len) {
+                            try p.writeMarked(o, lb.bytes.items, cursor, lb.bytes.items.len, &marks);
+                            cursor = lb.bytes.items.len;
+                            break;
+                        }
+                        try p.writeMarked(o, lb.bytes.items, cursor, p_meta.start, &marks);
+                        try p.writeAll(o, "<p>");
+                        try p.writeMarked(o, lb.bytes.items, p_meta.start, p_meta.end, &marks);
+                        try p.writeAll(o, "</p>\n");
+                        cursor = p_meta.end;
+                    }
+                    if (cursor < lb.bytes.items.len) try p.writeMarked(o, lb.bytes.items, cursor, lb.bytes.items.len, &marks);
+                    try p.writeAll(o, close_tag);
                 } else {
-                    ok = false;
-                    break;
+                    try p.writeMarked(o, lb.bytes.items, 0, lb.bytes.items.len, &marks);
+                    try p.writeAll(o, close_tag);
+                }
+                if (p.pending_loose_idx) |idx| {
+                    if (p.stack_depth == 0 or idx >= p.stack_depth) p.pending_loose_idx = null;
                 }
+                return;
+            }
+            if (p.paragraph_content.items.len > 0) {
+                if (t == .paragraph) {
+                    p.listItemMarkParagraph();
+                    try p.writeAll(o, "<p>");
+                }
+                const start_pos = if (p.currentListBuffer()) |lb| lb.bytes.items.len else 0;
+                try p.renderLeafInline(.paragraph, p.paragraph_content.items, o);
+                if (t != .paragraph) {
+                    if (p.currentListBuffer()) |lb| p.listItemRecordParagraphSpan(start_pos, lb.bytes.items.len);
+                }
+                p.paragraph_content.clearRetainingCapacity();
             }
+            p.pop();
+            if (p.pending_loose_idx) |idx| {
+                if (p.stack_depth == 0 or idx >= p.stack_depth) p.pending_loose_idx = null;
+            }
+            try p.writeAll(o, block_close_tags[@intFromEnum(t)]);
         }
-        return .{ .slice = text_slice, .extra_indent_columns = extra_indent_columns, .ok = ok };
-    }
-    fn isAsciiPunct(c: u32) bool {
-        return (c >= 33 and c <= 47) or (c >= 58 and c <= 64) or (c >= 91 and c <= 96) or (c >= 123 and c <= 126);
-    }
-    fn isPunct(c: u32) bool {
-        if (c < 128) return isAsciiPunct(c);
-        var i: usize = 0;
-        while (i < punct_symbol_ranges.len) : (i += 1) {
-            const r = punct_symbol_ranges[i];
-            if (c < r[0]) break;
-            if (c <= r[1]) return true;
-        }
-        return false;
-    }
-    fn isWhitespace(c: u32) bool {
-        if (c < 128) return c == ' ' or c == '\t' or c == '\n' or c == '\r' or c == 0x0B or c == 0x0C;
-        return c == 0x85 or c == 0xA0 or c == 0x1680 or (c >= 0x2000 and c <= 0x200A) or c == 0x2028 or c == 0x2029 or
-            c == 0x202F or c == 0x205F or c == 0x3000;
-    }
-    fn renderCodeSpanContent(p: *OctomarkParser, content: []const u8, o: anytype) !void {
-        if (content.len == 0) return;
-        var has_non_space = false;
-        for (content) |c| if (!isWhitespace(c)) {
-            has_non_space = true;
-            break;
-        };
-        var start: usize = 0;
-        var end: usize = content.len;
-        // CommonMark 0.31.2: "First, line endings are converted to spaces."
-        // "If the resulting string both begins and ends with a space character, but does not consist entirely of
-        // space characters, a single space character is removed from the front and back."
-        if (has_non_space and content.len >= 2) {
-            const first = if (content[0] == '\n' or content[0] == '\r') @as(u8, ' ') else content[0];
-            const last = if (content[content.len - 1] == '\n' or content[content.len - 1] == '\r')
-                @as(u8, ' ')
-            else
-                content[content.len - 1];
-            if (first == ' ' and last == ' ') {
-                var all_spaces = true;
-                for (content) |c| if (c != ' ' and c != '\n' and c != '\r') {
-                    all_spaces = false;
-                    break;
-                };
-                if (!all_spaces) {
-                    start = 1;
-                    end = content.len - 1;
+        const MemoContext = enum(u8) { paragraph, heading, table_row };
+        /// Whether the block `text` may replay or record memoized output. Footnote numbers, wiki
+        /// link markers, statistics and tokens are produced while rendering, and list items are
+        /// rendered into list buffers, so those blocks are always parsed.
+        fn memoizes(p: *Self, text: []const u8) bool {
+            if (dialect.footnotes or dialect.wiki_links) return false;
+            if (p.options.memo_entries == 0 or text.len > MAX_MEMO_BLOCK) return false;
+            if (p.options.document_stats or p.options.token_sink != null) return false;
+            return p.currentListBufferIndex() == null;
+        }
+        /// Output recorded for the block whose source is `parts`, counting a hit or a miss.
+        fn memoLookup(p: *Self, key: u64, parts: []const []const u8) ?[]const u8 {
+            if (p.memo.len > 0) {
+                const entry = p.memo[key % p.memo.len];
+                if (entry.matches(key, parts)) {
+                    p.memo_hits += 1;
+                    return entry.html;
                 }
             }
+            p.memo_misses += 1;
+            return null;
         }
-        var k = start;
-        while (k < end) {
-            const c = content[k];
-            if (c == '\n' or c == '\r') {
-                try p.writeByte(o, ' ');
-                if (c == '\r' and k + 1 < end and content[k + 1] == '\n') k += 1;
-            } else if (html_escape_map[c]) |e| {
-                try p.writeAll(o, e);
+        /// Record `html` for the block whose source is `parts`, replacing the block that shared
+        /// its slot.
+        fn memoStore(p: *Self, key: u64, parts: []const []const u8, html: []const u8) !void {
+            if (p.memo.len == 0) {
+                p.memo = try p.allocator.alloc(CacheEntry, p.options.memo_entries);
+                @memset(p.memo, .{});
+            }
+            try p.memo[key % p.memo.len].replace(p.allocator, key, parts, try p.allocator.dupe(u8, html));
+        }
+        /// Render the inline content of a paragraph or heading, replaying the output of an
+        /// identical earlier block when memoization applies.
+        fn renderLeafInline(p: *Self, comptime context: MemoContext, text: []const u8, o: anytype) !void {
+            if (!p.memoizes(text)) return p.parseInlineContent(text, o);
+            const parts = [_][]const u8{ &.{@intFromEnum(context)}, text };
+            const key = CacheEntry.hashOf(&parts);
+            if (p.memoLookup(key, &parts)) |html| return p.writeAll(o, html);
+            p.memo_scratch.clearRetainingCapacity();
+            try p.parseInlineContent(text, BufferSink{ .list = &p.memo_scratch, .allocator = p.allocator });
+            try p.memoStore(key, &parts, p.memo_scratch.items);
+            try p.writeAll(o, p.memo_scratch.items);
+        }
+        fn closeP(p: *Self, o: anytype) !void {
+            const _s = p.startCall(.closeP);
+            defer p.endCall(.closeP, _s);
+            if (p.topT() == .paragraph) try p.renderTop(o);
+        }
+        fn tryCloseLeaf(p: *Self, o: anytype) !void {
+            const _s = p.startCall(.tryCloseLeaf);
+            defer p.endCall(.tryCloseLeaf, _s);
+            const t = p.topT() orelse return;
+            if (t == .paragraph or @intFromEnum(t) >= @intFromEnum(BlockType.code)) {
+                try p.renderTop(o);
+            } else if (p.paragraph_content.items.len > 0) {
+                try p.parseInlineContent(p.paragraph_content.items, o);
+                p.paragraph_content.clearRetainingCapacity();
+            }
+        }
+        fn currentListBufferIndex(p: *Self) ?usize {
+            const _s = p.startCall(.currentListBufferIndex);
+            defer p.endCall(.currentListBufferIndex, _s);
+            if (p.active_list_stack_idx >= 0) {
+                const idx = p.block_stack[@intCast(p.active_list_stack_idx)].buffer_index;
+                if (idx >= 0) return @intCast(idx);
+            }
+            return null;
+        }
+        fn currentListBuffer(p: *Self) ?*ListBuffer {
+            return if (p.currentListBufferIndex()) |idx| &p.list_buffers.items[idx] else null;
+        }
+        fn listItemStart(p: *Self) void {
+            const _s = p.startCall(.listItemStart);
+            defer p.endCall(.listItemStart, _s);
+            const idx = p.currentListBufferIndex() orelse return;
+            var lb = &p.list_buffers.items[idx];
+            lb.meta.append(p.allocator, .{
+                .tag = .item,
+                .start = lb.bytes.items.len,
+            }) catch {};
+            lb.last_item_idx = if (lb.meta.items.len > 0) lb.meta.items.len - 1 else null;
+        }
+        fn listItemEnd(p: *Self) void {
+            const _s = p.startCall(.listItemEnd);
+            defer p.endCall(.listItemEnd, _s);
+            const idx = p.currentListBufferIndex() orelse return;
+            var lb = &p.list_buffers.items[idx];
+            if (lb.last_item_idx) |item_idx| {
+                var item = &lb.meta.items[item_idx];
+                if (item.tag == .item and item.end == 0) item.end = lb.bytes.items.len;
+            }
+        }
+        fn listItemMarkBlock(p: *Self) void {
+            const _s = p.startCall(.listItemMarkBlock);
+            defer p.endCall(.listItemMarkBlock, _s);
+            const idx = p.currentListBufferIndex() orelse return;
+            var lb = &p.list_buffers.items[idx];
+            if (lb.last_item_idx) |item_idx| {
+                var item = &lb.meta.items[item_idx];
+                if (item.tag == .item) item.flags |= ListMetaFlags.has_block;
+            }
+        }
+        fn listItemMarkParagraph(p: *Self) void {
+            const _s = p.startCall(.listItemMarkParagraph);
+            defer p.endCall(.listItemMarkParagraph, _s);
+            const idx = p.currentListBufferIndex() orelse return;
+            var lb = &p.list_buffers.items[idx];
+            if (lb.last_item_idx) |item_idx| {
+                var item = &lb.meta.items[item_idx];
+                if (item.tag == .item) item.flags |= ListMetaFlags.has_p;
+            }
+        }
+        fn listItemRecordParagraphSpan(p: *Self, start: usize, end: usize) void {
+            const _s = p.startCall(.listItemRecordParagraphSpan);
+            defer p.endCall(.listItemRecordParagraphSpan, _s);
+            const idx = p.currentListBufferIndex() orelse return;
+            var lb = &p.list_buffers.items[idx];
+            if (lb.last_item_idx == null or end <= start) return;
+            lb.meta.append(p.allocator, .{
+                .tag = .paragraph,
+                .start = start,
+                .end = end,
+            }) catch {};
+            lb.para_count += 1;
+        }
+        inline fn flushListParagraph(p: *Self, o: anytype, wrap_paragraph: bool) !void {
+            if (p.paragraph_content.items.len == 0) return;
+            if (wrap_paragraph) {
+                p.listItemMarkParagraph();
+                try p.writeAll(o, "<p>");
+                try p.parseInlineContent(p.paragraph_content.items, o);
+                try p.writeAll(o, "</p>\n");
             } else {
-                try p.writeByte(o, c);
+                const start_pos = if (p.currentListBuffer()) |lb| lb.bytes.items.len else 0;
+                try p.parseInlineContent(p.paragraph_content.items, o);
+                if (p.currentListBuffer()) |lb| p.listItemRecordParagraphSpan(start_pos, lb.bytes.items.len);
             }
-            k += 1;
+            p.paragraph_content.clearRetainingCapacity();
         }
-    }
-    const InlineHandleResult = struct {
-        handled: bool,
-        emit_char: ?u8,
-    };
-    fn writeEscapedByte(p: *OctomarkParser, o: anytype, ch: u8) !void {
-        if (html_escape_map[ch]) |e| {
-            try p.writeAll(o, e);
-        } else {
-            try p.writeByte(o, ch);
+        inline fn handleBlankLine(p: *Self, o: anytype, suppress_after_idx: ?usize, close_containers: bool) !bool {
+            const top_bt = p.topT();
+            if (top_bt == .paragraph or top_bt == .table or top_bt == .code or top_bt == .math) try p.renderTop(o);
+            const l_idx: ?usize = if (p.active_list_stack_idx >= 0) @intCast(p.active_list_stack_idx) else null;
+            if (l_idx != null and p.paragraph_content.items.len > 0) {
+                const list_loose = p.block_stack[l_idx.?].loose;
+                try p.flushListParagraph(o, list_loose);
+            }
+            if (l_idx) |idx| {
+                const suppress = if (suppress_after_idx) |bq_idx| bq_idx > idx else false;
+                if (!suppress) p.pending_loose_idx = idx;
+            }
+            if (close_containers) {
+                while (p.stack_depth > 0 and p.topT() != null and @intFromEnum(p.topT().?) >=
+                    @intFromEnum(BlockType.blockquote))
+                {
+                    try p.renderTop(o);
+                }
+            }
+            return false;
         }
-    }
-    fn writeLinkUrl(p: *OctomarkParser, url: []const u8, o: anytype) !void {
-        var u: usize = 0;
-        while (u < url.len) {
-            if (url[u] == '&') {
-                var db: [8]u8 = undefined;
-                const dr = decodeEntity(url[u..], &db);
-                if (dr.len > 0) {
-                    for (db[0..dr.len]) |b| {
-                        if (needsPercentEncode(b)) {
-                            try p.writeByte(o, '%');
-                            try p.writeHex(o, b);
-                        } else {
-                            try p.writeEscapedByte(o, b);
+        fn applyPendingLoose(p: *Self, o: anytype) !void {
+            const _s = p.startCall(.applyPendingLoose);
+            defer p.endCall(.applyPendingLoose, _s);
+            _ = o;
+            if (p.pending_loose_idx) |idx| {
+                if (idx < p.stack_depth) {
+                    p.block_stack[idx].loose = true;
+                }
+                p.pending_loose_idx = null;
+            }
+        }
+        fn esc(p: *Self, text: []const u8, o: anytype) !void {
+            const _s = p.startCall(.esc);
+            defer p.endCall(.esc, _s);
+            var i: usize = 0;
+            while (i < text.len) {
+                if (std.mem.indexOfAny(u8, text[i..], "&<>\"'")) |off| {
+                    const j = i + off;
+                    if (j > i) try p.writeAll(o, text[i..j]);
+                    try p.writeAll(o, html_escape_map[text[j]].?);
+                    i = j + 1;
+                } else {
+                    try p.writeAll(o, text[i..]);
+                    break;
+                }
+            }
+        }
+        fn stripBlockquotePrefixes(p: *const Self, line: []const u8) struct { slice: []const u8, extra_indent_columns: usize, ok: bool } {
+            var text_slice = line;
+            var extra_indent_columns: usize = 0;
+            var ok = true;
+            var i: usize = 0;
+            while (i < p.stack_depth) : (i += 1) {
+                const block = p.block_stack[i];
+                if (block.block_type == .blockquote) {
+                    var idx: usize = 0;
+                    var col: usize = 0;
+                    while (idx < text_slice.len) {
+                        const c = text_slice[idx];
+                        if (c == ' ') {
+                            idx += 1;
+                            col += 1;
+                        } else if (c == '\t') {
+                            idx += 1;
+                            col += 4 - (col % 4);
+                        } else break;
+                    }
+                    if (idx < text_slice.len and text_slice[idx] == '>') {
+                        idx += 1;
+                        col += 1;
+                        if (idx < text_slice.len) {
+                            const next = text_slice[idx];
+                            if (next == ' ') {
+                                idx += 1;
+                                col += 1;
+                            } else if (next == '\t') {
+                                const tab_width = 4 - (col % 4);
+                                idx += 1;
+                                col += tab_width;
+                                if (tab_width > 0) extra_indent_columns += tab_width - 1;
+                            }
                         }
+                        text_slice = text_slice[idx..];
+                    } else {
+                        ok = false;
+                        break;
                     }
-                    u += dr.consumed;
-                    continue;
                 }
             }
-            var ch = url[u];
-            if (ch == '\\' and u + 1 < url.len and isAsciiPunct(url[u + 1])) {
-                u += 1;
-                ch = url[u];
+            return .{ .slice = text_slice, .extra_indent_columns = extra_indent_columns, .ok = ok };
+        }
+        fn isAsciiPunct(c: u32) bool {
+            return (c >= 33 and c <= 47) or (c >= 58 and c <= 64) or (c >= 91 and c <= 96) or (c >= 123 and c <= 126);
+        }
+        fn isPunct(c: u32) bool {
+            if (c < 128) return isAsciiPunct(c);
+            var i: usize = 0;
+            while (i < punct_symbol_ranges.len) : (i += 1) {
+                const r = punct_symbol_ranges[i];
+                if (c < r[0]) break;
+                if (c <= r[1]) return true;
             }
-            if (needsPercentEncode(ch)) {
-                if (ch == '%') {
-                    if (u + 2 < url.len and std.ascii.isHex(url[u + 1]) and std.ascii.isHex(url[u + 2])) {
-                        try p.writeByte(o, ch);
-                    } else {
-                        try p.writeAll(o, "%25");
+            return false;
+        }
+        fn isWhitespace(c: u32) bool {
+            if (c < 128) return c == ' ' or c == '\t' or c == '\n' or c == '\r' or c == 0x0B or c == 0x0C;
+            return c == 0x85 or c == 0xA0 or c == 0x1680 or (c >= 0x2000 and c <= 0x200A) or c == 0x2028 or c == 0x2029 or
+                c == 0x202F or c == 0x205F or c == 0x3000;
+        }
+        fn renderCodeSpanContent(p: *Self, content: []const u8, o: anytype) !void {
+            if (content.len == 0) return;
+            var has_non_space = false;
+            for (content) |c| if (!isWhitespace(c)) {
+                has_non_space = true;
+                break;
+            };
+            var start: usize = 0;
+            var end: usize = content.len;
+            // CommonMark 0.31.2: "First, line endings are converted to spaces."
+            // "If the resulting string both begins and ends with a space character, but does not consist entirely of
+            // space characters, a single space character is removed from the front and back."
+            if (has_non_space and content.len >= 2) {
+                const first = if (content[0] == '\n' or content[0] == '\r') @as(u8, ' ') else content[0];
+                const last = if (content[content.len - 1] == '\n' or content[content.len - 1] == '\r')
+                    @as(u8, ' ')
+                else
+                    content[content.len - 1];
+                if (first == ' ' and last == ' ') {
+                    var all_spaces = true;
+                    for (content) |c| if (c != ' ' and c != '\n' and c != '\r') {
+                        all_spaces = false;
+                        break;
+                    };
+                    if (!all_spaces) {
+                        start = 1;
+                        end = content.len - 1;
                     }
+                }
+            }
+            var k = start;
+            while (k < end) {
+                const c = content[k];
+                if (c == '\n' or c == '\r') {
+                    try p.writeByte(o, ' ');
+                    if (c == '\r' and k + 1 < end and content[k + 1] == '\n') k += 1;
+                } else if (html_escape_map[c]) |e| {
+                    try p.writeAll(o, e);
                 } else {
-                    try p.writeByte(o, '%');
-                    try p.writeHex(o, ch);
+                    try p.writeByte(o, c);
                 }
+                k += 1;
+            }
+        }
+        const InlineHandleResult = struct {
+            handled: bool,
+            emit_char: ?u8,
+        };
+        fn writeEscapedByte(p: *Self, o: anytype, ch: u8) !void {
+            if (html_escape_map[ch]) |e| {
+                try p.writeAll(o, e);
             } else {
-                try p.writeEscapedByte(o, ch);
+                try p.writeByte(o, ch);
             }
-            u += 1;
         }
-    }
-    fn writeLinkTitle(p: *OctomarkParser, title: []const u8, o: anytype) !void {
-        var ti: usize = 0;
-        while (ti < title.len) {
-            if (title[ti] == '&') {
-                var db: [8]u8 = undefined;
-                const dr = decodeEntity(title[ti..], &db);
-                if (dr.len > 0) {
-                    try p.esc(db[0..dr.len], o);
-                    ti += dr.consumed;
-                    continue;
+        fn writeLinkUrl(p: *Self, url: []const u8, o: anytype) !void {
+            if (p.options.sanitize and isDangerousUrl(url)) return;
+            try p.writeUrl(url, o, true);
+        }
+        /// Write `url` for an attribute value. Runs of `.safe` bytes are copied in bulk, other bytes
+        /// become 3-byte percent escapes and `'` is HTML-escaped, all in one pass. Link destinations
+        /// (`link`) also decode entities, drop backslash escapes and keep valid `%XX`.
+        fn writeUrl(p: *Self, url: []const u8, o: anytype, comptime link: bool) !void {
+            var u: usize = 0;
+            while (u < url.len) {
+                const run_end = indexOfUrlUnsafe(url, u);
+                try p.writeAll(o, url[u..run_end]);
+                u = run_end;
+                if (u >= url.len) break;
+                switch (url_class_table[url[u]]) {
+                    .safe => unreachable,
+                    .encode => u = try p.writePercentRun(url, u, o),
+                    .quote => {
+                        try p.writeAll(o, "&#39;");
+                        u += 1;
+                    },
+                    .ampersand => {
+                        if (link) {
+                            var db: [8]u8 = undefined;
+                            const dr = decodeEntity(url[u..], &db);
+                            if (dr.len > 0) {
+                                for (db[0..dr.len]) |b| try p.writeUrlByte(o, b);
+                                u += dr.consumed;
+                                continue;
+                            }
+                        }
+                        try p.writeAll(o, if (link) "%26" else "&amp;");
+                        u += 1;
+                    },
+                    .percent => {
+                        const keep = link and u + 2 < url.len and std.ascii.isHex(url[u + 1]) and std.ascii.isHex(url[u + 2]);
+                        try p.writeAll(o, if (keep) "%" else "%25");
+                        u += 1;
+                    },
+                    .backslash => {
+                        if (link and u + 1 < url.len and isAsciiPunct(url[u + 1])) {
+                            u += 1;
+                            if (url[u] == '%') continue;
+                            try p.writeUrlByte(o, url[u]);
+                        } else {
+                            try p.writeAll(o, "%5C");
+                        }
+                        u += 1;
+                    },
                 }
             }
-            if (title[ti] == '\\' and ti + 1 < title.len and isAsciiPunct(title[ti + 1])) {
-                ti += 1;
+        }
+        /// Percent-encode the run of `.encode` bytes at `start` with one write per 16 bytes.
+        /// Returns the end of the run.
+        fn writePercentRun(p: *Self, url: []const u8, start: usize, o: anytype) !usize {
+            var buf: [48]u8 = undefined;
+            var u = start;
+            while (u < url.len and url_class_table[url[u]] == .encode) {
+                var n: usize = 0;
+                while (n < buf.len and u < url.len and url_class_table[url[u]] == .encode) : (u += 1) {
+                    buf[n..][0..3].* = percentEscape(url[u]);
+                    n += 3;
+                }
+                try p.writeAll(o, buf[0..n]);
             }
-            try p.writeEscapedByte(o, title[ti]);
-            ti += 1;
+            return u;
         }
-    }
-    fn writeAutolinkHref(p: *OctomarkParser, text: []const u8, o: anytype) !void {
-        for (text) |ch| {
-            if (ch == '\\') {
-                try p.writeAll(o, "%5C");
-            } else if (ch == '&') {
-                try p.writeAll(o, "&amp;");
-            } else if (needsPercentEncode(ch)) {
-                if (ch == '%') {
-                    try p.writeAll(o, "%25");
-                } else {
-                    try p.writeByte(o, '%');
-                    try p.writeHex(o, ch);
+        /// Write one decoded or backslash-escaped URL byte.
+        fn writeUrlByte(p: *Self, o: anytype, b: u8) !void {
+            switch (url_class_table[b]) {
+                .safe => try p.writeByte(o, b),
+                .quote => try p.writeAll(o, "&#39;"),
+                else => try p.writeAll(o, &percentEscape(b)),
+            }
+        }
+        fn writeLinkTitle(p: *Self, title: []const u8, o: anytype) !void {
+            var ti: usize = 0;
+            while (ti < title.len) {
+                if (title[ti] == '&') {
+                    var db: [8]u8 = undefined;
+                    const dr = decodeEntity(title[ti..], &db);
+                    if (dr.len > 0) {
+                        try p.esc(db[0..dr.len], o);
+                        ti += dr.consumed;
+                        continue;
+                    }
                 }
-            } else {
-                try p.writeEscapedByte(o, ch);
+                if (title[ti] == '\\' and ti + 1 < title.len and isAsciiPunct(title[ti + 1])) {
+                    ti += 1;
+                }
+                try p.writeEscapedByte(o, title[ti]);
+                ti += 1;
             }
         }
-    }
-    fn handleInlineBackslash(p: *OctomarkParser, text: []const u8, i: *usize, o: anytype) !InlineHandleResult {
-        if (i.* + 1 < text.len) {
-            const n = text[i.* + 1];
-            if (n == '\n' or n == '\r') {
-                try p.writeAll(o, "<br>\n");
-                if (n == '\r' and i.* + 2 < text.len and text[i.* + 2] == '\n') {
-                    i.* += 3;
-                } else {
+        fn writeAutolinkHref(p: *Self, text: []const u8, o: anytype) !void {
+            if (p.options.sanitize and isDangerousUrl(text)) return;
+            try p.writeUrl(text, o, false);
+        }
+        fn handleInlineBackslash(p: *Self, text: []const u8, i: *usize, o: anytype) !InlineHandleResult {
+            if (i.* + 1 < text.len) {
+                const n = text[i.* + 1];
+                if (n == '\n' or n == '\r') {
+                    try p.writeAll(o, "<br>\n");
+                    if (n == '\r' and i.* + 2 < text.len and text[i.* + 2] == '\n') {
+                        i.* += 3;
+                    } else {
+                        i.* += 2;
+                    }
+                    return .{ .handled = true, .emit_char = null };
+                }
+                if (isAsciiPunct(n)) {
                     i.* += 2;
+                    return .{ .handled = true, .emit_char = n };
                 }
-                return .{ .handled = true, .emit_char = null };
-            }
-            if (isAsciiPunct(n)) {
-                i.* += 2;
-                return .{ .handled = true, .emit_char = n };
+                i.* += 1;
+                return .{ .handled = true, .emit_char = '\\' };
             }
             i.* += 1;
             return .{ .handled = true, .emit_char = '\\' };
         }
-        i.* += 1;
-        return .{ .handled = true, .emit_char = '\\' };
-    }
-    fn handleInlineCodeSpan(p: *OctomarkParser, text: []const u8, i: *usize, o: anytype, plain: bool) !InlineHandleResult {
-        var cnt: usize = 1;
-        while (i.* + cnt < text.len and text[i.* + cnt] == '`') cnt += 1;
-        if (OctomarkParser.findClosingBackticks(text, i.* + cnt, cnt)) |m_pos| {
-            const content = text[i.* + cnt .. m_pos];
-            if (!plain) try p.writeAll(o, "<code>");
-            try p.renderCodeSpanContent(content, o);
-            if (!plain) try p.writeAll(o, "</code>");
-            i.* = m_pos + cnt;
-        } else {
-            if (html_escape_map['`']) |e| {
-                var k: usize = 0;
-                while (k < cnt) : (k += 1) try p.writeAll(o, e);
+        fn handleInlineCodeSpan(p: *Self, text: []const u8, i: *usize, o: anytype, plain: bool) !InlineHandleResult {
+            var cnt: usize = 1;
+            while (i.* + cnt < text.len and text[i.* + cnt] == '`') cnt += 1;
+            if (Self.findClosingBackticks(text, i.* + cnt, cnt)) |m_pos| {
+                const content = text[i.* + cnt .. m_pos];
+                if (!plain) try p.writeAll(o, "<code>");
+                try p.renderCodeSpanContent(content, o);
+                if (!plain) try p.visibleText(content, .code);
+                if (!plain) try p.writeAll(o, "</code>");
+                i.* = m_pos + cnt;
             } else {
-                var k: usize = 0;
-                while (k < cnt) : (k += 1) try p.writeByte(o, '`');
+                if (html_escape_map['`']) |e| {
+                    var k: usize = 0;
+                    while (k < cnt) : (k += 1) try p.writeAll(o, e);
+                } else {
+                    var k: usize = 0;
+                    while (k < cnt) : (k += 1) try p.writeByte(o, '`');
+                }
+                i.* += cnt;
             }
-            i.* += cnt;
+            return .{ .handled = true, .emit_char = null };
         }
-        return .{ .handled = true, .emit_char = null };
-    }
-    fn handleInlineLink(p: *OctomarkParser, text: []const u8, i: *usize, o: anytype, depth: usize, plain: bool) !InlineHandleResult {
-        const img = (text[i.*] == '!');
-        if (!img or (i.* + 1 < text.len and text[i.* + 1] == '[')) {
-            if (parseInlineLink(p, text, i.*, img)) |m| {
-                const label = text[m.label_start..m.label_end];
-                if (img or !labelHasLinkLike(p, label)) {
-                    if (plain) {
-                        try p.parseInlineContentScoped(label, o, depth + 1, true);
-                    } else {
-                        const url = text[m.dest.dest_start..m.dest.dest_end];
-                        const tit = if (m.dest.title_start) |ts| text[ts..m.dest.title_end.?] else null;
-                        try p.writeAll(o, if (img) "<img src=\"" else "<a href=\"");
-                        try p.writeLinkUrl(url, o);
-                        try p.writeByte(o, '"');
-                        if (tit) |t| {
-                            try p.writeAll(o, " title=\"");
-                            try p.writeLinkTitle(t, o);
-                            try p.writeByte(o, '"');
+        fn handleInlineLink(p: *Self, text: []const u8, i: *usize, o: anytype, depth: usize, plain: bool) !InlineHandleResult {
+            const img = (text[i.*] == '!');
+            if (dialect.wiki_links and !img and !p.in_link_label) {
+                if (matchWikiLink(text, i.*)) |w| {
+                    try p.writeWikiLink(w, o, depth, plain);
+                    i.* = w.end;
+                    return .{ .handled = true, .emit_char = null };
+                }
+            }
+            if (dialect.footnotes and !img) {
+                if (parseFootnoteMarker(text, i.*)) |m| {
+                    try p.writeFootnoteRef(m.label, o, plain);
+                    i.* = m.end;
+                    return .{ .handled = true, .emit_char = null };
+                }
+            }
+            if (!img or (i.* + 1 < text.len and text[i.* + 1] == '[')) {
+                if (parseInlineLink(p, text, i.*, img)) |m| {
+                    const label = text[m.label_start..m.label_end];
+                    if (img or !labelHasLinkLike(p, label)) {
+                        const in_label = p.in_link_label;
+                        p.in_link_label = true;
+                        defer p.in_link_label = in_label;
+                        if (!plain and p.options.document_stats) {
+                            if (img) p.doc_stats.images += 1 else p.doc_stats.links += 1;
                         }
-                        if (img) {
-                            try p.writeAll(o, " alt=\"");
+                        if (plain) {
                             try p.parseInlineContentScoped(label, o, depth + 1, true);
-                            try p.writeAll(o, "\">");
                         } else {
-                            try p.writeAll(o, ">");
-                            try p.parseInlineContentScoped(label, o, depth + 1, false);
-                            try p.writeAll(o, "</a>");
+                            const url = text[m.dest.dest_start..m.dest.dest_end];
+                            const tit = if (m.dest.title_start) |ts| text[ts..m.dest.title_end.?] else null;
+                            try p.writeAll(o, if (img) "<img src=\"" else "<a href=\"");
+                            try p.writeLinkUrl(url, o);
+                            try p.writeByte(o, '"');
+                            if (tit) |t| {
+                                try p.writeAll(o, " title=\"");
+                                try p.writeLinkTitle(t, o);
+                                try p.writeByte(o, '"');
+                            }
+                            if (img) {
+                                try p.writeAll(o, " alt=\"");
+                                try p.parseInlineContentScoped(label, o, depth + 1, true);
+                                try p.writeAll(o, "\">");
+                            } else {
+                                try p.writeAll(o, ">");
+                                try p.parseInlineContentScoped(label, o, depth + 1, false);
+                                try p.writeAll(o, "</a>");
+                            }
                         }
+                        i.* = m.dest.end;
+                        return .{ .handled = true, .emit_char = null };
                     }
-                    i.* = m.dest.end;
-                    return .{ .handled = true, .emit_char = null };
+                    i.* += 1;
+                    return .{ .handled = true, .emit_char = '[' };
                 }
-                i.* += 1;
-                return .{ .handled = true, .emit_char = '[' };
             }
+            return .{ .handled = false, .emit_char = null };
         }
-        return .{ .handled = false, .emit_char = null };
-    }
-    fn handleInlineAngle(p: *OctomarkParser, text: []const u8, i: *usize, o: anytype, plain: bool) !InlineHandleResult {
-        if (parseAutolink(text, i.*)) |a| {
-            const lc = text[a.content_start..a.content_end];
+        fn writeAutolink(p: *Self, url: []const u8, prefix: []const u8, o: anytype, plain: bool) !void {
             if (!plain) {
+                p.doc_stats.links += @intFromBool(p.options.document_stats);
                 try p.writeAll(o, "<a href=\"");
-                if (a.is_email) try p.writeAll(o, "mailto:");
-                try p.writeAutolinkHref(lc, o);
+                try p.writeAll(o, prefix);
+                try p.writeAutolinkHref(url, o);
                 try p.writeAll(o, "\">");
             }
-            try p.esc(lc, o);
+            try p.esc(url, o);
             if (!plain) try p.writeAll(o, "</a>");
-            i.* = a.end;
-            return .{ .handled = true, .emit_char = null };
         }
-        if (p.options.enable_html) {
-            const l = p.parseHtmlTag(text[i.*..]);
-            if (l > 0) {
-                if (!plain) try p.writeAll(o, text[i.* .. i.* + l]);
-                i.* += l;
+        fn handleInlineAngle(p: *Self, text: []const u8, i: *usize, o: anytype, plain: bool) !InlineHandleResult {
+            if (parseAutolink(text, i.*)) |a| {
+                const lc = text[a.content_start..a.content_end];
+                try p.writeAutolink(lc, if (a.is_email) "mailto:" else "", o, plain);
+                i.* = a.end;
                 return .{ .handled = true, .emit_char = null };
             }
+            if (dialect.html and p.options.enable_html) {
+                const l = p.parseHtmlTag(text[i.*..]);
+                if (l > 0) {
+                    if (!plain) try p.writeRawHtml(text[i.* .. i.* + l], o);
+                    i.* += l;
+                    return .{ .handled = true, .emit_char = null };
+                }
+            }
+            return .{ .handled = false, .emit_char = null };
         }
-        return .{ .handled = false, .emit_char = null };
-    }
-    fn handleInlineMath(p: *OctomarkParser, text: []const u8, i: *usize, o: anytype, plain: bool) !InlineHandleResult {
-        var m_e: ?usize = null;
-        var k = i.* + 1;
-        while (k < text.len) : (k += 1) {
-            if (text[k] == '\\' and k + 1 < text.len) {
-                k += 1;
-                continue;
+        fn handleInlineMath(p: *Self, text: []const u8, i: *usize, o: anytype, plain: bool) !InlineHandleResult {
+            var m_e: ?usize = null;
+            var k = i.* + 1;
+            while (k < text.len) : (k += 1) {
+                if (text[k] == '\\' and k + 1 < text.len) {
+                    k += 1;
+                    continue;
+                }
+                if (text[k] == '$') {
+                    m_e = k;
+                    break;
+                }
             }
-            if (text[k] == '$') {
-                m_e = k;
-                break;
+            if (m_e) |j| {
+                const tex = text[i.* + 1 .. j];
+                if (plain) {
+                    try p.esc(tex, o);
+                } else {
+                    try p.writeAll(o, "<span class=\"math\">");
+                    if (p.options.math_hook != null) try p.writeMath(tex, false, o) else try p.esc(tex, o);
+                    try p.writeAll(o, "</span>");
+                }
+                i.* = j + 1;
+                return .{ .handled = true, .emit_char = null };
             }
+            return .{ .handled = false, .emit_char = null };
         }
-        if (m_e) |j| {
-            if (!plain) try p.writeAll(o, "<span class=\"math\">");
-            try p.esc(text[i.* + 1 .. j], o);
-            if (!plain) try p.writeAll(o, "</span>");
-            i.* = j + 1;
+        fn handleInlineEntity(p: *Self, text: []const u8, i: *usize, o: anytype) !InlineHandleResult {
+            var db: [8]u8 = undefined;
+            const dr = decodeEntity(text[i.*..], &db);
+            if (dr.len > 0) {
+                try p.esc(db[0..dr.len], o);
+                p.countVisible(db[0..dr.len]);
+                i.* += dr.consumed;
+            } else {
+                try p.writeAll(o, "&amp;");
+                p.countVisible("&");
+                i.* += 1;
+            }
             return .{ .handled = true, .emit_char = null };
         }
-        return .{ .handled = false, .emit_char = null };
-    }
-    fn handleInlineEntity(p: *OctomarkParser, text: []const u8, i: *usize, o: anytype) !InlineHandleResult {
-        var db: [8]u8 = undefined;
-        const dr = decodeEntity(text[i.*..], &db);
-        if (dr.len > 0) {
-            try p.esc(db[0..dr.len], o);
-            i.* += dr.consumed;
-        } else {
-            try p.writeAll(o, "&amp;");
-            i.* += 1;
-        }
-        return .{ .handled = true, .emit_char = null };
-    }
-    fn handleInlineSpecial(p: *OctomarkParser, text: []const u8, i: *usize, o: anytype, depth: usize, plain: bool) !InlineHandleResult {
-        const c = text[i.*];
-        switch (c) {
-            '\\' => return try p.handleInlineBackslash(text, i, o),
-            '~' => {
-                if (std.mem.startsWith(u8, text[i.*..], "~~")) {
-                    i.* += 2;
+        fn handleInlineSpecial(p: *Self, text: []const u8, i: *usize, o: anytype, depth: usize, plain: bool) !InlineHandleResult {
+            const c = text[i.*];
+            switch (c) {
+                '\\' => return try p.handleInlineBackslash(text, i, o),
+                '~' => {
+                    if (std.mem.startsWith(u8, text[i.*..], "~~")) {
+                        i.* += 2;
+                        return .{ .handled = true, .emit_char = null };
+                    }
+                },
+                '`' => return try p.handleInlineCodeSpan(text, i, o, plain),
+                '[', '!' => return try p.handleInlineLink(text, i, o, depth, plain),
+                '<' => return try p.handleInlineAngle(text, i, o, plain),
+                '$' => if (dialect.math) return try p.handleInlineMath(text, i, o, plain),
+                '&' => return try p.handleInlineEntity(text, i, o),
+                '"', '\'' => {
+                    if (dialect.smart_punctuation) {
+                        try p.writeAll(o, p.smartQuote(text, i.*));
+                    } else try p.writeAll(o, html_escape_map[c].?);
+                    if (!plain) p.countVisible(text[i.* .. i.* + 1]);
+                    i.* += 1;
                     return .{ .handled = true, .emit_char = null };
-                }
-            },
-            '`' => return try p.handleInlineCodeSpan(text, i, o, plain),
-            '[', '!' => return try p.handleInlineLink(text, i, o, depth, plain),
-            '<' => return try p.handleInlineAngle(text, i, o, plain),
-            '$' => return try p.handleInlineMath(text, i, o, plain),
-            '&' => return try p.handleInlineEntity(text, i, o),
-            '>', '"', '\'' => {
-                try p.writeAll(o, html_escape_map[c].?);
-                i.* += 1;
-                return .{ .handled = true, .emit_char = null };
-            },
-            else => {},
+                },
+                '>' => {
+                    try p.writeAll(o, html_escape_map[c].?);
+                    if (!plain) p.countVisible(text[i.* .. i.* + 1]);
+                    i.* += 1;
+                    return .{ .handled = true, .emit_char = null };
+                },
+                '-', '.' => if (dialect.smart_punctuation) return try p.handleSmartRun(text, i, o, plain),
+                else => {},
+            }
+            return .{ .handled = false, .emit_char = null };
         }
-        return .{ .handled = false, .emit_char = null };
-    }
-    fn findSpec(p: *OctomarkParser, text: []const u8, start: usize) usize {
-        const s = p.startCall(.findSpec);
-        defer p.endCall(.findSpec, s);
-        return if (std.mem.indexOfAny(u8, text[start..], special_chars)) |off| start + off else text.len;
-    }
-    fn isSpaceOrNl(c: u8) bool {
-        return c == ' ' or c == '\t' or c == '\n' or c == '\r';
-    }
-    fn findLabelEnd(p: *OctomarkParser, text: []const u8, label_start: usize) ?usize {
-        const _s = p.startCall(.findLabelEnd);
-        defer p.endCall(.findLabelEnd, _s);
-        var depth: usize = 1;
-        var k = label_start;
-        while (k < text.len) : (k += 1) {
-            if (text[k] == '\\' and k + 1 < text.len) {
-                k += 1;
-                continue;
+        /// Curly form of the quote at `i`: closing when right-flanking (which covers apostrophes),
+        /// opening when only left-flanking, and an opening double or closing single quote otherwise.
+        fn smartQuote(p: *Self, text: []const u8, i: usize) []const u8 {
+            const f = p.flanking(text, i, i + 1);
+            const single = text[i] == '\'';
+            if (f.right) return if (single) "\u{2019}" else "\u{201D}";
+            if (f.left) return if (single) "\u{2018}" else "\u{201C}";
+            return if (single) "\u{2019}" else "\u{201C}";
+        }
+        /// Dashes for a run of `-` (all em dashes when the length divides by 3, else all en dashes
+        /// when even, else em dashes and then one or two en dashes) and ellipses for `...`.
+        fn handleSmartRun(p: *Self, text: []const u8, i: *usize, o: anytype, plain: bool) !InlineHandleResult {
+            const c = text[i.*];
+            var n: usize = 1;
+            while (i.* + n < text.len and text[i.* + n] == c) n += 1;
+            i.* += n;
+            if (c == '.') {
+                for (0..n / 3) |_| try p.writeGlyph(o, "\u{2026}", plain);
+                for (0..n % 3) |_| try p.writeGlyph(o, ".", plain);
+                return .{ .handled = true, .emit_char = null };
             }
-            if (text[k] == '<') {
-                if (parseAutolink(text, k)) |a| {
-                    k = a.end - 1;
+            if (n == 1) return .{ .handled = true, .emit_char = '-' };
+            var em: usize = 0;
+            var en: usize = 0;
+            if (n % 3 == 0) {
+                em = n / 3;
+            } else if (n % 2 == 0) {
+                en = n / 2;
+            } else if (n % 3 == 2) {
+                em = (n - 2) / 3;
+                en = 1;
+            } else {
+                em = (n - 4) / 3;
+                en = 2;
+            }
+            for (0..em) |_| try p.writeGlyph(o, "\u{2014}", plain);
+            for (0..en) |_| try p.writeGlyph(o, "\u{2013}", plain);
+            return .{ .handled = true, .emit_char = null };
+        }
+        /// Write punctuation that replaces source text and count it as visible.
+        fn writeGlyph(p: *Self, o: anytype, glyph: []const u8, plain: bool) !void {
+            try p.writeAll(o, glyph);
+            if (!plain) p.countVisible(glyph);
+        }
+        fn findSpec(p: *Self, text: []const u8, start: usize) usize {
+            const s = p.startCall(.findSpec);
+            defer p.endCall(.findSpec, s);
+            return if (std.mem.indexOfAny(u8, text[start..], special)) |off| start + off else text.len;
+        }
+        fn isSpaceOrNl(c: u8) bool {
+            return c == ' ' or c == '\t' or c == '\n' or c == '\r';
+        }
+        fn findLabelEnd(p: *Self, text: []const u8, label_start: usize) ?usize {
+            const _s = p.startCall(.findLabelEnd);
+            defer p.endCall(.findLabelEnd, _s);
+            var depth: usize = 1;
+            var k = label_start;
+            while (k < text.len) : (k += 1) {
+                if (text[k] == '\\' and k + 1 < text.len) {
+                    k += 1;
                     continue;
                 }
-                const l = p.parseHtmlTag(text[k..]);
-                if (l > 0) {
-                    k += l - 1;
-                    continue;
+                if (text[k] == '<') {
+                    if (parseAutolink(text, k)) |a| {
+                        k = a.end - 1;
+                        continue;
+                    }
+                    const l = p.parseHtmlTag(text[k..]);
+                    if (l > 0) {
+                        k += l - 1;
+                        continue;
+                    }
+                }
+                if (text[k] == '`') {
+                    var run_len: usize = 1;
+                    while (k + run_len < text.len and text[k + run_len] == '`') run_len += 1;
+                    if (Self.findClosingBackticks(text, k + run_len, run_len)) |m_pos| {
+                        k = m_pos + run_len - 1;
+                        continue;
+                    }
+                    return null;
+                }
+                if (text[k] == ']') {
+                    depth -= 1;
+                    if (depth == 0) return k;
+                } else if (text[k] == '[') {
+                    depth += 1;
                 }
             }
-            if (text[k] == '`') {
-                var run_len: usize = 1;
-                while (k + run_len < text.len and text[k + run_len] == '`') run_len += 1;
-                if (OctomarkParser.findClosingBackticks(text, k + run_len, run_len)) |m_pos| {
-                    k = m_pos + run_len - 1;
-                    continue;
+            return null;
+        }
+        const LinkDest = struct { dest_start: usize, dest_end: usize, title_start: ?usize, title_end: ?usize, end: usize };
+        fn parseLinkDestination(text: []const u8, start: usize) ?LinkDest {
+            var i = start;
+            while (i < text.len and isSpaceOrNl(text[i])) : (i += 1) {}
+            if (i >= text.len) return null;
+            const raw_start = i;
+            var dest_start: usize = i;
+            var dest_end: usize = i;
+            var angle = false;
+            if (text[i] == '<') {
+                var j = i + 1;
+                var ok = true;
+                while (j < text.len) : (j += 1) {
+                    const ch = text[j];
+                    if (ch == '\\' and j + 1 < text.len and isAsciiPunct(text[j + 1])) {
+                        j += 1;
+                        continue;
+                    }
+                    if (ch == '>') {
+                        dest_start = i + 1;
+                        dest_end = j;
+                        j += 1;
+                        if (j < text.len and !isSpaceOrNl(text[j]) and text[j] != ')') ok = false else angle = true;
+                        i = j;
+                        break;
+                    }
+                    if (ch == '\n' or ch == '\r') {
+                        ok = false;
+                        break;
+                    }
                 }
-                return null;
+                if (!ok) angle = false;
             }
-            if (text[k] == ']') {
-                depth -= 1;
-                if (depth == 0) return k;
-            } else if (text[k] == '[') {
-                depth += 1;
+            if (!angle) {
+                if (text[raw_start] == '<') return null;
+                i = raw_start;
+                dest_start = raw_start;
+                var depth: usize = 0;
+                while (i < text.len) {
+                    const ch = text[i];
+                    if (ch == '\\' and i + 1 < text.len and isAsciiPunct(text[i + 1])) {
+                        i += 2;
+                        continue;
+                    }
+                    if (ch == '(') {
+                        depth += 1;
+                        i += 1;
+                        continue;
+                    }
+                    if (ch == ')') {
+                        if (depth == 0) break;
+                        depth -= 1;
+                        i += 1;
+                        continue;
+                    }
+                    if (isSpaceOrNl(ch)) break;
+                    i += 1;
+                }
+                dest_end = i;
             }
-        }
-        return null;
-    }
-    const LinkDest = struct { dest_start: usize, dest_end: usize, title_start: ?usize, title_end: ?usize, end: usize };
-    fn parseLinkDestination(text: []const u8, start: usize) ?LinkDest {
-        var i = start;
-        while (i < text.len and isSpaceOrNl(text[i])) : (i += 1) {}
-        if (i >= text.len) return null;
-        const raw_start = i;
-        var dest_start: usize = i;
-        var dest_end: usize = i;
-        var angle = false;
-        if (text[i] == '<') {
-            var j = i + 1;
-            var ok = true;
+            var j = i;
+            while (j < text.len and isSpaceOrNl(text[j])) : (j += 1) {}
+            if (j < text.len and text[j] == ')') {
+                return .{ .dest_start = dest_start, .dest_end = dest_end, .title_start = null, .title_end = null, .end = j + 1 };
+            }
+            if (j >= text.len) return null;
+            const open = text[j];
+            if (open != '"' and open != '\'' and open != '(') return null;
+            const close: u8 = if (open == '(') ')' else open;
+            j += 1;
+            const title_start = j;
+            var title_end: ?usize = null;
             while (j < text.len) : (j += 1) {
                 const ch = text[j];
                 if (ch == '\\' and j + 1 < text.len and isAsciiPunct(text[j + 1])) {
                     j += 1;
                     continue;
                 }
-                if (ch == '>') {
-                    dest_start = i + 1;
-                    dest_end = j;
+                if (ch == close) {
+                    title_end = j;
                     j += 1;
-                    if (j < text.len and !isSpaceOrNl(text[j]) and text[j] != ')') ok = false else angle = true;
-                    i = j;
                     break;
                 }
-                if (ch == '\n' or ch == '\r') {
-                    ok = false;
-                    break;
+            }
+            if (title_end == null) return null;
+            while (j < text.len and isSpaceOrNl(text[j])) : (j += 1) {}
+            if (j < text.len and text[j] == ')') {
+                return .{ .dest_start = dest_start, .dest_end = dest_end, .title_start = title_start, .title_end = title_end, .end = j + 1 };
+            }
+            return null;
+        }
+        const LinkMatch = struct { label_start: usize, label_end: usize, dest: LinkDest, is_image: bool };
+        fn parseInlineLink(p: *Self, text: []const u8, start: usize, is_image: bool) ?LinkMatch {
+            const _s = p.startCall(.parseInlineLink);
+            defer p.endCall(.parseInlineLink, _s);
+            if (is_image) {
+                if (start + 1 >= text.len or text[start + 1] != '[') return null;
+            } else if (text[start] != '[') return null;
+            const label_start = if (is_image) start + 2 else start + 1;
+            const label_end = findLabelEnd(p, text, label_start) orelse return null;
+            if (label_end + 1 >= text.len or text[label_end + 1] != '(') return null;
+            const dest = parseLinkDestination(text, label_end + 2) orelse return null;
+            return .{ .label_start = label_start, .label_end = label_end, .dest = dest, .is_image = is_image };
+        }
+        const Autolink = struct { end: usize, is_email: bool, content_start: usize, content_end: usize };
+        fn parseAutolink(text: []const u8, start: usize) ?Autolink {
+            if (start + 1 >= text.len or text[start] != '<') return null;
+            if (std.mem.indexOfScalar(u8, text[start + 1 ..], '>')) |off| {
+                const lc = text[start + 1 .. start + 1 + off];
+                if (std.mem.indexOfAny(u8, lc, " \t\n") != null) return null;
+                var al = false;
+                var em_l = false;
+                if (std.mem.indexOfScalar(u8, lc, ':')) |sc_i| {
+                    const sch = lc[0..sc_i];
+                    if (sch.len >= 2 and sch.len <= 32 and std.ascii.isAlphabetic(sch[0])) {
+                        al = true;
+                        for (sch[1..]) |sc| if (!std.ascii.isAlphanumeric(sc) and sc != '+' and sc != '.' and sc != '-') {
+                            al = false;
+                            break;
+                        };
+                    }
+                } else if (std.mem.indexOfScalar(u8, lc, '@')) |a| {
+                    if (a > 0 and a < lc.len - 1 and std.mem.indexOfScalar(u8, lc[a + 1 ..], '.') != null) {
+                        al = true;
+                        em_l = true;
+                    }
                 }
+                if (al and std.mem.indexOfAny(u8, lc, if (em_l) " \t\n\\" else " \t\n") != null) al = false;
+                if (al) return .{ .end = start + off + 2, .is_email = em_l, .content_start = start + 1, .content_end = start + 1 + off };
             }
-            if (!ok) angle = false;
+            return null;
         }
-        if (!angle) {
-            if (text[raw_start] == '<') return null;
-            i = raw_start;
-            dest_start = raw_start;
-            var depth: usize = 0;
+        fn labelHasLinkLike(p: *Self, text: []const u8) bool {
+            const _s = p.startCall(.labelHasLinkLike);
+            defer p.endCall(.labelHasLinkLike, _s);
+            var i: usize = 0;
             while (i < text.len) {
-                const ch = text[i];
-                if (ch == '\\' and i + 1 < text.len and isAsciiPunct(text[i + 1])) {
+                const c = text[i];
+                if (c == '\\' and i + 1 < text.len) {
                     i += 2;
                     continue;
                 }
-                if (ch == '(') {
-                    depth += 1;
-                    i += 1;
-                    continue;
+                if (c == '`') {
+                    var run_len: usize = 1;
+                    while (i + run_len < text.len and text[i + run_len] == '`') run_len += 1;
+                    if (Self.findClosingBackticks(text, i + run_len, run_len)) |m_pos| {
+                        i = m_pos + run_len;
+                        continue;
+                    }
                 }
-                if (ch == ')') {
-                    if (depth == 0) break;
-                    depth -= 1;
-                    i += 1;
-                    continue;
+                if (c == '<') {
+                    if (parseAutolink(text, i) != null) return true;
+                } else if (c == '!') {
+                    if (parseInlineLink(p, text, i, true)) |m| {
+                        i = m.dest.end;
+                        continue;
+                    }
+                } else if (c == '[') {
+                    if (parseInlineLink(p, text, i, false) != null) return true;
                 }
-                if (isSpaceOrNl(ch)) break;
                 i += 1;
             }
-            dest_end = i;
+            return false;
         }
-        var j = i;
-        while (j < text.len and isSpaceOrNl(text[j])) : (j += 1) {}
-        if (j < text.len and text[j] == ')') {
-            return .{ .dest_start = dest_start, .dest_end = dest_end, .title_start = null, .title_end = null, .end = j + 1 };
-        }
-        if (j >= text.len) return null;
-        const open = text[j];
-        if (open != '"' and open != '\'' and open != '(') return null;
-        const close: u8 = if (open == '(') ')' else open;
-        j += 1;
-        const title_start = j;
-        var title_end: ?usize = null;
-        while (j < text.len) : (j += 1) {
-            const ch = text[j];
-            if (ch == '\\' and j + 1 < text.len and isAsciiPunct(text[j + 1])) {
-                j += 1;
-                continue;
-            }
-            if (ch == close) {
-                title_end = j;
+        fn decodeEntity(text: []const u8, out_buf: *[8]u8) struct { consumed: usize, len: usize } {
+            if (text.len < 2 or text[0] != '&') return .{ .consumed = 0, .len = 0 };
+            var j: usize = 1;
+            var decoded_len: usize = 0;
+            if (j < text.len and text[j] == '#') {
                 j += 1;
-                break;
+                const b: u8 = if (j < text.len and (text[j] | 32) == 'x') blk: {
+                    j += 1;
+                    break :blk 16;
+                } else 10;
+                const cp_s = j;
+                while (j < text.len and (if (b == 10) std.ascii.isDigit(text[j]) else std.ascii.isHex(text[j]))) : (j += 1) {}
+                if (j > cp_s and j < text.len and text[j] == ';') {
+                    var cp = std.fmt.parseInt(u32, text[cp_s..j], b) catch 0;
+                    if (cp == 0) cp = 0xFFFD;
+                    if (cp > 0x10FFFF or (cp >= 0xD800 and cp <= 0xDFFF)) {
+                        j = 1;
+                    } else {
+                        decoded_len = std.unicode.utf8Encode(@intCast(cp), out_buf[0..4]) catch 0;
+                        if (decoded_len > 0) j += 1 else j = 1; // Success implies consume ;
+                    }
+                } else j = 1;
+            } else {
+                while (j < text.len and std.ascii.isAlphanumeric(text[j])) : (j += 1) {}
+                if (j > 1 and j < text.len and text[j] == ';') {
+                    const en = text[1..j];
+                    const d: ?[]const u8 = switch (en.len) {
+                        2 => if (std.mem.eql(u8, en, "lt")) "<" else if (std.mem.eql(u8, en, "gt")) ">" else null,
+                        3 => if (std.mem.eql(u8, en, "amp")) "&" else if (std.mem.eql(u8, en, "ngE")) "≧̸" else null,
+                        4 => if (std.mem.eql(u8, en, "quot")) "\"" else if (std.mem.eql(u8, en, "apos")) "'" else if (std.mem.eql(u8, en, "copy")) "©" else if (std.mem.eql(u8, en, "nbsp")) "\u{00A0}" else if (std.mem.eql(u8, en, "ouml")) "\u{00F6}" else if (std.mem.eql(u8, en, "auml"))
+                            "\u{00E4}"
+                        else
+                            null,
+                        5 => if (std.mem.eql(u8, en, "ndash")) "–" else if (std.mem.eql(u8, en, "mdash")) "—" else if (std.mem.eql(u8, en, "AElig")) "\u{00C6}" else null,
+                        6 => if (std.mem.eql(u8, en, "Dcaron")) "\u{010E}" else if (std.mem.eql(u8, en, "frac34"))
+                            "\u{00BE}"
+                        else
+                            null,
+                        12 => if (std.mem.eql(u8, en, "HilbertSpace")) "\u{210B}" else null,
+                        13 => if (std.mem.eql(u8, en, "DifferentialD")) "\u{2146}" else null,
+                        24 => if (std.mem.eql(u8, en, "ClockwiseContourIntegral")) "\u{2232}" else null,
+                        else => null,
+                    };
+                    if (d) |v| {
+                        if (v.len <= out_buf.len) {
+                            @memcpy(out_buf[0..v.len], v);
+                            decoded_len = v.len;
+                            j += 1;
+                        } else j = 1;
+                    } else j = 1;
+                } else j = 1;
             }
+            if (decoded_len == 0) return .{ .consumed = 0, .len = 0 };
+            return .{ .consumed = j, .len = decoded_len };
         }
-        if (title_end == null) return null;
-        while (j < text.len and isSpaceOrNl(text[j])) : (j += 1) {}
-        if (j < text.len and text[j] == ')') {
-            return .{ .dest_start = dest_start, .dest_end = dest_end, .title_start = title_start, .title_end = title_end, .end = j + 1 };
-        }
-        return null;
-    }
-    const LinkMatch = struct { label_start: usize, label_end: usize, dest: LinkDest, is_image: bool };
-    fn parseInlineLink(p: *OctomarkParser, text: []const u8, start: usize, is_image: bool) ?LinkMatch {
-        const _s = p.startCall(.parseInlineLink);
-        defer p.endCall(.parseInlineLink, _s);
-        if (is_image) {
-            if (start + 1 >= text.len or text[start + 1] != '[') return null;
-        } else if (text[start] != '[') return null;
-        const label_start = if (is_image) start + 2 else start + 1;
-        const label_end = findLabelEnd(p, text, label_start) orelse return null;
-        if (label_end + 1 >= text.len or text[label_end + 1] != '(') return null;
-        const dest = parseLinkDestination(text, label_end + 2) orelse return null;
-        return .{ .label_start = label_start, .label_end = label_end, .dest = dest, .is_image = is_image };
-    }
-    const Autolink = struct { end: usize, is_email: bool, content_start: usize, content_end: usize };
-    fn parseAutolink(text: []const u8, start: usize) ?Autolink {
-        if (start + 1 >= text.len or text[start] != '<') return null;
-        if (std.mem.indexOfScalar(u8, text[start + 1 ..], '>')) |off| {
-            const lc = text[start + 1 .. start + 1 + off];
-            if (std.mem.indexOfAny(u8, lc, " \t\n") != null) return null;
-            var al = false;
-            var em_l = false;
-            if (std.mem.indexOfScalar(u8, lc, ':')) |sc_i| {
-                const sch = lc[0..sc_i];
-                if (sch.len >= 2 and sch.len <= 32 and std.ascii.isAlphabetic(sch[0])) {
-                    al = true;
-                    for (sch[1..]) |sc| if (!std.ascii.isAlphanumeric(sc) and sc != '+' and sc != '.' and sc != '-') {
-                        al = false;
-                        break;
-                    };
-                }
-            } else if (std.mem.indexOfScalar(u8, lc, '@')) |a| {
-                if (a > 0 and a < lc.len - 1 and std.mem.indexOfScalar(u8, lc[a + 1 ..], '.') != null) {
-                    al = true;
-                    em_l = true;
+        /// Render cache key for `input` under this dialect and `options`: `source_hash`,
+        /// every option that affects output, `salt` and the input bytes. Hooks and resolvers only
+        /// count as present or absent.
+        pub fn cacheKey(options: OctomarkOptions, input: []const u8, salt: u64) u64 {
+            var h = std.hash.Wyhash.init(salt);
+            h.update(std.mem.asBytes(&source_hash));
+            inline for (std.meta.fields(Dialect)) |f| h.update(&[_]u8{@intFromBool(@field(dialect, f.name))});
+            inline for (std.meta.fields(OctomarkOptions)) |f| {
+                if (comptime isOutputNeutral(f.name)) continue;
+                const value = @field(options, f.name);
+                switch (@typeInfo(f.type)) {
+                    .optional => h.update(&[_]u8{@intFromBool(value != null)}),
+                    else => h.update(std.mem.asBytes(&value)),
                 }
             }
-            if (al and std.mem.indexOfAny(u8, lc, if (em_l) " \t\n\\" else " \t\n") != null) al = false;
-            if (al) return .{ .end = start + off + 2, .is_email = em_l, .content_start = start + 1, .content_end = start + 1 + off };
+            h.update(input);
+            return h.final();
         }
-        return null;
-    }
-    fn labelHasLinkLike(p: *OctomarkParser, text: []const u8) bool {
-        const _s = p.startCall(.labelHasLinkLike);
-        defer p.endCall(.labelHasLinkLike, _s);
-        var i: usize = 0;
-        while (i < text.len) {
-            const c = text[i];
-            if (c == '\\' and i + 1 < text.len) {
-                i += 2;
-                continue;
+        /// Render a whole document through `cache`. A hit writes the stored output without
+        /// parsing; a miss renders with `options` and stores the result. Only the HTML is cached,
+        /// so statistics, tokens and checkpoints are not produced on a hit.
+        pub fn renderCached(cache: *RenderCache, allocator: std.mem.Allocator, input: []const u8, options: OctomarkOptions, writer: *std.Io.Writer) !void {
+            const key = cacheKey(options, input, cache.salt);
+            if (try cache.get(key)) |entry| {
+                defer cache.release(entry);
+                return writer.writeAll(entry.bytes());
             }
-            if (c == '`') {
-                var run_len: usize = 1;
-                while (i + run_len < text.len and text[i + run_len] == '`') run_len += 1;
-                if (OctomarkParser.findClosingBackticks(text, i + run_len, run_len)) |m_pos| {
-                    i = m_pos + run_len;
-                    continue;
+            var out: std.Io.Writer.Allocating = .init(allocator);
+            defer out.deinit();
+            var parser: Self = undefined;
+            try parser.init(allocator);
+            defer parser.deinit(allocator);
+            parser.setOptions(options);
+            try parser.feed(input, &out.writer, allocator);
+            try parser.finish(&out.writer);
+            try cache.put(key, out.written());
+            try writer.writeAll(out.written());
+        }
+        /// Render `text` as inline Markdown only: no block detection and no `<p>` wrapper. `text`
+        /// is normalized and checked against `options.utf8_policy` as `feed` would, so it returns
+        /// the same errors. Text that normalization would leave unchanged is parsed in place,
+        /// unless a token sink needs input offsets. Scratch space lives on the stack and spills to
+        /// `smp_allocator`, so short snippets never touch the heap.
+        pub fn renderInline(text: []const u8, options: OctomarkOptions, writer: anytype) !void {
+            var sfa = std.heap.stackFallback(4096, std.heap.smp_allocator);
+            const allocator = sfa.get();
+            var p: Self = .{
+                .allocator = allocator,
+                .options = options,
+                .paragraph_content = .{},
+                .pending_code_blank_lines = .{},
+                .replacements = .{},
+                .active_list_stack_idx = -1,
+            };
+            if (builtin.mode == .Debug) p.timer = try std.time.Timer.start();
+            defer p.deinit(allocator);
+            const clean = options.token_sink == null and
+                indexOfInputSpecial(text, 0, options.normalize_input, false) == text.len and
+                (options.utf8_policy == .pass_through or std.unicode.utf8ValidateSlice(text));
+            var input = text;
+            if (!clean) {
+                try p.pending_buffer.ensureTotalCapacityPrecise(allocator, text.len);
+                try p.appendInput(text);
+                if (p.utf8_carry_len > 0) try p.appendInvalidUtf8(p.utf8_carry[0..p.utf8_carry_len]);
+                input = p.pending_buffer.items;
+            }
+            try p.parseInlineContent(std.mem.trim(u8, input, " \t\r\n"), writer);
+            if (dialect.wiki_links and p.wiki_holding) try p.flushWikiOutput(writer);
+        }
+        pub fn parseInlineContent(p: *Self, text: []const u8, o: anytype) !void {
+            p.replacements.clearRetainingCapacity();
+            p.stats_in_word = false;
+            p.stats_word_counted = false;
+            try p.scanInline(text, 0);
+            std.sort.block(Replacement, p.replacements.items, {}, struct {
+                fn less(_: void, a: Replacement, b: Replacement) bool {
+                    return a.pos < b.pos;
                 }
+            }.less);
+            try p.parseInlineContentDepth(text, o, 0, 0, false);
+        }
+        fn parseInlineContentScoped(p: *Self, text: []const u8, o: anytype, depth: usize, plain: bool) anyerror!void {
+            const _s = p.startCall(.parseInlineContentScoped);
+            defer p.endCall(.parseInlineContentScoped, _s);
+            if (depth > MAX_INLINE_NESTING) {
+                try p.writeAll(o, text);
+                return;
             }
-            if (c == '<') {
-                if (parseAutolink(text, i) != null) return true;
-            } else if (c == '!') {
-                if (parseInlineLink(p, text, i, true)) |m| {
-                    i = m.dest.end;
-                    continue;
+            const saved_reps = p.replacements;
+            const saved_delim_len = p.delimiter_stack_len;
+
+            p.replacements = .{};
+            p.delimiter_stack_len = 0;
+            defer {
+                p.replacements.deinit(p.allocator);
+                p.replacements = saved_reps;
+                p.delimiter_stack_len = saved_delim_len;
+            }
+
+            try p.scanInline(text, 0);
+            std.sort.block(Replacement, p.replacements.items, {}, struct {
+                fn less(_: void, a: Replacement, b: Replacement) bool {
+                    return a.pos < b.pos;
                 }
-            } else if (c == '[') {
-                if (parseInlineLink(p, text, i, false) != null) return true;
+            }.less);
+            try p.renderInlineSpans(text, p.replacements.items, o, depth, 0, plain);
+        }
+        fn parseInlineContentDepth(p: *Self, text: []const u8, o: anytype, depth: usize, g_off: usize, plain: bool) anyerror!void {
+            const _s = p.startCall(.parseInlineContent);
+            defer p.endCall(.parseInlineContent, _s);
+            if (depth > MAX_INLINE_NESTING) {
+                try p.writeAll(o, text);
+                return;
             }
-            i += 1;
+            try p.renderInlineSpans(text, p.replacements.items, o, depth, g_off, plain);
         }
-        return false;
-    }
-    fn decodeEntity(text: []const u8, out_buf: *[8]u8) struct { consumed: usize, len: usize } {
-        if (text.len < 2 or text[0] != '&') return .{ .consumed = 0, .len = 0 };
-        var j: usize = 1;
-        var decoded_len: usize = 0;
-        if (j < text.len and text[j] == '#') {
-            j += 1;
-            const b: u8 = if (j < text.len and (text[j] | 32) == 'x') blk: {
-                j += 1;
-                break :blk 16;
-            } else 10;
-            const cp_s = j;
-            while (j < text.len and (if (b == 10) std.ascii.isDigit(text[j]) else std.ascii.isHex(text[j]))) : (j += 1) {}
-            if (j > cp_s and j < text.len and text[j] == ';') {
-                var cp = std.fmt.parseInt(u32, text[cp_s..j], b) catch 0;
-                if (cp == 0) cp = 0xFFFD;
-                if (cp > 0x10FFFF or (cp >= 0xD800 and cp <= 0xDFFF)) {
-                    j = 1;
-                } else {
-                    decoded_len = std.unicode.utf8Encode(@intCast(cp), out_buf[0..4]) catch 0;
-                    if (decoded_len > 0) j += 1 else j = 1; // Success implies consume ;
-                }
-            } else j = 1;
-        } else {
-            while (j < text.len and std.ascii.isAlphanumeric(text[j])) : (j += 1) {}
-            if (j > 1 and j < text.len and text[j] == ';') {
-                const en = text[1..j];
-                const d: ?[]const u8 = switch (en.len) {
-                    2 => if (std.mem.eql(u8, en, "lt")) "<" else if (std.mem.eql(u8, en, "gt")) ">" else null,
-                    3 => if (std.mem.eql(u8, en, "amp")) "&" else if (std.mem.eql(u8, en, "ngE")) "≧̸" else null,
-                    4 => if (std.mem.eql(u8, en, "quot")) "\"" else if (std.mem.eql(u8, en, "apos")) "'" else if (std.mem.eql(u8, en, "copy")) "©" else if (std.mem.eql(u8, en, "nbsp")) "\u{00A0}" else if (std.mem.eql(u8, en, "ouml")) "\u{00F6}" else if (std.mem.eql(u8, en, "auml"))
-                        "\u{00E4}"
-                    else
-                        null,
-                    5 => if (std.mem.eql(u8, en, "ndash")) "–" else if (std.mem.eql(u8, en, "mdash")) "—" else if (std.mem.eql(u8, en, "AElig")) "\u{00C6}" else null,
-                    6 => if (std.mem.eql(u8, en, "Dcaron")) "\u{010E}" else if (std.mem.eql(u8, en, "frac34"))
-                        "\u{00BE}"
-                    else
-                        null,
-                    12 => if (std.mem.eql(u8, en, "HilbertSpace")) "\u{210B}" else null,
-                    13 => if (std.mem.eql(u8, en, "DifferentialD")) "\u{2146}" else null,
-                    24 => if (std.mem.eql(u8, en, "ClockwiseContourIntegral")) "\u{2232}" else null,
-                    else => null,
-                };
-                if (d) |v| {
-                    if (v.len <= out_buf.len) {
-                        @memcpy(out_buf[0..v.len], v);
-                        decoded_len = v.len;
-                        j += 1;
-                    } else j = 1;
-                } else j = 1;
-            } else j = 1;
+        fn findClosingBackticks(text: []const u8, start: usize, count: usize) ?usize {
+            var i = start;
+            while (i < text.len) {
+                const off = std.mem.indexOfScalar(u8, text[i..], '`') orelse return null;
+                i += off;
+                var run_len: usize = 0;
+                while (i + run_len < text.len and text[i + run_len] == '`') : (run_len += 1) {}
+                if (run_len == count) return i;
+                i += run_len;
+            }
+            return null;
         }
-        if (decoded_len == 0) return .{ .consumed = 0, .len = 0 };
-        return .{ .consumed = j, .len = decoded_len };
-    }
-    fn needsPercentEncode(c: u8) bool {
-        if (std.ascii.isAlphanumeric(c)) return false;
-        return switch (c) {
-            '-', '.', '_', '~', '!', '$', '\'', '(', ')', '*', '+', ',', ';', '=', ':', '@', '/', '?', '#' => false,
-            else => true,
+        const Flanking = struct {
+            left: bool,
+            right: bool,
+            punct_before: bool,
+            punct_after: bool,
         };
-    }
-    pub fn parseInlineContent(p: *OctomarkParser, text: []const u8, o: anytype) !void {
-        p.replacements.clearRetainingCapacity();
-        try p.scanInline(text, 0);
-        std.sort.block(Replacement, p.replacements.items, {}, struct {
-            fn less(_: void, a: Replacement, b: Replacement) bool {
-                return a.pos < b.pos;
-            }
-        }.less);
-        try p.parseInlineContentDepth(text, o, 0, 0, false);
-    }
-    fn parseInlineContentScoped(p: *OctomarkParser, text: []const u8, o: anytype, depth: usize, plain: bool) anyerror!void {
-        const _s = p.startCall(.parseInlineContentScoped);
-        defer p.endCall(.parseInlineContentScoped, _s);
-        if (depth > MAX_INLINE_NESTING) {
-            try p.writeAll(o, text);
-            return;
-        }
-        const saved_reps = p.replacements;
-        const saved_delim_len = p.delimiter_stack_len;
-
-        p.replacements = .{};
-        p.delimiter_stack_len = 0;
-        defer {
-            p.replacements.deinit(p.allocator);
-            p.replacements = saved_reps;
-            p.delimiter_stack_len = saved_delim_len;
+        /// Left- and right-flanking classification of the delimiter run `text[start..end]`, shared
+        /// by emphasis and smart quotes.
+        fn flanking(p: *Self, text: []const u8, start: usize, end: usize) Flanking {
+            // Input validated by the feed stage decodes without checks.
+            const trusted = p.options.utf8_policy != .pass_through;
+            var b: u32 = '\n';
+            if (start > 0) {
+                var bi = start - 1;
+                while (bi > 0 and (text[bi] & 0xC0 == 0x80)) bi -= 1;
+                b = if (trusted)
+                    decodeUtf8Unchecked(text[bi..start])
+                else
+                    std.unicode.utf8Decode(text[bi..start]) catch text[start - 1];
+            }
+            var a: u32 = '\n';
+            if (end < text.len) {
+                const al = if (trusted) utf8LengthUnchecked(text[end]) else std.unicode.utf8ByteSequenceLength(text[end]) catch 1;
+                if (end + al <= text.len) a = if (trusted)
+                    decodeUtf8Unchecked(text[end .. end + al])
+                else
+                    std.unicode.utf8Decode(text[end .. end + al]) catch text[end];
+            }
+            const w_a = isWhitespace(a);
+            const w_b = isWhitespace(b);
+            const p_a = isPunct(a);
+            const p_b = isPunct(b);
+            return .{
+                .left = !w_a and (!p_a or w_b or p_b),
+                .right = !w_b and (!p_b or w_a or p_a),
+                .punct_before = p_b,
+                .punct_after = p_a,
+            };
         }
-
-        try p.scanInline(text, 0);
-        std.sort.block(Replacement, p.replacements.items, {}, struct {
-            fn less(_: void, a: Replacement, b: Replacement) bool {
-                return a.pos < b.pos;
+        fn scanDelims(p: *Self, text: []const u8, start_pos: usize, char: u8, bottom: usize) !usize {
+            const s = p.startCall(.scanDelimiters);
+            defer p.endCall(.scanDelimiters, s);
+            var num: usize = 0;
+            var i = start_pos;
+            while (i < text.len and text[i] == char) : (i += 1) num += 1;
+            if (num == 0) return start_pos;
+            const f = p.flanking(text, start_pos, i);
+            var open = f.left;
+            var close = f.right;
+            if (char == '_') {
+                open = f.left and (!f.right or f.punct_before);
+                close = f.right and (!f.left or f.punct_after);
             }
-        }.less);
-        try p.renderInline(text, p.replacements.items, o, depth, 0, plain);
-    }
-    fn parseInlineContentDepth(p: *OctomarkParser, text: []const u8, o: anytype, depth: usize, g_off: usize, plain: bool) anyerror!void {
-        const _s = p.startCall(.parseInlineContent);
-        defer p.endCall(.parseInlineContent, _s);
-        if (depth > MAX_INLINE_NESTING) {
-            try p.writeAll(o, text);
-            return;
-        }
-        try p.renderInline(text, p.replacements.items, o, depth, g_off, plain);
-    }
-    fn findClosingBackticks(text: []const u8, start: usize, count: usize) ?usize {
-        var i = start;
-        while (i < text.len) {
-            const off = std.mem.indexOfScalar(u8, text[i..], '`') orelse return null;
-            i += off;
-            var run_len: usize = 0;
-            while (i + run_len < text.len and text[i + run_len] == '`') : (run_len += 1) {}
-            if (run_len == count) return i;
-            i += run_len;
-        }
-        return null;
-    }
-    fn scanDelims(p: *OctomarkParser, text: []const u8, start_pos: usize, char: u8, bottom: usize) !usize {
-        const s = p.startCall(.scanDelimiters);
-        defer p.endCall(.scanDelimiters, s);
-        var num: usize = 0;
-        var i = start_pos;
-        while (i < text.len and text[i] == char) : (i += 1) num += 1;
-        if (num == 0) return start_pos;
-        var b: u32 = '\n';
-        if (start_pos > 0) {
-            var bi = start_pos - 1;
-            while (bi > 0 and (text[bi] & 0xC0 == 0x80)) bi -= 1;
-            b = std.unicode.utf8Decode(text[bi..start_pos]) catch text[start_pos - 1];
-        }
-        var a: u32 = '\n';
-        if (i < text.len) {
-            const al = std.unicode.utf8ByteSequenceLength(text[i]) catch 1;
-            if (i + al <= text.len) a = std.unicode.utf8Decode(text[i .. i + al]) catch text[i];
-        }
-        const w_a = isWhitespace(a);
-        const w_b = isWhitespace(b);
-        const p_a = isPunct(a);
-        const p_b = isPunct(b);
-        const was_open = !w_a and (!p_a or w_b or p_b);
-        const was_close = !w_b and (!p_b or w_a or p_a);
-        var open = was_open;
-        var close = was_close;
-        if (char == '_') {
-            open = was_open and (!was_close or p_b);
-            close = was_close and (!was_open or p_a);
-        }
-        var processed: usize = 0;
-        if (close) {
-            var idx = p.delimiter_stack_len;
-            while (idx > bottom) {
-                idx -= 1;
-                var opener = &p.delimiter_stack[idx];
-                if (opener.char == char and opener.active and opener.can_open) {
-                    while (num > 0 and opener.count > 0) {
-                        if (char != '~' and (opener.can_close or open) and (opener.count + num) % 3 == 0 and
-                            (opener.count % 3 != 0 or num % 3 != 0)) break;
-                        const use: usize = if (char == '~')
-                            (if (num >= 2 and opener.count >= 2) @as(usize, 2) else 0)
-                        else if (num >= 2 and opener.count >= 2) @as(usize, 2) else 1;
-                        if (use == 0) break;
-                        const t_o = if (char == '~') "<del>" else (if (use == 2) "<strong>" else "<em>");
-                        const t_c = if (char == '~') "</del>" else (if (use == 2) "</strong>" else "</em>");
-                        try p.replacements.append(p.allocator, .{ .pos = opener.pos + opener.count - use, .end = opener.pos + opener.count, .text = t_o });
-                        const closer_pos = start_pos + processed;
-                        processed += use;
-                        try p.replacements.append(p.allocator, .{ .pos = closer_pos, .end = closer_pos + use, .text = t_c });
-                        var di = idx + 1;
-                        while (di < p.delimiter_stack_len) : (di += 1) {
-                            p.delimiter_stack[di].active = false;
+            var processed: usize = 0;
+            if (close) {
+                var idx = p.delimiter_stack_len;
+                while (idx > bottom) {
+                    idx -= 1;
+                    var opener = &p.delimiter_stack[idx];
+                    if (opener.char == char and opener.active and opener.can_open) {
+                        while (num > 0 and opener.count > 0) {
+                            if (char != '~' and (opener.can_close or open) and (opener.count + num) % 3 == 0 and
+                                (opener.count % 3 != 0 or num % 3 != 0)) break;
+                            const use: usize = if (char == '~')
+                                (if (num >= 2 and opener.count >= 2) @as(usize, 2) else 0)
+                            else if (num >= 2 and opener.count >= 2) @as(usize, 2) else 1;
+                            if (use == 0) break;
+                            const t_o = if (char == '~') "<del>" else (if (use == 2) "<strong>" else "<em>");
+                            const t_c = if (char == '~') "</del>" else (if (use == 2) "</strong>" else "</em>");
+                            try p.replacements.append(p.allocator, .{ .pos = opener.pos + opener.count - use, .end = opener.pos + opener.count, .text = t_o });
+                            const closer_pos = start_pos + processed;
+                            processed += use;
+                            try p.replacements.append(p.allocator, .{ .pos = closer_pos, .end = closer_pos + use, .text = t_c });
+                            var di = idx + 1;
+                            while (di < p.delimiter_stack_len) : (di += 1) {
+                                p.delimiter_stack[di].active = false;
+                            }
+                            opener.count -= use;
+                            num -= use;
+                            if (num == 0) break;
+                        }
+                        if (opener.count == 0) {
+                            if (idx < p.delimiter_stack_len - 1) std.mem.copyForwards(Delimiter, p.delimiter_stack[idx .. p.delimiter_stack_len - 1], p.delimiter_stack[idx + 1 .. p.delimiter_stack_len]);
+                            p.delimiter_stack_len -= 1;
                         }
-                        opener.count -= use;
-                        num -= use;
                         if (num == 0) break;
                     }
-                    if (opener.count == 0) {
-                        if (idx < p.delimiter_stack_len - 1) std.mem.copyForwards(Delimiter, p.delimiter_stack[idx .. p.delimiter_stack_len - 1], p.delimiter_stack[idx + 1 .. p.delimiter_stack_len]);
-                        p.delimiter_stack_len -= 1;
-                    }
-                    if (num == 0) break;
                 }
             }
+            if (open and num > 0 and p.delimiter_stack_len < MAX_INLINE_NESTING) {
+                p.delimiter_stack[p.delimiter_stack_len] = .{ .pos = start_pos + processed, .content_end = i, .char = char, .count = num, .can_open = open, .can_close = close, .active = true };
+                p.delimiter_stack_len += 1;
+            }
+            return i;
         }
-        if (open and num > 0 and p.delimiter_stack_len < MAX_INLINE_NESTING) {
-            p.delimiter_stack[p.delimiter_stack_len] = .{ .pos = start_pos + processed, .content_end = i, .char = char, .count = num, .can_open = open, .can_close = close, .active = true };
-            p.delimiter_stack_len += 1;
-        }
-        return i;
-    }
-    fn scanInline(p: *OctomarkParser, text: []const u8, bottom: usize) !void {
-        const s = p.startCall(.scanInline);
-        defer p.endCall(.scanInline, s);
-        var i: usize = 0;
-        while (i < text.len) {
-            const off = std.mem.indexOfAny(u8, text[i..], "*_`~<\\[!") orelse break;
-            i += off;
-            switch (text[i]) {
-                '*', '_', '~' => i = try p.scanDelims(text, i, text[i], bottom),
-                '`' => {
-                    var cnt: usize = 1;
-                    while (i + cnt < text.len and text[i + cnt] == '`') cnt += 1;
-                    if (OctomarkParser.findClosingBackticks(text, i + cnt, cnt)) |m_pos| {
-                        i = m_pos + cnt;
-                    } else {
-                        i += cnt;
-                    }
-                },
-                '<' => {
-                    if (parseAutolink(text, i)) |a| {
-                        i = a.end;
-                    } else {
-                        const l = p.parseHtmlTag(text[i..]);
-                        i += if (l > 0) l else 1;
-                    }
-                },
-                '[', '!' => {
-                    if (parseInlineLink(p, text, i, text[i] == '!')) |m| {
-                        const label = text[m.label_start..m.label_end];
-                        if (!m.is_image and labelHasLinkLike(p, label)) {
-                            i += 1;
+        fn scanInline(p: *Self, text: []const u8, bottom: usize) !void {
+            const s = p.startCall(.scanInline);
+            defer p.endCall(.scanInline, s);
+            var i: usize = 0;
+            // Extended autolinks never extend back over a code span, link, tag or earlier autolink.
+            var floor: usize = 0;
+            while (i < text.len) {
+                i = indexOfInlineCandidate(text, i, dialect);
+                if (i == text.len) break;
+                switch (text[i]) {
+                    '*', '_', '~' => i = try p.scanDelims(text, i, text[i], bottom),
+                    '`' => {
+                        var cnt: usize = 1;
+                        while (i + cnt < text.len and text[i + cnt] == '`') cnt += 1;
+                        if (Self.findClosingBackticks(text, i + cnt, cnt)) |m_pos| {
+                            i = m_pos + cnt;
+                            floor = i;
                         } else {
-                            i = m.dest.end;
+                            i += cnt;
+                        }
+                    },
+                    '<' => {
+                        if (parseAutolink(text, i)) |a| {
+                            i = a.end;
+                        } else {
+                            const l = p.parseHtmlTag(text[i..]);
+                            i += if (l > 0) l else 1;
+                        }
+                        floor = i;
+                    },
+                    ':', '.', '@', '#' => {
+                        if (dialect.autolinks and text[i] != '#' and !p.in_link_label) {
+                            if (try p.scanExtendedAutolink(text, i, floor, bottom)) |end| {
+                                i = end;
+                                floor = end;
+                                continue;
+                            }
+                        }
+                        if (dialect.emoji and text[i] == ':') {
+                            if (try p.scanEmoji(text, i)) |end| {
+                                i = end;
+                                floor = end;
+                                continue;
+                            }
+                        }
+                        if (dialect.references and text[i] != ':' and !p.in_link_label) {
+                            if (try p.scanReference(text, i, floor, bottom)) |end| {
+                                i = end;
+                                floor = end;
+                                continue;
+                            }
                         }
-                    } else {
                         i += 1;
-                    }
-                },
-                '\\' => i += if (i + 1 < text.len and isAsciiPunct(text[i + 1])) 2 else 1,
-                else => i += 1,
+                    },
+                    '[', '!' => {
+                        if (dialect.wiki_links and text[i] == '[' and !p.in_link_label) {
+                            if (matchWikiLink(text, i)) |w| {
+                                i = w.end;
+                                floor = i;
+                                continue;
+                            }
+                        }
+                        if (parseInlineLink(p, text, i, text[i] == '!')) |m| {
+                            const label = text[m.label_start..m.label_end];
+                            if (!m.is_image and labelHasLinkLike(p, label)) {
+                                i += 1;
+                            } else {
+                                i = m.dest.end;
+                                floor = i;
+                            }
+                        } else {
+                            i += 1;
+                        }
+                    },
+                    '\\' => i += if (i + 1 < text.len and isAsciiPunct(text[i + 1])) 2 else 1,
+                    else => i += 1,
+                }
             }
         }
-    }
-    fn renderInline(p: *OctomarkParser, text: []const u8, reps: []const Replacement, o: anytype, depth: usize, g_off: usize, plain: bool) !void {
-        const s = p.startCall(.renderInline);
-        defer p.endCall(.renderInline, s);
-        var i: usize = 0;
-        var r_idx: usize = 0;
-        while (i < text.len) {
-            while (r_idx < reps.len and reps[r_idx].pos < g_off + i) r_idx += 1;
-            if (r_idx < reps.len and reps[r_idx].pos == g_off + i) {
-                const rep = reps[r_idx];
-                if (!plain) try p.writeAll(o, rep.text);
-                i += rep.end - rep.pos;
-                r_idx += 1;
-                continue;
-            }
-            const next_rep = if (r_idx < reps.len) reps[r_idx].pos else text.len;
-            var next = p.findSpec(text, i);
-            if (next > next_rep) next = next_rep;
-            if (next < text.len and text[next] == '\n' and next < next_rep) {
-                var t_end = next;
-                if (!plain) {
-                    while (t_end > i and text[t_end - 1] == ' ') t_end -= 1;
-                    if (t_end > i) try p.writeAll(o, text[i..t_end]);
-                    try p.writeAll(o, if (next - t_end >= 2) "<br>\n" else "\n");
-                } else if (t_end > i) try p.writeAll(o, text[i..t_end]);
-                i = next + 1;
-                continue;
-            }
-            if (next > i) {
-                var t_end = next;
-                if (next == text.len) while (t_end > i and text[t_end - 1] == ' ') {
-                    t_end -= 1;
-                };
-                if (t_end > i) try p.writeAll(o, text[i..t_end]);
-                i = next;
-                continue;
+        /// Record the extended autolink around the candidate byte at `i` as an `.autolink` span.
+        /// Delimiters inside the link are dropped; a link overlapping emphasis that has already
+        /// been matched is not recorded. Returns the end of the link.
+        fn scanExtendedAutolink(p: *Self, text: []const u8, i: usize, floor: usize, bottom: usize) !?usize {
+            const link = matchExtendedAutolink(text, i, floor) orelse return null;
+            if (p.overlapsReplacement(link.start)) return null;
+            while (p.delimiter_stack_len > bottom and p.delimiter_stack[p.delimiter_stack_len - 1].pos >= link.start) {
+                p.delimiter_stack_len -= 1;
             }
-            const res = try p.handleInlineSpecial(text, &i, o, depth, plain);
-            if (res.handled) {
-                if (res.emit_char) |ch| try p.writeEscapedByte(o, ch);
-                continue;
-            }
-            try p.writeEscapedByte(o, text[i]);
-            i += 1;
+            try p.replacements.append(p.allocator, .{ .pos = link.start, .end = link.end, .text = link.prefix, .kind = .autolink });
+            return link.end;
         }
-    }
-    fn parseIndentedCodeBlock(parser: *OctomarkParser, line_content: []const u8, leading_spaces: usize, output: anytype) !bool {
-        const _s = parser.startCall(.parseIndentedCodeBlock);
-        defer parser.endCall(.parseIndentedCodeBlock, _s);
-        const bt = parser.topT();
-        var list_indent: ?i32 = null;
-        var idx = parser.stack_depth;
-        while (idx > 0) {
-            idx -= 1;
-            const entry = parser.block_stack[idx];
-            if (entry.block_type == .unordered_list or entry.block_type == .ordered_list) {
-                list_indent = entry.content_indent;
-                break;
-            }
+        /// Whether a span recorded so far ends after `start`. `scanInline` records spans as it
+        /// reaches their ends, so the last one recorded ends furthest right.
+        fn overlapsReplacement(p: *Self, start: usize) bool {
+            const items = p.replacements.items;
+            return items.len > 0 and items[items.len - 1].end > start;
         }
-        const required_indent: usize = if (list_indent) |indent| @intCast(indent + 4) else 4;
-        if (leading_spaces >= required_indent and bt != .paragraph and bt != .table and bt != .code and bt != .math and
-            bt != .indented_code)
-        {
-            try parser.closeP(output);
-            try parser.pushBlock(.indented_code, 0);
-            parser.pending_code_blank_lines.clearRetainingCapacity();
-            try parser.writeAll(output, "<pre><code>");
-            const extra_spaces = leading_spaces - required_indent;
-            var pad: usize = 0;
-            while (pad < extra_spaces) : (pad += 1) {
-                try parser.writeByte(output, ' ');
+        /// Record the shortcode whose opening colon is at `i` as an `.emoji` span. Returns the end
+        /// of the shortcode.
+        fn scanEmoji(p: *Self, text: []const u8, i: usize) !?usize {
+            const m = matchEmoji(text, i) orelse return null;
+            try p.replacements.append(p.allocator, .{ .pos = i, .end = m.end, .text = m.glyph, .kind = .emoji });
+            return m.end;
+        }
+        /// Record the reference at the sigil `i` as a span of its kind, dropping the delimiters it
+        /// covers. As with extended autolinks, a reference overlapping emphasis that has already
+        /// been matched is not recorded. Returns the end of the reference.
+        fn scanReference(p: *Self, text: []const u8, i: usize, floor: usize, bottom: usize) !?usize {
+            const ref = matchReference(text, i, floor) orelse return null;
+            if (p.overlapsReplacement(ref.start)) return null;
+            while (p.delimiter_stack_len > bottom and p.delimiter_stack[p.delimiter_stack_len - 1].pos >= ref.start) {
+                p.delimiter_stack_len -= 1;
             }
-            try parser.esc(line_content, output);
-            try parser.writeByte(output, '\n');
-            return true;
+            const kind: @FieldType(Replacement, "kind") = switch (ref.kind) {
+                .mention => .mention,
+                .issue => .issue,
+                .hashtag => .hashtag,
+            };
+            try p.replacements.append(p.allocator, .{ .pos = ref.start, .end = ref.end, .text = "", .kind = kind });
+            return ref.end;
         }
-        return false;
-    }
-    fn processLeafBlockContinuation(parser: *OctomarkParser, line: []const u8, output: anytype) !bool {
-        const _s = parser.startCall(.processLeafBlockContinuation);
-        defer parser.endCall(.processLeafBlockContinuation, _s);
-        const top = parser.topT() orelse return false;
-        if (top == .html_block) {
-            const h_type = parser.block_stack[parser.stack_depth - 1].extra_type;
-            const stripped = parser.stripBlockquotePrefixes(line);
-            if (!stripped.ok) return false;
-            var text_slice = stripped.slice;
-            var list_indent: ?usize = null;
-            if (parser.stack_depth > 0) {
-                var li = parser.stack_depth;
-                while (li > 0) {
-                    li -= 1;
-                    const bt = parser.block_stack[li].block_type;
-                    if (bt == .unordered_list or bt == .ordered_list) {
-                        list_indent = @intCast(parser.block_stack[li].content_indent);
-                        break;
-                    }
-                }
+        /// Href for a reference, asking the resolver only on its first use in the document, when
+        /// it is also added to `references()`.
+        fn resolveReference(p: *Self, kind: Reference.Kind, text: []const u8) !?[]const u8 {
+            const gop = try p.reference_hrefs.getOrPut(p.allocator, text);
+            if (gop.found_existing) return gop.value_ptr.*;
+            gop.key_ptr.* = p.allocator.dupe(u8, text) catch |e| {
+                p.reference_hrefs.removeByPtr(gop.key_ptr);
+                return e;
+            };
+            gop.value_ptr.* = null;
+            const ref = Reference{ .kind = kind, .text = gop.key_ptr.* };
+            try p.reference_list.append(p.allocator, ref);
+            const resolver = p.options.reference_resolver orelse return null;
+            const href = try resolver.resolve(resolver.context, ref) orelse return null;
+            gop.value_ptr.* = try p.allocator.dupe(u8, href);
+            return gop.value_ptr.*;
+        }
+        fn writeReference(p: *Self, comptime kind: Reference.Kind, text: []const u8, o: anytype, plain: bool) !void {
+            const href = try p.resolveReference(kind, text) orelse return p.esc(text, o);
+            if (plain) return p.esc(text, o);
+            p.doc_stats.links += @intFromBool(p.options.document_stats);
+            try p.writeAll(o, "<a href=\"");
+            try p.writeLinkUrl(href, o);
+            try p.writeAll(o, "\" class=\"" ++ @tagName(kind) ++ "\">");
+            try p.esc(text, o);
+            try p.writeAll(o, "</a>");
+        }
+        /// Add visible text to the document statistics.
+        inline fn countVisible(p: *Self, bytes: []const u8) void {
+            if (p.options.document_stats) p.countText(bytes);
+        }
+        /// Add visible text taken from the input to the statistics and the token sink; `field`
+        /// defaults to the field of the text being rendered.
+        inline fn visibleText(p: *Self, bytes: []const u8, comptime field: ?TokenField) !void {
+            if (p.options.document_stats) p.countText(bytes);
+            if (p.options.token_sink) |sink| try p.emitTokens(sink, bytes, field orelse p.textField());
+        }
+        fn textField(p: *const Self) TokenField {
+            return if (p.in_link_label) .link else p.token_field;
+        }
+        /// Pass each run of letters, digits and non-ASCII bytes in `bytes` to `sink`. Text that
+        /// is not a slice of the input (decoded entities, emoji) has no offset and is skipped.
+        fn emitTokens(p: *Self, sink: TokenSink, bytes: []const u8, field: TokenField) !void {
+            const base = p.sourceOffset(bytes) orelse return;
+            var i: usize = 0;
+            while (i < bytes.len) {
+                while (i < bytes.len and !isTokenByte(bytes[i])) i += 1;
+                const start = i;
+                while (i < bytes.len and isTokenByte(bytes[i])) i += 1;
+                if (i == start) break;
+                try sink.token(sink.context, .{ .text = bytes[start..i], .offset = p.rawOffset(base + start), .field = field });
             }
-            if (list_indent) |li| {
-                const ind = leadingIndent(text_slice);
-                if (ind.columns < li) {
-                    try parser.renderTop(output);
-                    return false;
-                }
-                text_slice = stripIndentColumns(text_slice, li);
+        }
+        /// Normalized input offset of `bytes` when it is a slice of `pending_buffer` or of paragraph
+        /// content copied from it. Offsets are absolute: `stream_base` counts the bytes compacted
+        /// away. `rawOffset` maps them back to the input as fed.
+        fn sourceOffset(p: *const Self, bytes: []const u8) ?usize {
+            const at = @intFromPtr(bytes.ptr);
+            const pending = p.pending_buffer.items;
+            if (at >= @intFromPtr(pending.ptr) and at + bytes.len <= @intFromPtr(pending.ptr) + pending.len) {
+                return p.stream_base + (at - @intFromPtr(pending.ptr));
             }
-            if (h_type >= 6) {
-                if (std.mem.trim(u8, text_slice, " \t").len == 0) {
-                    try parser.renderTop(output);
-                    return false;
+            // Setext headings render content that has already been cleared.
+            const content = p.paragraph_content.allocatedSlice();
+            if (at < @intFromPtr(content.ptr) or at + bytes.len > @intFromPtr(content.ptr) + content.len) return null;
+            const pos = at - @intFromPtr(content.ptr);
+            const spans = p.paragraph_sources.items;
+            var k = spans.len;
+            while (k > 0) {
+                k -= 1;
+                if (spans[k].at <= pos) {
+                    const source = spans[k].source orelse return null;
+                    return source + (pos - spans[k].at);
                 }
             }
-            var pad: usize = 0;
-            while (pad < stripped.extra_indent_columns) : (pad += 1) {
-                try parser.writeByte(output, ' ');
-            }
-            try parser.writeAll(output, text_slice);
-            try parser.writeByte(output, '\n');
-            if (h_type <= 5) {
-                var term = false;
-                if (h_type == 1) {
-                    const tags = [_][]const u8{ "</script>", "</pre>", "</style>", "</textarea>" };
-                    var i: usize = 0;
-                    while (i < text_slice.len) : (i += 1) {
-                        if (text_slice[i] == '<' and i + 1 < text_slice.len and text_slice[i + 1] == '/') {
-                            for (tags) |tag| {
-                                if (i + tag.len <= text_slice.len) {
-                                    if (std.ascii.eqlIgnoreCase(text_slice[i .. i + tag.len], tag)) {
-                                        term = true;
-                                        break;
-                                    }
-                                }
-                            }
-                        }
-                        if (term) break;
+            return null;
+        }
+        /// Record where a slice about to be appended to `paragraph_content` came from. Offsets
+        /// only grow within a paragraph, so a smaller one means the content was restarted.
+        fn noteParagraphSource(p: *Self, slice: []const u8) !void {
+            if (p.options.token_sink == null) return;
+            const at = p.paragraph_content.items.len;
+            const spans = &p.paragraph_sources;
+            if (spans.items.len > 0 and spans.items[spans.items.len - 1].at >= at) spans.clearRetainingCapacity();
+            try spans.append(p.allocator, .{ .at = at, .source = p.sourceOffset(slice) });
+        }
+        /// Count the words in `bytes` and its code points. A word is a run of non-space code points
+        /// holding at least one letter or digit, so punctuation standing alone is not a word.
+        /// Blocks of 16 ASCII bytes are classified with vector masks. Other blocks are decoded:
+        /// Unicode spaces separate words, and each ideograph or kana is a word of its own.
+        fn countText(p: *Self, bytes: []const u8) void {
+            const V = @Vector(16, u8);
+            var in_word = p.stats_in_word;
+            var counted = p.stats_word_counted;
+            var words: usize = 0;
+            var chars: usize = 0;
+            var i: usize = 0;
+            while (i < bytes.len) {
+                if (i + 16 <= bytes.len) {
+                    const v: V = bytes[i..][0..16].*;
+                    if (@reduce(.Max, v) < 0x80) {
+                        const space: u16 = @bitCast(v <= @as(V, @splat(' ')));
+                        const lower = v | @as(V, @splat(0x20));
+                        const alpha = @as(u16, @bitCast(lower >= @as(V, @splat('a')))) & @as(u16, @bitCast(lower <= @as(V, @splat('z'))));
+                        const digit = @as(u16, @bitCast(v >= @as(V, @splat('0')))) & @as(u16, @bitCast(v <= @as(V, @splat('9'))));
+                        // Bit 0 stands for the run still open from earlier text. Adding the letter
+                        // and digit bits to the run bits carries out of every run holding one, and
+                        // each carry lands on the space after its run; the open run, if already
+                        // counted, carries too and is taken off again.
+                        const run = @as(u32, ~space) << 1 | @intFromBool(in_word);
+                        const alnum = @as(u32, alpha | digit) << 1 | @intFromBool(counted);
+                        const carries = (run + alnum) & ~run;
+                        words += @popCount(carries) - @intFromBool(counted);
+                        in_word = space & 0x8000 == 0;
+                        counted = carries & (1 << 17) != 0;
+                        chars += 16;
+                        i += 16;
+                        continue;
+                    }
+                }
+                const len = std.unicode.utf8ByteSequenceLength(bytes[i]) catch 1;
+                const n: usize = if (i + len <= bytes.len) len else 1;
+                const c: u32 = std.unicode.utf8Decode(bytes[i .. i + n]) catch 0xFFFD;
+                i += n;
+                chars += 1;
+                if (isWhitespace(c)) {
+                    in_word = false;
+                    counted = false;
+                } else if (isIdeograph(c)) {
+                    words += 1;
+                    in_word = false;
+                    counted = false;
+                } else {
+                    in_word = true;
+                    const alnum = if (c < 0x80) std.ascii.isAlphanumeric(@intCast(c)) else !isPunct(c);
+                    if (alnum and !counted) {
+                        words += 1;
+                        counted = true;
                     }
-                } else if (h_type == 2) {
-                    if (std.mem.indexOf(u8, text_slice, "-->") != null) term = true;
-                } else if (h_type == 3) {
-                    if (std.mem.indexOf(u8, text_slice, "?>") != null) term = true;
-                } else if (h_type == 4) {
-                    if (std.mem.indexOf(u8, text_slice, ">") != null) term = true;
-                } else if (h_type == 5) {
-                    if (std.mem.indexOf(u8, text_slice, "]]>") != null) term = true;
                 }
-                if (term) try parser.renderTop(output);
             }
-            return true;
+            p.stats_in_word = in_word;
+            p.stats_word_counted = counted;
+            p.doc_stats.words += words;
+            p.doc_stats.characters += chars;
         }
-        if (top != .code and top != .math and top != .indented_code) return false;
-        const stripped = parser.stripBlockquotePrefixes(line);
-        if (!stripped.ok) return false;
-        var text_slice = stripped.slice;
-        const extra_indent_columns: usize = stripped.extra_indent_columns;
-        var prefix_spaces: usize = 0;
-        const trimmed = std.mem.trimLeft(u8, text_slice, &std.ascii.whitespace);
-        if (top == .code) {
-            var fence_slice = text_slice;
-            var list_indent: ?usize = null;
-            if (parser.stack_depth > 0) {
-                var li = parser.stack_depth;
-                while (li > 0) {
-                    li -= 1;
-                    const bt = parser.block_stack[li].block_type;
-                    if (bt == .unordered_list or bt == .ordered_list) {
-                        list_indent = @intCast(parser.block_stack[li].content_indent);
-                        break;
+        fn renderInlineSpans(p: *Self, text: []const u8, reps: []const Replacement, o: anytype, depth: usize, g_off: usize, plain: bool) !void {
+            const s = p.startCall(.renderInline);
+            defer p.endCall(.renderInline, s);
+            var i: usize = 0;
+            var r_idx: usize = 0;
+            while (i < text.len) {
+                while (r_idx < reps.len and reps[r_idx].pos < g_off + i) r_idx += 1;
+                if (r_idx < reps.len and reps[r_idx].pos == g_off + i) {
+                    const rep = reps[r_idx];
+                    const span = text[i .. i + (rep.end - rep.pos)];
+                    if (!plain) switch (rep.kind) {
+                        .literal => {},
+                        .emoji => p.countVisible(rep.text),
+                        .autolink => try p.visibleText(span, .link),
+                        else => try p.visibleText(span, null),
+                    };
+                    switch (rep.kind) {
+                        .literal => if (!plain) try p.writeAll(o, rep.text),
+                        .autolink => try p.writeAutolink(span, rep.text, o, plain),
+                        .emoji => try p.writeAll(o, rep.text),
+                        .mention => try p.writeReference(.mention, span, o, plain),
+                        .issue => try p.writeReference(.issue, span, o, plain),
+                        .hashtag => try p.writeReference(.hashtag, span, o, plain),
                     }
+                    i += span.len;
+                    r_idx += 1;
+                    continue;
                 }
-            }
-            if (list_indent) |li| {
-                const ind = leadingIndent(fence_slice);
-                if (ind.columns >= li) {
-                    fence_slice = stripIndentColumns(fence_slice, li);
+                const next_rep = if (r_idx < reps.len) reps[r_idx].pos else text.len;
+                var next = p.findSpec(text, i);
+                if (next > next_rep) next = next_rep;
+                if (next < text.len and text[next] == '\n' and next < next_rep) {
+                    var t_end = next;
+                    if (!plain) {
+                        while (t_end > i and text[t_end - 1] == ' ') t_end -= 1;
+                        if (t_end > i) try p.writeAll(o, text[i..t_end]);
+                        try p.writeAll(o, if (next - t_end >= 2) "<br>\n" else "\n");
+                        try p.visibleText(text[i .. next + 1], null);
+                    } else if (t_end > i) try p.writeAll(o, text[i..t_end]);
+                    i = next + 1;
+                    continue;
                 }
-            }
-            const indent = leadingIndent(fence_slice);
-            const trimmed_fence = fence_slice[indent.idx..];
-            const entry = parser.block_stack[parser.stack_depth - 1];
-            if (indent.columns <= 3 and trimmed_fence.len >= entry.fence_count) {
-                var k: usize = 0;
-                while (k < trimmed_fence.len and trimmed_fence[k] == entry.fence_char) : (k += 1) {}
-                if (k >= entry.fence_count) {
-                    var j = k;
-                    while (j < trimmed_fence.len and (trimmed_fence[j] == ' ' or trimmed_fence[j] == '\t')) : (j += 1) {}
-                    if (j == trimmed_fence.len) {
-                        try parser.renderTop(output);
-                        return true;
+                if (next > i) {
+                    var t_end = next;
+                    if (next == text.len) while (t_end > i and text[t_end - 1] == ' ') {
+                        t_end -= 1;
+                    };
+                    if (t_end > i) try p.writeAll(o, text[i..t_end]);
+                    if (!plain) try p.visibleText(text[i..t_end], null);
+                    i = next;
+                    continue;
+                }
+                const res = try p.handleInlineSpecial(text, &i, o, depth, plain);
+                if (res.handled) {
+                    if (res.emit_char) |ch| {
+                        try p.writeEscapedByte(o, ch);
+                        if (!plain) p.countVisible(&.{ch});
                     }
+                    continue;
                 }
+                try p.writeEscapedByte(o, text[i]);
+                if (!plain) p.countVisible(text[i .. i + 1]);
+                i += 1;
             }
-            text_slice = fence_slice;
-        } else if (top == .math) {
-            if (trimmed.len >= 2 and std.mem.eql(u8, trimmed[0..2], "$$")) {
-                try parser.renderTop(output);
-                return true;
-            }
-        } else if (top == .indented_code) {
-            const indent = leadingIndent(text_slice);
-            const spaces = indent.columns + extra_indent_columns;
-            const is_blank = (indent.idx == text_slice.len);
+        }
+        fn parseIndentedCodeBlock(parser: *Self, line_content: []const u8, leading_spaces: usize, output: anytype) !bool {
+            const _s = parser.startCall(.parseIndentedCodeBlock);
+            defer parser.endCall(.parseIndentedCodeBlock, _s);
+            const bt = parser.topT();
             var list_indent: ?i32 = null;
             var idx = parser.stack_depth;
             while (idx > 0) {
@@ -1664,1199 +3446,1897 @@ pub const OctomarkParser = struct {
                     break;
                 }
             }
-            const required_indent: usize = if (list_indent) |li| @intCast(li + 4) else 4;
-            if (is_blank) {
-                const extra = if (spaces > required_indent) spaces - required_indent else 0;
-                try parser.pending_code_blank_lines.append(parser.allocator, extra);
+            const required_indent: usize = if (list_indent) |indent| @intCast(indent + 4) else 4;
+            if (leading_spaces >= required_indent and bt != .paragraph and bt != .table and bt != .code and bt != .math and
+                bt != .indented_code)
+            {
+                try parser.closeP(output);
+                try parser.pushBlock(.indented_code, 0);
+                parser.pending_code_blank_lines.clearRetainingCapacity();
+                try parser.writeAll(output, "<pre><code>");
+                const extra_spaces = leading_spaces - required_indent;
+                var pad: usize = 0;
+                while (pad < extra_spaces) : (pad += 1) {
+                    try parser.writeByte(output, ' ');
+                }
+                try parser.esc(line_content, output);
+                try parser.writeByte(output, '\n');
+                parser.doc_stats.code_lines += @intFromBool(parser.options.document_stats);
+                if (parser.options.token_sink) |sink| try parser.emitTokens(sink, line_content, .code);
                 return true;
             }
-            if (spaces < required_indent) {
-                parser.pending_code_blank_lines.clearRetainingCapacity();
-                try parser.renderTop(output);
-                return false;
+            return false;
+        }
+        fn processLeafBlockContinuation(parser: *Self, line: []const u8, output: anytype) !bool {
+            const _s = parser.startCall(.processLeafBlockContinuation);
+            defer parser.endCall(.processLeafBlockContinuation, _s);
+            const top = parser.topT() orelse return false;
+            if (top == .html_block) {
+                const h_type = parser.block_stack[parser.stack_depth - 1].extra_type;
+                const stripped = parser.stripBlockquotePrefixes(line);
+                if (!stripped.ok) return false;
+                var text_slice = stripped.slice;
+                var list_indent: ?usize = null;
+                if (parser.stack_depth > 0) {
+                    var li = parser.stack_depth;
+                    while (li > 0) {
+                        li -= 1;
+                        const bt = parser.block_stack[li].block_type;
+                        if (bt == .unordered_list or bt == .ordered_list) {
+                            list_indent = @intCast(parser.block_stack[li].content_indent);
+                            break;
+                        }
+                    }
+                }
+                if (list_indent) |li| {
+                    const ind = leadingIndent(text_slice);
+                    if (ind.columns < li) {
+                        try parser.renderTop(output);
+                        return false;
+                    }
+                    text_slice = stripIndentColumns(text_slice, li);
+                }
+                if (h_type >= 6) {
+                    if (std.mem.trim(u8, text_slice, " \t").len == 0) {
+                        try parser.renderTop(output);
+                        return false;
+                    }
+                }
+                var pad: usize = 0;
+                while (pad < stripped.extra_indent_columns) : (pad += 1) {
+                    try parser.writeByte(output, ' ');
+                }
+                try parser.writeRawHtml(text_slice, output);
+                try parser.writeByte(output, '\n');
+                if (h_type <= 5) {
+                    var term = false;
+                    if (h_type == 1) {
+                        const tags = [_][]const u8{ "</script>", "</pre>", "</style>", "</textarea>" };
+                        var i: usize = 0;
+                        while (i < text_slice.len) : (i += 1) {
+                            if (text_slice[i] == '<' and i + 1 < text_slice.len and text_slice[i + 1] == '/') {
+                                for (tags) |tag| {
+                                    if (i + tag.len <= text_slice.len) {
+                                        if (std.ascii.eqlIgnoreCase(text_slice[i .. i + tag.len], tag)) {
+                                            term = true;
+                                            break;
+                                        }
+                                    }
+                                }
+                            }
+                            if (term) break;
+                        }
+                    } else if (h_type == 2) {
+                        if (std.mem.indexOf(u8, text_slice, "-->") != null) term = true;
+                    } else if (h_type == 3) {
+                        if (std.mem.indexOf(u8, text_slice, "?>") != null) term = true;
+                    } else if (h_type == 4) {
+                        if (std.mem.indexOf(u8, text_slice, ">") != null) term = true;
+                    } else if (h_type == 5) {
+                        if (std.mem.indexOf(u8, text_slice, "]]>") != null) term = true;
+                    }
+                    if (term) try parser.renderTop(output);
+                }
+                return true;
             }
-            if (parser.pending_code_blank_lines.items.len > 0) {
-                for (parser.pending_code_blank_lines.items) |extra| {
-                    var pad: usize = 0;
-                    while (pad < extra) : (pad += 1) {
-                        try parser.writeByte(output, ' ');
+            if (top != .code and top != .math and top != .indented_code) return false;
+            const stripped = parser.stripBlockquotePrefixes(line);
+            if (!stripped.ok) return false;
+            var text_slice = stripped.slice;
+            const extra_indent_columns: usize = stripped.extra_indent_columns;
+            var prefix_spaces: usize = 0;
+            const trimmed = std.mem.trimLeft(u8, text_slice, &std.ascii.whitespace);
+            if (top == .code) {
+                var fence_slice = text_slice;
+                var list_indent: ?usize = null;
+                if (parser.stack_depth > 0) {
+                    var li = parser.stack_depth;
+                    while (li > 0) {
+                        li -= 1;
+                        const bt = parser.block_stack[li].block_type;
+                        if (bt == .unordered_list or bt == .ordered_list) {
+                            list_indent = @intCast(parser.block_stack[li].content_indent);
+                            break;
+                        }
                     }
-                    try parser.writeByte(output, '\n');
                 }
-                parser.pending_code_blank_lines.clearRetainingCapacity();
+                if (list_indent) |li| {
+                    const ind = leadingIndent(fence_slice);
+                    if (ind.columns >= li) {
+                        fence_slice = stripIndentColumns(fence_slice, li);
+                    }
+                }
+                const indent = leadingIndent(fence_slice);
+                const trimmed_fence = fence_slice[indent.idx..];
+                const entry = parser.block_stack[parser.stack_depth - 1];
+                if (indent.columns <= 3 and trimmed_fence.len >= entry.fence_count) {
+                    var k: usize = 0;
+                    while (k < trimmed_fence.len and trimmed_fence[k] == entry.fence_char) : (k += 1) {}
+                    if (k >= entry.fence_count) {
+                        var j = k;
+                        while (j < trimmed_fence.len and (trimmed_fence[j] == ' ' or trimmed_fence[j] == '\t')) : (j += 1) {}
+                        if (j == trimmed_fence.len) {
+                            try parser.renderTop(output);
+                            return true;
+                        }
+                    }
+                }
+                text_slice = fence_slice;
+            } else if (top == .math) {
+                if (trimmed.len >= 2 and std.mem.eql(u8, trimmed[0..2], "$$")) {
+                    try parser.renderTop(output);
+                    return true;
+                }
+            } else if (top == .indented_code) {
+                const indent = leadingIndent(text_slice);
+                const spaces = indent.columns + extra_indent_columns;
+                const is_blank = (indent.idx == text_slice.len);
+                var list_indent: ?i32 = null;
+                var idx = parser.stack_depth;
+                while (idx > 0) {
+                    idx -= 1;
+                    const entry = parser.block_stack[idx];
+                    if (entry.block_type == .unordered_list or entry.block_type == .ordered_list) {
+                        list_indent = entry.content_indent;
+                        break;
+                    }
+                }
+                const required_indent: usize = if (list_indent) |li| @intCast(li + 4) else 4;
+                if (is_blank) {
+                    const extra = if (spaces > required_indent) spaces - required_indent else 0;
+                    try parser.pending_code_blank_lines.append(parser.allocator, extra);
+                    return true;
+                }
+                if (spaces < required_indent) {
+                    parser.pending_code_blank_lines.clearRetainingCapacity();
+                    try parser.renderTop(output);
+                    return false;
+                }
+                if (parser.pending_code_blank_lines.items.len > 0) {
+                    if (parser.options.document_stats) parser.doc_stats.code_lines += parser.pending_code_blank_lines.items.len;
+                    for (parser.pending_code_blank_lines.items) |extra| {
+                        var pad: usize = 0;
+                        while (pad < extra) : (pad += 1) {
+                            try parser.writeByte(output, ' ');
+                        }
+                        try parser.writeByte(output, '\n');
+                    }
+                    parser.pending_code_blank_lines.clearRetainingCapacity();
+                }
+                prefix_spaces = spaces - required_indent;
+                text_slice = text_slice[indent.idx..];
             }
-            prefix_spaces = spaces - required_indent;
-            text_slice = text_slice[indent.idx..];
-        }
-        if (parser.stack_depth > 0) {
-            const indent = parser.block_stack[parser.stack_depth - 1].indent_level;
-            if (indent > 0 and text_slice.len > 0) {
-                const indent_usize: usize = @intCast(indent);
-                text_slice = stripIndentColumns(text_slice, indent_usize);
+            if (parser.stack_depth > 0) {
+                const indent = parser.block_stack[parser.stack_depth - 1].indent_level;
+                if (indent > 0 and text_slice.len > 0) {
+                    const indent_usize: usize = @intCast(indent);
+                    text_slice = stripIndentColumns(text_slice, indent_usize);
+                }
             }
+            if (top != .math) {
+                parser.doc_stats.code_lines += @intFromBool(parser.options.document_stats);
+                if (parser.options.token_sink) |sink| try parser.emitTokens(sink, text_slice, .code);
+            }
+            if (top == .math and parser.options.math_hook != null) {
+                try parser.math_body.appendSlice(parser.allocator, text_slice);
+                try parser.math_body.append(parser.allocator, '\n');
+                return true;
+            }
+            if (top == .code and parser.code_hooked) {
+                try parser.code_body.appendSlice(parser.allocator, text_slice);
+                try parser.code_body.append(parser.allocator, '\n');
+                return true;
+            }
+            var pad: usize = 0;
+            while (pad < prefix_spaces) : (pad += 1) {
+                try parser.writeByte(output, ' ');
+            }
+            try parser.esc(text_slice, output);
+            try parser.writeByte(output, '\n');
+            return true;
         }
-        var pad: usize = 0;
-        while (pad < prefix_spaces) : (pad += 1) {
-            try parser.writeByte(output, ' ');
-        }
-        try parser.esc(text_slice, output);
-        try parser.writeByte(output, '\n');
-        return true;
-    }
-    fn parseFencedCodeBlock(parser: *OctomarkParser, line_content: []const u8, leading_spaces: usize, output: anytype) !bool {
-        const _s = parser.startCall(.parseFencedCodeBlock);
-        defer parser.endCall(.parseFencedCodeBlock, _s);
-        if (leading_spaces > 3) return false;
-        const content = std.mem.trimLeft(u8, line_content, " \t");
-        const extra_spaces = line_content.len - content.len;
-        if (content.len >= 3 and (content[0] == '`' or content[0] == '~')) {
-            const f_char = content[0];
-            var f_count: usize = 0;
-            while (f_count < content.len and content[f_count] == f_char) : (f_count += 1) {}
-            if (f_count < 3) return false;
-            if (f_char == '`' and std.mem.indexOfScalar(u8, content[f_count..], '`') != null) return false;
-            const block_type = parser.topT();
-            if (block_type == .paragraph) {
-                try parser.renderTop(output);
-            } else if (parser.paragraph_content.items.len > 0) {
-                try parser.parseInlineContent(parser.paragraph_content.items, output);
-                parser.paragraph_content.clearRetainingCapacity();
-            }
-            if (block_type == .table or block_type == .code or block_type == .math) {
-                try parser.renderTop(output);
-            }
-            try parser.writeAll(output, "<pre><code");
-            var info_start = f_count;
-            while (info_start < content.len and (content[info_start] == ' ' or content[info_start] == '\t')) : (info_start += 1) {}
-            var info_end = info_start;
-            while (info_end < content.len and !isWhitespace(content[info_end])) {
-                if (content[info_end] == '\\' and info_end + 1 < content.len and isAsciiPunct(content[info_end + 1])) {
-                    info_end += 2;
-                } else {
-                    info_end += 1;
+        fn parseFencedCodeBlock(parser: *Self, line_content: []const u8, leading_spaces: usize, output: anytype) !bool {
+            const _s = parser.startCall(.parseFencedCodeBlock);
+            defer parser.endCall(.parseFencedCodeBlock, _s);
+            if (leading_spaces > 3) return false;
+            const content = std.mem.trimLeft(u8, line_content, " \t");
+            const extra_spaces = line_content.len - content.len;
+            if (content.len >= 3 and (content[0] == '`' or content[0] == '~')) {
+                const f_char = content[0];
+                var f_count: usize = 0;
+                while (f_count < content.len and content[f_count] == f_char) : (f_count += 1) {}
+                if (f_count < 3) return false;
+                if (f_char == '`' and std.mem.indexOfScalar(u8, content[f_count..], '`') != null) return false;
+                const block_type = parser.topT();
+                if (block_type == .paragraph) {
+                    try parser.renderTop(output);
+                } else if (parser.paragraph_content.items.len > 0) {
+                    try parser.parseInlineContent(parser.paragraph_content.items, output);
+                    parser.paragraph_content.clearRetainingCapacity();
                 }
-            }
-            if (info_end > info_start) {
-                try parser.writeAll(output, " class=\"language-");
+                if (block_type == .table or block_type == .code or block_type == .math) {
+                    try parser.renderTop(output);
+                }
+                try parser.writeAll(output, "<pre><code");
+                var info_start = f_count;
+                while (info_start < content.len and (content[info_start] == ' ' or content[info_start] == '\t')) : (info_start += 1) {}
+                var info_end = info_start;
+                while (info_end < content.len and !isWhitespace(content[info_end])) {
+                    if (content[info_end] == '\\' and info_end + 1 < content.len and isAsciiPunct(content[info_end + 1])) {
+                        info_end += 2;
+                    } else {
+                        info_end += 1;
+                    }
+                }
+                const language = &parser.code_language;
+                language.clearRetainingCapacity();
                 var k = info_start;
                 while (k < info_end) {
                     if (content[k] == '&') {
                         var db: [8]u8 = undefined;
                         const dr = decodeEntity(content[k..], &db);
                         if (dr.len > 0) {
-                            try parser.esc(db[0..dr.len], output);
+                            try language.appendSlice(parser.allocator, db[0..dr.len]);
                             k += dr.consumed;
                             continue;
                         }
                     }
-                    if (content[k] == '\\' and k + 1 < info_end and isAsciiPunct(content[k + 1])) {
-                        k += 1;
-                        try parser.writeByte(output, content[k]);
-                    } else if (html_escape_map[content[k]]) |e| {
-                        try parser.writeAll(output, e);
-                    } else {
-                        try parser.writeByte(output, content[k]);
-                    }
+                    if (content[k] == '\\' and k + 1 < info_end and isAsciiPunct(content[k + 1])) k += 1;
+                    try language.append(parser.allocator, content[k]);
                     k += 1;
                 }
-                try parser.writeAll(output, "\"");
+                if (language.items.len > 0) {
+                    try parser.writeAll(output, " class=\"language-");
+                    try parser.esc(language.items, output);
+                    try parser.writeAll(output, "\"");
+                }
+                try parser.writeAll(output, ">");
+                if (parser.options.code_hook) |hook| {
+                    parser.code_hooked = hook.wants(hook.context, language.items);
+                    parser.code_body.clearRetainingCapacity();
+                }
+                try parser.pushBlock(.code, @intCast(leading_spaces + extra_spaces));
+                parser.block_stack[parser.stack_depth - 1].fence_char = f_char;
+                parser.block_stack[parser.stack_depth - 1].fence_count = @intCast(f_count);
+                return true;
             }
-            try parser.writeAll(output, ">");
-            try parser.pushBlock(.code, @intCast(leading_spaces + extra_spaces));
-            parser.block_stack[parser.stack_depth - 1].fence_char = f_char;
-            parser.block_stack[parser.stack_depth - 1].fence_count = @intCast(f_count);
-            return true;
+            return false;
         }
-        return false;
-    }
-    fn parseMathBlock(parser: *OctomarkParser, line_content: []const u8, leading_spaces: usize, output: anytype) !bool {
-        const _s = parser.startCall(.parseMathBlock);
-        defer parser.endCall(.parseMathBlock, _s);
-        const content = std.mem.trimLeft(u8, line_content, " ");
-        const extra_spaces = line_content.len - content.len;
-        if (content.len >= 2 and std.mem.eql(u8, content[0..2], "$$")) {
-            const block_type = parser.topT();
-            if (block_type == .paragraph or block_type == .table or block_type == .code or block_type == .math) {
-                try parser.renderTop(output);
-            }
-            try parser.writeAll(output, "<div class=\"math\">\n");
-            try parser.pushBlock(.math, @intCast(leading_spaces + extra_spaces));
-            const remainder = content[2..];
-            const trimmed_rem = std.mem.trim(u8, remainder, " \t");
-            if (trimmed_rem.len > 0) {
-                if (trimmed_rem.len >= 2 and std.mem.eql(u8, trimmed_rem[trimmed_rem.len - 2 ..], "$$")) {
-                    const math_content = std.mem.trim(u8, trimmed_rem[0 .. trimmed_rem.len - 2], " \t");
-                    try parser.esc(math_content, output);
-                    try parser.writeByte(output, '\n');
+        /// Write the hook's HTML for the buffered block, replaying the cached result when an
+        /// identical block in the same language was highlighted before.
+        fn writeHookedCode(p: *Self, o: anytype) !void {
+            p.code_hooked = false;
+            const hook = p.options.code_hook.?;
+            const parts = [_][]const u8{ p.code_language.items, &.{0}, p.code_body.items };
+            const hash = CacheEntry.hashOf(&parts);
+            if (p.code_cache.len == 0 and p.options.code_cache_entries > 0) {
+                p.code_cache = try p.allocator.alloc(CacheEntry, p.options.code_cache_entries);
+                @memset(p.code_cache, .{});
+            }
+            const slot: ?*CacheEntry = if (p.code_cache.len > 0) &p.code_cache[hash % p.code_cache.len] else null;
+            if (slot) |entry| {
+                if (entry.matches(hash, &parts)) return p.writeAll(o, entry.html);
+            }
+            var html = std.Io.Writer.Allocating.init(p.allocator);
+            defer html.deinit();
+            try hook.begin(hook.context, p.code_language.items, &html.writer);
+            const body = p.code_body.items;
+            var start: usize = 0;
+            while (std.mem.indexOfScalarPos(u8, body, start, '\n')) |nl| : (start = nl + 1) {
+                try hook.line(hook.context, body[start..nl], &html.writer);
+            }
+            try hook.end(hook.context, &html.writer);
+            try p.writeAll(o, html.written());
+            if (slot) |entry| try entry.replace(p.allocator, hash, &parts, try html.toOwnedSlice());
+        }
+        /// Write the hook's HTML for `tex`, from the shared cache when it has been rendered before.
+        fn writeMath(p: *Self, tex: []const u8, display: bool, o: anytype) !void {
+            const hook = p.options.math_hook.?;
+            var hasher = std.hash.Wyhash.init(@intFromBool(display));
+            hasher.update(tex);
+            const hash = hasher.final();
+            if (p.options.math_cache) |cache| {
+                p.math_scratch.clearRetainingCapacity();
+                if (try cache.lookup(hash, tex, display, &p.math_scratch, p.allocator)) return p.writeAll(o, p.math_scratch.items);
+            }
+            var html = std.Io.Writer.Allocating.init(p.allocator);
+            defer html.deinit();
+            try hook.render(hook.context, tex, display, &html.writer);
+            try p.writeAll(o, html.written());
+            if (p.options.math_cache) |cache| try cache.store(hash, tex, display, html.written());
+        }
+        fn parseMathBlock(parser: *Self, line_content: []const u8, leading_spaces: usize, output: anytype) !bool {
+            const _s = parser.startCall(.parseMathBlock);
+            defer parser.endCall(.parseMathBlock, _s);
+            const content = std.mem.trimLeft(u8, line_content, " ");
+            const extra_spaces = line_content.len - content.len;
+            if (content.len >= 2 and std.mem.eql(u8, content[0..2], "$$")) {
+                const block_type = parser.topT();
+                if (block_type == .paragraph or block_type == .table or block_type == .code or block_type == .math) {
                     try parser.renderTop(output);
-                } else {
-                    try parser.esc(remainder, output);
-                    try parser.writeByte(output, '\n');
                 }
+                try parser.writeAll(output, "<div class=\"math\">\n");
+                try parser.pushBlock(.math, @intCast(leading_spaces + extra_spaces));
+                const hooked = parser.options.math_hook != null;
+                if (hooked) parser.math_body.clearRetainingCapacity();
+                const remainder = content[2..];
+                const trimmed_rem = std.mem.trim(u8, remainder, " \t");
+                if (trimmed_rem.len > 0) {
+                    const closed = trimmed_rem.len >= 2 and std.mem.eql(u8, trimmed_rem[trimmed_rem.len - 2 ..], "$$");
+                    const line = if (closed) std.mem.trim(u8, trimmed_rem[0 .. trimmed_rem.len - 2], " \t") else remainder;
+                    if (hooked) {
+                        try parser.math_body.appendSlice(parser.allocator, line);
+                        try parser.math_body.append(parser.allocator, '\n');
+                    } else {
+                        try parser.esc(line, output);
+                        try parser.writeByte(output, '\n');
+                    }
+                    if (closed) try parser.renderTop(output);
+                }
+                return true;
             }
-            return true;
+            return false;
         }
-        return false;
-    }
-    fn parseHeader(parser: *OctomarkParser, line_content: []const u8, leading_spaces: usize, output: anytype) !bool {
-        const _s = parser.startCall(.parseHeader);
-        defer parser.endCall(.parseHeader, _s);
-        if (leading_spaces > 3) return false;
-        if (line_content.len >= 1 and line_content[0] == '#') {
-            var level: usize = 0;
-            while (level < 6 and level < line_content.len and line_content[level] == '#') : (level += 1) {}
-            if (level == 0 or level > 6) return false;
-            if (level < line_content.len and line_content[level] != ' ' and line_content[level] != '\t') return false;
-            var content_start: usize = level;
-            while (content_start < line_content.len and (line_content[content_start] == ' ' or
-                line_content[content_start] == '\t')) : (content_start += 1)
-            {}
-            var end = line_content.len;
-            while (end > content_start and (line_content[end - 1] == ' ' or line_content[end - 1] == '\t')) : (end -= 1) {}
-            if (end > content_start) {
-                var hash_end = end;
-                while (hash_end > content_start and line_content[hash_end - 1] == '#') : (hash_end -= 1) {}
-                if (hash_end < end) {
-                    if (hash_end == content_start) end = content_start;
-                    var space_end = hash_end;
-                    while (space_end > content_start and (line_content[space_end - 1] == ' ' or
-                        line_content[space_end - 1] == '\t')) : (space_end -= 1)
-                    {}
-                    if (space_end < hash_end) end = space_end;
+        fn parseHeader(parser: *Self, line_content: []const u8, leading_spaces: usize, output: anytype) !bool {
+            const _s = parser.startCall(.parseHeader);
+            defer parser.endCall(.parseHeader, _s);
+            if (leading_spaces > 3) return false;
+            if (line_content.len >= 1 and line_content[0] == '#') {
+                var level: usize = 0;
+                while (level < 6 and level < line_content.len and line_content[level] == '#') : (level += 1) {}
+                if (level == 0 or level > 6) return false;
+                if (level < line_content.len and line_content[level] != ' ' and line_content[level] != '\t') return false;
+                var content_start: usize = level;
+                while (content_start < line_content.len and (line_content[content_start] == ' ' or
+                    line_content[content_start] == '\t')) : (content_start += 1)
+                {}
+                var end = line_content.len;
+                while (end > content_start and (line_content[end - 1] == ' ' or line_content[end - 1] == '\t')) : (end -= 1) {}
+                if (end > content_start) {
+                    var hash_end = end;
+                    while (hash_end > content_start and line_content[hash_end - 1] == '#') : (hash_end -= 1) {}
+                    if (hash_end < end) {
+                        if (hash_end == content_start) end = content_start;
+                        var space_end = hash_end;
+                        while (space_end > content_start and (line_content[space_end - 1] == ' ' or
+                            line_content[space_end - 1] == '\t')) : (space_end -= 1)
+                        {}
+                        if (space_end < hash_end) end = space_end;
+                    }
                 }
+                try parser.tryCloseLeaf(output);
+                parser.listItemMarkBlock();
+                const level_char: u8 = '0' + @as(u8, @intCast(level));
+                try parser.writeAll(output, "<h");
+                try parser.writeByte(output, level_char);
+                try parser.writeAll(output, ">");
+                parser.token_field = .heading;
+                defer parser.token_field = .body;
+                try parser.renderLeafInline(.heading, line_content[content_start..end], output);
+                try parser.writeAll(output, "</h");
+                try parser.writeByte(output, level_char);
+                try parser.writeAll(output, ">\n");
+                return true;
             }
-            try parser.tryCloseLeaf(output);
-            parser.listItemMarkBlock();
-            const level_char: u8 = '0' + @as(u8, @intCast(level));
-            try parser.writeAll(output, "<h");
-            try parser.writeByte(output, level_char);
-            try parser.writeAll(output, ">");
-            try parser.parseInlineContent(line_content[content_start..end], output);
-            try parser.writeAll(output, "</h");
-            try parser.writeByte(output, level_char);
-            try parser.writeAll(output, ">\n");
-            return true;
+            return false;
         }
-        return false;
-    }
-    fn parseHorizontalRule(parser: *OctomarkParser, line_content: []const u8, leading_spaces: usize, output: anytype) !bool {
-        const _s = parser.startCall(.parseHorizontalRule);
-        defer parser.endCall(.parseHorizontalRule, _s);
-        if (leading_spaces <= 3 and isThematicBreakLine(line_content)) {
-            try parser.tryCloseLeaf(output);
-            parser.listItemMarkBlock();
-            try parser.writeAll(output, "<hr>\n");
-            return true;
+        fn parseHorizontalRule(parser: *Self, line_content: []const u8, leading_spaces: usize, output: anytype) !bool {
+            const _s = parser.startCall(.parseHorizontalRule);
+            defer parser.endCall(.parseHorizontalRule, _s);
+            if (leading_spaces <= 3 and isThematicBreakLine(line_content)) {
+                try parser.tryCloseLeaf(output);
+                parser.listItemMarkBlock();
+                try parser.writeAll(output, "<hr>\n");
+                return true;
+            }
+            return false;
         }
-        return false;
-    }
-    fn parseDefinitionList(parser: *OctomarkParser, line_content: *[]const u8, leading_spaces: *usize, output: anytype) !bool {
-        const _s = parser.startCall(.parseDefinitionList);
-        defer parser.endCall(.parseDefinitionList, _s);
-        var line = line_content.*;
-        if (line.len > 0 and line[0] == ':') {
-            var consumed: usize = 1;
-            line = line[1..];
-            if (line.len > 0 and line[0] == ' ') {
+        fn parseDefinitionList(parser: *Self, line_content: *[]const u8, leading_spaces: *usize, output: anytype) !bool {
+            const _s = parser.startCall(.parseDefinitionList);
+            defer parser.endCall(.parseDefinitionList, _s);
+            var line = line_content.*;
+            if (line.len > 0 and line[0] == ':') {
+                var consumed: usize = 1;
                 line = line[1..];
-                consumed += 1;
-            }
-            try parser.closeP(output);
-            var in_dl = false;
-            var in_dd = false;
-            for (parser.block_stack[0..parser.stack_depth]) |entry| {
-                if (entry.block_type == .definition_list) in_dl = true;
-                if (entry.block_type == .definition_description) in_dd = true;
-            }
-            if (!in_dl) {
-                try parser.writeAll(output, "<dl>\n");
-                try parser.pushBlock(.definition_list, @intCast(leading_spaces.*));
-            }
-            if (in_dd) {
-                while (parser.topT() != .definition_list and parser.stack_depth > 0) {
-                    try parser.renderTop(output);
+                if (line.len > 0 and line[0] == ' ') {
+                    line = line[1..];
+                    consumed += 1;
+                }
+                try parser.closeP(output);
+                var in_dl = false;
+                var in_dd = false;
+                for (parser.block_stack[0..parser.stack_depth]) |entry| {
+                    if (entry.block_type == .definition_list) in_dl = true;
+                    if (entry.block_type == .definition_description) in_dd = true;
+                }
+                if (!in_dl) {
+                    try parser.writeAll(output, "<dl>\n");
+                    try parser.pushBlock(.definition_list, @intCast(leading_spaces.*));
                 }
+                if (in_dd) {
+                    while (parser.topT() != .definition_list and parser.stack_depth > 0) {
+                        try parser.renderTop(output);
+                    }
+                }
+                try parser.writeAll(output, "<dd>");
+                try parser.pushBlock(.definition_description, @intCast(leading_spaces.*));
+                line_content.* = line;
+                leading_spaces.* += consumed;
+                return true;
             }
-            try parser.writeAll(output, "<dd>");
-            try parser.pushBlock(.definition_description, @intCast(leading_spaces.*));
-            line_content.* = line;
-            leading_spaces.* += consumed;
-            return true;
+            return false;
         }
-        return false;
-    }
-    fn parseListItem(parser: *OctomarkParser, line_content: *[]const u8, leading_spaces: *usize, output: anytype) !bool {
-        const _s = parser.startCall(.parseListItem);
-        defer parser.endCall(.parseListItem, _s);
-        var line = line_content.*;
-        if (line.len == 0) return false;
-        if (isThematicBreakLine(line)) return false;
-        if (leading_spaces.* >= 4 and parser.active_list_stack_idx < 0) return false;
-        const trimmed_line = std.mem.trimLeft(u8, line, " ");
-        const internal_spaces = line.len - trimmed_line.len;
-        // Unordered list marker: -, *, +
-        var is_ul = false;
-        var marker_bytes: usize = 0;
-        var marker_columns: usize = 0;
-        var marker_extra_columns: usize = 0;
-        if (line.len - internal_spaces >= 1) {
-            const m = line[internal_spaces];
-            if (m == '-' or m == '*' or m == '+') {
-                if (internal_spaces + 1 == line.len) {
-                    marker_bytes = 1;
-                    marker_columns = 2;
-                    is_ul = true;
-                } else {
-                    const next = line[internal_spaces + 1];
-                    if (next == ' ' or next == '\t') {
-                        const base_col = leading_spaces.* + internal_spaces + 1;
-                        const tab_width: usize = if (next == '\t') 4 - (base_col % 4) else 1;
-                        marker_bytes = 2;
+        fn parseListItem(parser: *Self, line_content: *[]const u8, leading_spaces: *usize, output: anytype) !bool {
+            const _s = parser.startCall(.parseListItem);
+            defer parser.endCall(.parseListItem, _s);
+            var line = line_content.*;
+            if (line.len == 0) return false;
+            if (isThematicBreakLine(line)) return false;
+            if (leading_spaces.* >= 4 and parser.active_list_stack_idx < 0) return false;
+            const trimmed_line = std.mem.trimLeft(u8, line, " ");
+            const internal_spaces = line.len - trimmed_line.len;
+            // Unordered list marker: -, *, +
+            var is_ul = false;
+            var marker_bytes: usize = 0;
+            var marker_columns: usize = 0;
+            var marker_extra_columns: usize = 0;
+            if (line.len - internal_spaces >= 1) {
+                const m = line[internal_spaces];
+                if (m == '-' or m == '*' or m == '+') {
+                    if (internal_spaces + 1 == line.len) {
+                        marker_bytes = 1;
                         marker_columns = 2;
-                        if (next == '\t' and tab_width > 0) marker_extra_columns = tab_width - 1;
                         is_ul = true;
+                    } else {
+                        const next = line[internal_spaces + 1];
+                        if (next == ' ' or next == '\t') {
+                            const base_col = leading_spaces.* + internal_spaces + 1;
+                            const tab_width: usize = if (next == '\t') 4 - (base_col % 4) else 1;
+                            marker_bytes = 2;
+                            marker_columns = 2;
+                            if (next == '\t' and tab_width > 0) marker_extra_columns = tab_width - 1;
+                            is_ul = true;
+                        }
                     }
                 }
             }
-        }
-        var ol_marker_char: u8 = 0;
-        const is_ol = blk: {
-            var ol_num_len: usize = 0;
-            while (internal_spaces + ol_num_len < line.len and std.ascii.isDigit(line[internal_spaces + ol_num_len])) : (ol_num_len += 1) {}
-            if (ol_num_len > 0 and ol_num_len <= 9 and internal_spaces + ol_num_len < line.len) {
-                const marker = line[internal_spaces + ol_num_len];
-                if (marker == '.' or marker == ')') {
-                    ol_marker_char = marker;
-                    if (internal_spaces + ol_num_len + 1 == line.len) {
-                        marker_bytes = ol_num_len + 1;
-                        marker_columns = ol_num_len + 2;
-                    } else {
-                        const next = line[internal_spaces + ol_num_len + 1];
-                        if (next != ' ' and next != '\t') break :blk false;
-                        const base_col = leading_spaces.* + internal_spaces + ol_num_len + 1;
-                        const tab_width: usize = if (next == '\t') 4 - (base_col % 4) else 1;
-                        marker_bytes = ol_num_len + 2;
-                        marker_columns = ol_num_len + 1 + tab_width;
-                        if (next == '\t' and tab_width > 0) marker_extra_columns = tab_width - 1;
+            var ol_marker_char: u8 = 0;
+            const is_ol = blk: {
+                var ol_num_len: usize = 0;
+                while (internal_spaces + ol_num_len < line.len and std.ascii.isDigit(line[internal_spaces + ol_num_len])) : (ol_num_len += 1) {}
+                if (ol_num_len > 0 and ol_num_len <= 9 and internal_spaces + ol_num_len < line.len) {
+                    const marker = line[internal_spaces + ol_num_len];
+                    if (marker == '.' or marker == ')') {
+                        ol_marker_char = marker;
+                        if (internal_spaces + ol_num_len + 1 == line.len) {
+                            marker_bytes = ol_num_len + 1;
+                            marker_columns = ol_num_len + 2;
+                        } else {
+                            const next = line[internal_spaces + ol_num_len + 1];
+                            if (next != ' ' and next != '\t') break :blk false;
+                            const base_col = leading_spaces.* + internal_spaces + ol_num_len + 1;
+                            const tab_width: usize = if (next == '\t') 4 - (base_col % 4) else 1;
+                            marker_bytes = ol_num_len + 2;
+                            marker_columns = ol_num_len + 1 + tab_width;
+                            if (next == '\t' and tab_width > 0) marker_extra_columns = tab_width - 1;
+                        }
+                        // CommonMark: ordered list with start number != 1 cannot interrupt paragraph
+                        if (parser.topT() == .paragraph and ol_num_len > 0) {
+                            const start_num = std.fmt.parseInt(u32, line[internal_spaces .. internal_spaces + ol_num_len], 10) catch 1;
+                            if (start_num != 1) return false;
+                        }
+                        break :blk true;
                     }
-                    // CommonMark: ordered list with start number != 1 cannot interrupt paragraph
-                    if (parser.topT() == .paragraph and ol_num_len > 0) {
-                        const start_num = std.fmt.parseInt(u32, line[internal_spaces .. internal_spaces + ol_num_len], 10) catch 1;
-                        if (start_num != 1) return false;
+                }
+                break :blk false;
+            };
+            if (is_ul or is_ol) {
+                const rem_check = std.mem.trimLeft(u8, line[internal_spaces + marker_bytes ..], " \t");
+                if (rem_check.len == 0 and (parser.topT() == .paragraph or parser.paragraph_content.items.len > 0)) {
+                    if (parser.active_list_stack_idx < 0) return false;
+                }
+                const target_marker = if (is_ul) line[internal_spaces] else ol_marker_char;
+                const target_type: BlockType = if (is_ul) .unordered_list else .ordered_list;
+                const current_indent: i32 = @intCast(leading_spaces.* + internal_spaces);
+                var normalized_indent = current_indent;
+                const top_list_indent: ?i32 = if (parser.active_list_stack_idx >= 0)
+                    parser.block_stack[@intCast(parser.active_list_stack_idx)].indent_level
+                else
+                    null;
+                const top_list_content: ?i32 = if (parser.active_list_stack_idx >= 0)
+                    parser.block_stack[@intCast(parser.active_list_stack_idx)].content_indent
+                else
+                    null;
+                if (top_list_indent != null and top_list_content != null) {
+                    const tli = top_list_indent.?;
+                    const tlc = top_list_content.?;
+                    if (current_indent > tli and current_indent < tlc) {
+                        normalized_indent = tli;
                     }
-                    break :blk true;
                 }
-            }
-            break :blk false;
-        };
-        if (is_ul or is_ol) {
-            const rem_check = std.mem.trimLeft(u8, line[internal_spaces + marker_bytes ..], " \t");
-            if (rem_check.len == 0 and (parser.topT() == .paragraph or parser.paragraph_content.items.len > 0)) {
-                if (parser.active_list_stack_idx < 0) return false;
-            }
-            const target_marker = if (is_ul) line[internal_spaces] else ol_marker_char;
-            const target_type: BlockType = if (is_ul) .unordered_list else .ordered_list;
-            const current_indent: i32 = @intCast(leading_spaces.* + internal_spaces);
-            var normalized_indent = current_indent;
-            const top_list_indent: ?i32 = if (parser.active_list_stack_idx >= 0)
-                parser.block_stack[@intCast(parser.active_list_stack_idx)].indent_level
-            else
-                null;
-            const top_list_content: ?i32 = if (parser.active_list_stack_idx >= 0)
-                parser.block_stack[@intCast(parser.active_list_stack_idx)].content_indent
-            else
-                null;
-            if (top_list_indent != null and top_list_content != null) {
-                const tli = top_list_indent.?;
-                const tlc = top_list_content.?;
-                if (current_indent > tli and current_indent < tlc) {
-                    normalized_indent = tli;
-                }
-            }
-            if (top_list_indent != null and top_list_content != null) {
-                const tli = top_list_indent.?;
-                const tlc = top_list_content.?;
-                if (current_indent > tli + 3 and current_indent < tlc) {
-                    return false;
+                if (top_list_indent != null and top_list_content != null) {
+                    const tli = top_list_indent.?;
+                    const tlc = top_list_content.?;
+                    if (current_indent > tli + 3 and current_indent < tlc) {
+                        return false;
+                    }
                 }
-            }
-            const pre_block_type = parser.topT();
-            if (pre_block_type == .paragraph or pre_block_type == .table or pre_block_type == .code or
-                pre_block_type == .math)
-            {
-                try parser.renderTop(output);
-            }
-            while (parser.stack_depth > 0 and
-                parser.topT() != null and @intFromEnum(parser.topT().?) < @intFromEnum(BlockType.blockquote) and
-                (parser.block_stack[parser.stack_depth - 1].indent_level > normalized_indent or
-                    (parser.block_stack[parser.stack_depth - 1].indent_level == normalized_indent and
-                        (parser.topT() != target_type or parser.block_stack[parser.stack_depth - 1].extra_type !=
-                            target_marker))))
-            {
-                if (parser.pending_loose_idx) |idx| {
-                    const top_idx = parser.stack_depth - 1;
-                    if (idx == top_idx) {
-                        const closing_indent = parser.block_stack[top_idx].indent_level;
-                        if (closing_indent > normalized_indent) {
-                            var outer: ?usize = null;
-                            var j: usize = top_idx;
-                            while (j > 0) {
-                                j -= 1;
-                                const bt = parser.block_stack[j].block_type;
-                                if (bt == .unordered_list or bt == .ordered_list) {
-                                    outer = j;
-                                    break;
+                const pre_block_type = parser.topT();
+                if (pre_block_type == .paragraph or pre_block_type == .table or pre_block_type == .code or
+                    pre_block_type == .math)
+                {
+                    try parser.renderTop(output);
+                }
+                while (parser.stack_depth > 0 and
+                    parser.topT() != null and @intFromEnum(parser.topT().?) < @intFromEnum(BlockType.blockquote) and
+                    (parser.block_stack[parser.stack_depth - 1].indent_level > normalized_indent or
+                        (parser.block_stack[parser.stack_depth - 1].indent_level == normalized_indent and
+                            (parser.topT() != target_type or parser.block_stack[parser.stack_depth - 1].extra_type !=
+                                target_marker))))
+                {
+                    if (parser.pending_loose_idx) |idx| {
+                        const top_idx = parser.stack_depth - 1;
+                        if (idx == top_idx) {
+                            const closing_indent = parser.block_stack[top_idx].indent_level;
+                            if (closing_indent > normalized_indent) {
+                                var outer: ?usize = null;
+                                var j: usize = top_idx;
+                                while (j > 0) {
+                                    j -= 1;
+                                    const bt = parser.block_stack[j].block_type;
+                                    if (bt == .unordered_list or bt == .ordered_list) {
+                                        outer = j;
+                                        break;
+                                    }
                                 }
+                                parser.pending_loose_idx = outer;
                             }
-                            parser.pending_loose_idx = outer;
                         }
                     }
+                    try parser.renderTop(output);
                 }
-                try parser.renderTop(output);
-            }
-            const top = parser.topT();
-            const list_loose = (top == .unordered_list or top == .ordered_list) and
-                parser.block_stack[parser.stack_depth - 1].loose;
-            if (parser.paragraph_content.items.len > 0) {
-                const wrap_paragraph = list_loose and parser.topT() != .paragraph;
-                try parser.flushListParagraph(output, wrap_paragraph);
-            }
-            if (top == target_type and parser.block_stack[parser.stack_depth - 1].indent_level == normalized_indent) {
-                parser.listItemEnd();
-                try parser.writeAll(output, "</li>\n<li>");
-                parser.listItemStart();
-            } else {
-                if (target_type == .unordered_list) {
-                    try parser.writeAll(output, "<ul>\n<li>");
-                    try parser.pushBlockExtra(target_type, current_indent, target_marker);
+                const top = parser.topT();
+                const list_loose = (top == .unordered_list or top == .ordered_list) and
+                    parser.block_stack[parser.stack_depth - 1].loose;
+                if (parser.paragraph_content.items.len > 0) {
+                    const wrap_paragraph = list_loose and parser.topT() != .paragraph;
+                    try parser.flushListParagraph(output, wrap_paragraph);
+                }
+                if (top == target_type and parser.block_stack[parser.stack_depth - 1].indent_level == normalized_indent) {
+                    parser.listItemEnd();
+                    try parser.writeAll(output, "</li>\n<li>");
                     parser.listItemStart();
                 } else {
-                    const start_num = std.fmt.parseInt(u32, line[internal_spaces .. internal_spaces + marker_bytes -
-                        2], 10) catch 1;
-                    if (start_num != 1) {
-                        try parser.writeAll(output, "<ol start=\"");
-                        var num_buf: [11]u8 = undefined;
-                        const num_str = std.fmt.bufPrint(&num_buf, "{d}", .{start_num}) catch "1";
-                        try parser.writeAll(output, num_str);
-                        try parser.writeAll(output, "\">\n<li>");
+                    if (target_type == .unordered_list) {
+                        try parser.writeAll(output, "<ul>\n<li>");
+                        try parser.pushBlockExtra(target_type, current_indent, target_marker);
+                        parser.listItemStart();
                     } else {
-                        try parser.writeAll(output, "<ol>\n<li>");
+                        const start_num = std.fmt.parseInt(u32, line[internal_spaces .. internal_spaces + marker_bytes -
+                            2], 10) catch 1;
+                        if (start_num != 1) {
+                            try parser.writeAll(output, "<ol start=\"");
+                            var num_buf: [11]u8 = undefined;
+                            const num_str = std.fmt.bufPrint(&num_buf, "{d}", .{start_num}) catch "1";
+                            try parser.writeAll(output, num_str);
+                            try parser.writeAll(output, "\">\n<li>");
+                        } else {
+                            try parser.writeAll(output, "<ol>\n<li>");
+                        }
+                        try parser.pushBlockExtra(target_type, current_indent, target_marker);
+                        parser.block_stack[parser.stack_depth - 1].list_start = start_num;
+                        parser.listItemStart();
                     }
-                    try parser.pushBlockExtra(target_type, current_indent, target_marker);
-                    parser.block_stack[parser.stack_depth - 1].list_start = start_num;
-                    parser.listItemStart();
                 }
+                var remainder = line[internal_spaces + marker_bytes ..];
+                const base_indent = leading_spaces.* + internal_spaces + marker_columns;
+                leading_spaces.* = base_indent + marker_extra_columns;
+                var item_content_indent = base_indent;
+                if (remainder.len > 0) {
+                    const extra = leadingIndent(remainder);
+                    if (extra.columns > 0) {
+                        if (extra.columns < 4) {
+                            const take_cols: usize = extra.columns;
+                            remainder = stripIndentColumns(remainder, take_cols);
+                            item_content_indent += take_cols;
+                            leading_spaces.* += take_cols;
+                        }
+                    }
+                }
+                if (dialect.task_lists and remainder.len >= 3 and remainder[0] == '[' and
+                    (remainder[1] == ' ' or remainder[1] == 'x' or remainder[1] == 'X') and remainder[2] == ']')
+                {
+                    if (remainder.len == 3 or remainder[3] == ' ' or remainder[3] == '\t') {
+                        parser.pending_task_marker = if (remainder[1] == ' ') @as(u8, 1) else @as(u8, 2);
+                        remainder = remainder[3..];
+                        if (remainder.len > 0 and (remainder[0] == ' ' or remainder[0] == '\t')) {
+                            remainder = remainder[1..];
+                            item_content_indent += 4;
+                            leading_spaces.* += 4;
+                        } else {
+                            item_content_indent += 3;
+                            leading_spaces.* += 3;
+                        }
+                    }
+                }
+                parser.block_stack[parser.stack_depth - 1].content_indent = @intCast(item_content_indent);
+                const rem_trim = std.mem.trim(u8, remainder, " \t");
+                const empty_item = rem_trim.len == 0 and parser.pending_task_marker == 0;
+                parser.block_stack[parser.stack_depth - 1].pending_empty_item = empty_item;
+                line_content.* = remainder;
+                return true;
+            }
+            return false;
+        }
+        fn parseTable(parser: *Self, line_content: []const u8, full_data: []const u8, current_pos: usize, output: anytype) !bool {
+            const _s = parser.startCall(.parseTable);
+            defer parser.endCall(.parseTable, _s); // 1. If we are already IN a table, process body rows strictly.
+            if (parser.topT() == .table) {
+                const trimmed_line = std.mem.trim(u8, line_content, &std.ascii.whitespace);
+                // Quick pipe check for body row
+                const has_pipe = std.mem.indexOfScalar(u8, trimmed_line, '|') != null;
+                if (has_pipe) {
+                    if (parser.batchesTableRows()) {
+                        try parser.table_batch.appendSlice(parser.allocator, line_content);
+                        try parser.table_row_ends.append(parser.allocator, parser.table_batch.items.len);
+                        if (parser.table_row_ends.items.len >= parser.options.table_batch_rows) try parser.flushTableBatch(output);
+                        return true;
+                    }
+                    try parser.renderTableRow(line_content, parser.table_cell_tags.items, output);
+                    return true;
+                } else { // No pipe = end of table
+                    try parser.renderTop(output); // Continue to process this line as something else (return false)
+                    return false;
+                }
+            }
+            if (current_pos >= full_data.len) return false;
+            if (std.mem.indexOfScalar(u8, line_content, '|') == null) return false;
+            if (!parser.isNextLineTableSeparator(full_data, current_pos)) return false;
+            const sep_line_end = if (std.mem.indexOfScalar(u8, full_data[current_pos..], '\n')) |nl|
+                current_pos + nl
+            else
+                full_data.len;
+            const sep_line = full_data[current_pos..sep_line_end];
+            // Column storage is retained across rows and tables, so it only grows for the widest table seen.
+            try parser.splitTableRowCells(sep_line, &parser.table_cells);
+            parser.table_alignments.clearRetainingCapacity();
+            for (parser.table_cells.items) |cell| {
+                var col_align = TableAlignment.none;
+                if (cell.len > 0) {
+                    const left = cell[0] == ':';
+                    const right = cell[cell.len - 1] == ':';
+                    col_align = if (left and right) TableAlignment.center else if (left) TableAlignment.left else if (right) TableAlignment.right else TableAlignment.none;
+                }
+                try parser.table_alignments.append(parser.allocator, col_align);
+            }
+            const sep_count = parser.table_alignments.items.len;
+            try parser.splitTableRowCells(line_content, &parser.table_cells);
+            const header_count = parser.table_cells.items.len;
+            try parser.table_alignments.resize(parser.allocator, header_count);
+            if (header_count > sep_count) @memset(parser.table_alignments.items[sep_count..], .none);
+            parser.table_cell_tags.clearRetainingCapacity();
+            for (parser.table_alignments.items) |a| try parser.table_cell_tags.append(parser.allocator, table_data_open_tags[@intFromEnum(a)]);
+            try parser.tryCloseLeaf(output);
+            try parser.writeAll(output, "<table><thead><tr>");
+            for (parser.table_cells.items, parser.table_alignments.items) |cell, a| {
+                try parser.writeAll(output, table_header_open_tags[@intFromEnum(a)]);
+                try parser.renderTableCell(cell, output);
+                try parser.writeAll(output, "</th>");
+            }
+            try parser.writeAll(output, "</tr></thead><tbody>\n");
+            try parser.pushBlock(.table, 0);
+            return true;
+        }
+        /// Whether body rows go to the worker pool. Footnote numbering, reference and wiki link
+        /// state, document statistics and token offsets live in this parser, so rows that may
+        /// touch them stay inline. User callbacks promise nothing about concurrent calls, so
+        /// setting any of them keeps rows on the calling thread as well.
+        fn batchesTableRows(p: *const Self) bool {
+            if (dialect.footnotes or dialect.references or dialect.wiki_links) return false;
+            if (p.options.document_stats or p.hasCallbacks()) return false;
+            return p.options.table_threads > 0 and p.stack_depth == 1;
+        }
+        fn hasCallbacks(p: *const Self) bool {
+            const o = p.options;
+            return o.code_hook != null or o.math_hook != null or o.token_sink != null or
+                o.reference_resolver != null or o.wiki_resolver != null;
+        }
+        fn renderTableRow(p: *Self, line: []const u8, tags: []const []const u8, o: anytype) !void {
+            if (!p.memoizes(line)) return p.renderTableRowCells(line, tags, o);
+            // Cell tags come from the static tables, so their addresses identify the alignments.
+            const parts = [_][]const u8{
+                &.{@intFromEnum(MemoContext.table_row)},
+                std.mem.asBytes(&tags.len),
+                std.mem.sliceAsBytes(tags),
+                line,
+            };
+            const key = CacheEntry.hashOf(&parts);
+            if (p.memoLookup(key, &parts)) |html| return p.writeAll(o, html);
+            p.memo_scratch.clearRetainingCapacity();
+            try p.renderTableRowCells(line, tags, BufferSink{ .list = &p.memo_scratch, .allocator = p.allocator });
+            try p.memoStore(key, &parts, p.memo_scratch.items);
+            try p.writeAll(o, p.memo_scratch.items);
+        }
+        fn renderTableRowCells(p: *Self, line: []const u8, tags: []const []const u8, o: anytype) !void {
+            try p.splitTableRowCells(line, &p.table_cells);
+            try p.writeAll(o, "<tr>");
+            for (p.table_cells.items, 0..) |cell, k| {
+                try p.writeAll(o, if (k < tags.len) tags[k] else table_data_open_tags[0]);
+                try p.renderTableCell(cell, o);
+                try p.writeAll(o, "</td>");
+            }
+            try p.writeAll(o, "</tr>\n");
+        }
+        inline fn renderTableCell(p: *Self, cell: []const u8, o: anytype) !void {
+            // Cells without inline specials (numbers, identifiers) render verbatim.
+            const extra = comptime extensionCandidates(dialect);
+            if (std.mem.indexOfAny(u8, cell, special) == null and
+                (extra.len == 0 or std.mem.indexOfAny(u8, cell, extra) == null))
+            {
+                try p.writeAll(o, cell);
+                p.stats_in_word = false;
+                p.stats_word_counted = false;
+                try p.visibleText(cell, null);
+                return;
             }
-            var remainder = line[internal_spaces + marker_bytes ..];
-            const base_indent = leading_spaces.* + internal_spaces + marker_columns;
-            leading_spaces.* = base_indent + marker_extra_columns;
-            var item_content_indent = base_indent;
-            if (remainder.len > 0) {
-                const extra = leadingIndent(remainder);
-                if (extra.columns > 0) {
-                    if (extra.columns < 4) {
-                        const take_cols: usize = extra.columns;
-                        remainder = stripIndentColumns(remainder, take_cols);
-                        item_content_indent += take_cols;
-                        leading_spaces.* += take_cols;
+            try p.parseInlineContent(cell, o);
+        }
+        /// Render the batched table rows on the worker pool and write them in row order.
+        fn flushTableBatch(p: *Self, o: anytype) !void {
+            const rows = p.table_row_ends.items.len;
+            if (rows == 0) return;
+            const _s = p.startCall(.flushTableBatch);
+            defer p.endCall(.flushTableBatch, _s);
+            defer {
+                p.table_batch.clearRetainingCapacity();
+                p.table_row_ends.clearRetainingCapacity();
+            }
+            if (p.table_pool == null) {
+                const pool = try p.allocator.create(std.Thread.Pool);
+                errdefer p.allocator.destroy(pool);
+                try pool.init(.{ .allocator = p.allocator, .n_jobs = p.options.table_threads });
+                p.table_pool = pool;
+            }
+            const n_workers = @min(p.options.table_threads, rows);
+            while (p.table_workers.items.len < n_workers) {
+                var worker: TableWorker = .{ .parser = undefined };
+                try worker.parser.init(p.allocator);
+                errdefer worker.parser.deinit(p.allocator);
+                try p.table_workers.append(p.allocator, worker);
+            }
+            const workers = p.table_workers.items[0..n_workers];
+            const per_worker = (rows + n_workers - 1) / n_workers;
+            var wg: std.Thread.WaitGroup = .{};
+            for (workers, 0..) |*w, wi| {
+                w.parser.options = p.options;
+                w.parser.options.table_threads = 0;
+                w.first_row = @min(wi * per_worker, rows);
+                w.end_row = @min(w.first_row + per_worker, rows);
+                w.out.clearRetainingCapacity();
+                w.err = null;
+                p.table_pool.?.spawnWg(&wg, TableWorker.run, .{ w, p });
+            }
+            p.table_pool.?.waitAndWork(&wg);
+            for (workers) |*w| {
+                if (w.err) |e| return e;
+                try p.writeAll(o, w.out.items);
+            }
+        }
+        fn parseDefinitionTerm(parser: *Self, line_content: []const u8, full_data: []const u8, current_pos: usize, output: anytype) !bool {
+            const _s = parser.startCall(.parseDefinitionTerm);
+            defer parser.endCall(.parseDefinitionTerm, _s);
+            if (current_pos < full_data.len) {
+                const check = full_data[current_pos..];
+                var k: usize = 0;
+                while (k < check.len and check[k] == ' ') : (k += 1) {}
+                if (k < check.len and check[k] == ':') {
+                    const block_type = parser.topT();
+                    if (block_type == .paragraph or block_type == .table or block_type == .code or block_type == .math) {
+                        try parser.renderTop(output);
+                    }
+                    if (parser.stack_depth == 0 or parser.topT() != .definition_list) {
+                        try parser.writeAll(output, "<dl>\n");
+                        try parser.pushBlock(.definition_list, 0);
                     }
+                    try parser.writeAll(output, "<dt>");
+                    try parser.parseInlineContent(line_content, output);
+                    try parser.writeAll(output, "</dt>\n");
+                    return true;
+                }
+            }
+            return false;
+        }
+        fn processParagraph(parser: *Self, line_content: []const u8, is_dl: bool, is_list: bool, output: anytype) !void {
+            const _s = parser.startCall(.processParagraph);
+            defer parser.endCall(.processParagraph, _s);
+            if (line_content.len == 0) {
+                try parser.closeP(output);
+                return;
+            }
+            const block_type = parser.topT();
+            const in_container = (parser.stack_depth > 0 and
+                (block_type != null and
+                    (@intFromEnum(block_type.?) < @intFromEnum(BlockType.blockquote) or block_type.? ==
+                        .definition_description)));
+            const list_loose = if (parser.active_list_stack_idx >= 0) parser.block_stack[@intCast(parser.active_list_stack_idx)].loose else false;
+            if (parser.topT() != .paragraph and (!in_container or list_loose)) {
+                try parser.pushBlock(.paragraph, 0);
+            } else if (parser.topT() == .paragraph or (in_container and !is_list and !is_dl and !list_loose)) {
+                try parser.paragraph_content.append(parser.allocator, '\n');
+            }
+            if (parser.pending_task_marker > 0) {
+                try parser.writeAll(output, if (parser.pending_task_marker == 2)
+                    "<input type=\"checkbox\" checked disabled> "
+                else
+                    "<input type=\"checkbox\" disabled> ");
+                parser.pending_task_marker = 0;
+            }
+            try parser.noteParagraphSource(line_content);
+            try parser.paragraph_content.appendSlice(parser.allocator, line_content);
+        }
+        fn inTopLevelParagraph(p: *const Self) bool {
+            return p.stack_depth == 1 and p.block_stack[0].block_type == .paragraph and
+                p.paragraph_content.items.len > 0 and p.pending_task_marker == 0;
+        }
+        /// Leading spaces of a line that can only continue a top-level paragraph, or null when the
+        /// line may be blank or start a block and has to go through `processSingleLine`.
+        fn paragraphContinuationIndent(line: []const u8) ?usize {
+            var lead: usize = 0;
+            if (line.len >= 4) {
+                const head: @Vector(4, u8) = line[0..4].*;
+                const spaces: u4 = @bitCast(head == @as(@Vector(4, u8), @splat(' ')));
+                lead = @ctz(~spaces);
+                if (lead == 4) return null;
+            } else {
+                while (lead < line.len and line[lead] == ' ') lead += 1;
+                if (lead == line.len) return null;
+            }
+            const c = line[lead];
+            if (c <= ' ' or block_start[c] != 0) return null;
+            return lead;
+        }
+        /// Append consecutive paragraph continuation lines starting at `start` in bulk. Returns the
+        /// position of the first line that needs the full `processSingleLine` machinery.
+        fn consumeParagraphRun(p: *Self, data: []const u8, start: usize) !usize {
+            const _s = p.startCall(.consumeParagraphRun);
+            defer p.endCall(.consumeParagraphRun, _s);
+            var pos = start;
+            var run_start = start;
+            var run_end = start;
+            while (std.mem.indexOfScalarPos(u8, data, pos, '\n')) |nl| {
+                const lead = paragraphContinuationIndent(data[pos..nl]) orelse break;
+                // A definition marker on the following line turns this line into a term.
+                var k = nl + 1;
+                while (k < data.len and data[k] == ' ') k += 1;
+                if (k >= data.len or (dialect.definition_lists and data[k] == ':')) break;
+                if (lead == 0 and run_end > run_start and run_end + 1 == pos) {
+                    run_end = nl;
+                } else {
+                    try p.appendParagraphRun(data[run_start..run_end]);
+                    run_start = pos + lead;
+                    run_end = nl;
                 }
+                pos = nl + 1;
+            }
+            try p.appendParagraphRun(data[run_start..run_end]);
+            return pos;
+        }
+        inline fn appendParagraphRun(p: *Self, run: []const u8) !void {
+            if (run.len == 0) return;
+            try p.paragraph_content.append(p.allocator, '\n');
+            try p.noteParagraphSource(run);
+            try p.paragraph_content.appendSlice(p.allocator, run);
+        }
+        /// Emit a wiki link. Its opening tag waits for the batched resolver, so only its place
+        /// is recorded, and top-level output is held from here on (see `wiki_output`).
+        fn writeWikiLink(p: *Self, link: WikiLinkMatch, o: anytype, depth: usize, plain: bool) !void {
+            if (!plain) {
+                p.doc_stats.links += @intFromBool(p.options.document_stats);
+                try p.markWikiLink(o, try p.wikiPage(link.target));
+            }
+            if (link.label) |label| {
+                const in_label = p.in_link_label;
+                p.in_link_label = true;
+                defer p.in_link_label = in_label;
+                try p.parseInlineContentScoped(label, o, depth + 1, plain);
+            } else {
+                try p.esc(link.target, o);
+                if (!plain) try p.visibleText(link.target, .link);
+            }
+            if (!plain) try p.writeAll(o, "</a>");
+        }
+        /// Index of the page for `target`, added with an owned target on first use.
+        fn wikiPage(p: *Self, target: []const u8) !u32 {
+            const gop = try p.wiki_page_index.getOrPut(p.allocator, target);
+            if (gop.found_existing) return gop.value_ptr.*;
+            const owned = p.allocator.dupe(u8, target) catch |e| {
+                p.wiki_page_index.removeByPtr(gop.key_ptr);
+                return e;
+            };
+            p.wiki_pages.append(p.allocator, .{ .target = owned }) catch |e| {
+                p.allocator.free(owned);
+                p.wiki_page_index.removeByPtr(gop.key_ptr);
+                return e;
+            };
+            gop.key_ptr.* = owned;
+            gop.value_ptr.* = @intCast(p.wiki_pages.items.len - 1);
+            return gop.value_ptr.*;
+        }
+        /// Record a pending opening tag for `page` at the current end of the buffer `o` writes
+        /// to: a list buffer, a sink that carries marks, or the held top-level output.
+        fn markWikiLink(p: *Self, o: anytype, page: u32) !void {
+            if (p.currentListBuffer()) |lb| {
+                try lb.wiki_marks.append(p.allocator, .{ .offset = lb.bytes.items.len, .page = page });
+            } else if (@TypeOf(o) == BufferSink) {
+                // Memoized blocks and worker rows are never rendered with wiki links enabled.
+                try o.wiki_marks.?.append(p.allocator, .{ .offset = o.list.items.len, .page = page });
+            } else {
+                p.wiki_holding = true;
+                try p.wiki_marks.append(p.allocator, .{ .offset = p.wiki_output.items.len, .page = page });
+            }
+        }
+        /// Write `buf[start..end]`, re-recording the marks of `buf` that fall in it for the new
+        /// destination. `marks` is consumed from the front, so successive slices must not go back.
+        fn writeMarked(p: *Self, o: anytype, buf: []const u8, start: usize, end: usize, marks: *[]const WikiMark) !void {
+            var i = start;
+            while (marks.len > 0 and marks.*[0].offset < end) {
+                const at = @max(marks.*[0].offset, i);
+                try p.writeAll(o, buf[i..at]);
+                try p.markWikiLink(o, marks.*[0].page);
+                marks.* = marks.*[1..];
+                i = at;
+            }
+            try p.writeAll(o, buf[i..end]);
+        }
+        fn holdOutput(p: *Self, writer: anytype, bytes: []const u8) !void {
+            try p.wiki_output.appendSlice(p.allocator, bytes);
+            if (p.wiki_output.items.len >= p.options.wiki_batch_bytes) {
+                try p.flushWikiOutput(writer);
+                p.wiki_holding = true;
             }
-            if (remainder.len >= 3 and remainder[0] == '[' and
-                (remainder[1] == ' ' or remainder[1] == 'x' or remainder[1] == 'X') and remainder[2] == ']')
-            {
-                if (remainder.len == 3 or remainder[3] == ' ' or remainder[3] == '\t') {
-                    parser.pending_task_marker = if (remainder[1] == ' ') @as(u8, 1) else @as(u8, 2);
-                    remainder = remainder[3..];
-                    if (remainder.len > 0 and (remainder[0] == ' ' or remainder[0] == '\t')) {
-                        remainder = remainder[1..];
-                        item_content_indent += 4;
-                        leading_spaces.* += 4;
-                    } else {
-                        item_content_indent += 3;
-                        leading_spaces.* += 3;
+        }
+        /// Resolve the pages first linked since the previous flush in one resolver call, then
+        /// write the held output with each link's opening tag spliced in at its mark.
+        fn flushWikiOutput(p: *Self, writer: anytype) !void {
+            const pending = p.wiki_pages.items[p.wiki_resolved..];
+            p.wiki_resolved = p.wiki_pages.items.len;
+            if (pending.len > 0) {
+                if (p.options.wiki_resolver) |resolver| {
+                    try resolver.resolve(resolver.context, pending);
+                    for (pending) |*page| {
+                        const href = page.href orelse continue;
+                        page.href = null;
+                        page.href = try p.allocator.dupe(u8, href);
                     }
                 }
             }
-            parser.block_stack[parser.stack_depth - 1].content_indent = @intCast(item_content_indent);
-            const rem_trim = std.mem.trim(u8, remainder, " \t");
-            const empty_item = rem_trim.len == 0 and parser.pending_task_marker == 0;
-            parser.block_stack[parser.stack_depth - 1].pending_empty_item = empty_item;
-            line_content.* = remainder;
+            p.wiki_holding = false;
+            const held = p.wiki_output.items;
+            var i: usize = 0;
+            for (p.wiki_marks.items) |m| {
+                try p.writeAll(writer, held[i..m.offset]);
+                const page = p.wiki_pages.items[m.page];
+                try p.writeAll(writer, "<a href=\"");
+                try p.writeLinkUrl(page.href orelse page.target, writer);
+                try p.writeAll(writer, if (page.exists) "\" class=\"wiki\">" else "\" class=\"wiki new\">");
+                i = m.offset;
+            }
+            try p.writeAll(writer, held[i..]);
+            p.wiki_output.clearRetainingCapacity();
+            p.wiki_marks.clearRetainingCapacity();
+        }
+        /// Map entry for a footnote label, created with an owned lowercase key on first use.
+        fn footnoteEntry(p: *Self, label: []const u8) !std.StringHashMapUnmanaged(Footnote).GetOrPutResult {
+            var buf: [MAX_FOOTNOTE_LABEL]u8 = undefined;
+            const key = std.ascii.lowerString(&buf, label);
+            const gop = try p.footnotes.getOrPut(p.allocator, key);
+            if (!gop.found_existing) {
+                gop.key_ptr.* = p.allocator.dupe(u8, key) catch |e| {
+                    p.footnotes.removeByPtr(gop.key_ptr);
+                    return e;
+                };
+                gop.value_ptr.* = .{};
+            }
+            return gop;
+        }
+        /// Emit a numbered footnote reference; numbers follow first use, so they are final here.
+        fn writeFootnoteRef(p: *Self, label: []const u8, o: anytype, plain: bool) !void {
+            const gop = try p.footnoteEntry(label);
+            const first = gop.value_ptr.number == 0;
+            if (first) {
+                try p.footnote_order.append(p.allocator, gop.key_ptr.*);
+                gop.value_ptr.number = p.footnote_order.items.len;
+            }
+            var num_buf: [20]u8 = undefined;
+            const num = std.fmt.bufPrint(&num_buf, "{d}", .{gop.value_ptr.number}) catch unreachable;
+            if (plain) return p.writeAll(o, num);
+            try p.writeAll(o, "<sup class=\"footnote-ref\"><a href=\"#fn-");
+            try p.writeAll(o, num);
+            if (first) {
+                try p.writeAll(o, "\" id=\"fnref-");
+                try p.writeAll(o, num);
+            }
+            try p.writeAll(o, "\">");
+            try p.writeAll(o, num);
+            try p.writeAll(o, "</a></sup>");
+        }
+        /// Open a top-level `[^label]: text` definition. Its body is collected line by line and
+        /// rendered into `footnote_bodies` when it ends. A later definition of the same label is
+        /// consumed without being rendered, so the first one wins.
+        fn startFootnoteDefinition(p: *Self, lc: []const u8, ls: usize) !bool {
+            if (ls > 3 or p.stack_depth != 0 or p.blockquote_depth != 0) return false;
+            const m = parseFootnoteMarker(lc, 0) orelse return false;
+            if (m.end >= lc.len or lc[m.end] != ':') return false;
+            const gop = try p.footnoteEntry(m.label);
+            p.footnote_duplicate = gop.value_ptr.defined;
+            gop.value_ptr.defined = true;
+            p.footnote_open = gop.key_ptr.*;
+            p.footnote_blank = false;
+            p.footnote_body_start = p.footnote_bodies.items.len;
+            p.footnote_marks_start = p.footnote_wiki_marks.items.len;
+            p.footnote_text.clearRetainingCapacity();
+            try p.footnote_text.appendSlice(p.allocator, std.mem.trimLeft(u8, lc[m.end + 1 ..], " \t"));
             return true;
         }
-        return false;
-    }
-    fn parseTable(parser: *OctomarkParser, line_content: []const u8, full_data: []const u8, current_pos: usize, output: anytype) !bool {
-        const _s = parser.startCall(.parseTable);
-        defer parser.endCall(.parseTable, _s); // 1. If we are already IN a table, process body rows strictly.
-        if (parser.topT() == .table) {
-            const trimmed_line = std.mem.trim(u8, line_content, &std.ascii.whitespace);
-            // Quick pipe check for body row
-            const has_pipe = std.mem.indexOfScalar(u8, trimmed_line, '|') != null;
-            if (has_pipe) {
-                var body_cells: [64][]const u8 = undefined;
-                const body_count = parser.splitTableRowCells(line_content, &body_cells);
-                try parser.writeAll(output, "<tr>");
-                var k: usize = 0;
-                while (k < body_count) : (k += 1) {
-                    try parser.writeAll(output, "<td");
-                    writeTableAlignment(parser, output, if (k < parser.table_column_count) parser.table_alignments[k] else .none) catch {};
-                    try parser.writeAll(output, ">");
-                    try parser.parseInlineContent(body_cells[k], output);
-                    try parser.writeAll(output, "</td>");
-                }
-                try parser.writeAll(output, "</tr>\n");
+        /// Route `line` into the open definition: indented lines, and lazy lines before any blank
+        /// line. Returns false after closing the definition, so the line is parsed normally.
+        fn continueFootnote(p: *Self, line: []const u8) !bool {
+            const id = leadingIndent(line);
+            const rest = line[id.idx..];
+            if (rest.len == 0) {
+                p.footnote_blank = true;
+                return true;
+            }
+            if (id.columns >= 4) {
+                if (p.footnote_blank) try p.flushFootnoteParagraph(false) else try p.footnote_text.append(p.allocator, '\n');
+                try p.footnote_text.appendSlice(p.allocator, stripIndentColumns(line, 4));
+                p.footnote_blank = false;
+                return true;
+            }
+            if (!p.footnote_blank and !p.isBSM(rest, id.columns) and parseFootnoteMarker(rest, 0) == null) {
+                try p.footnote_text.append(p.allocator, '\n');
+                try p.footnote_text.appendSlice(p.allocator, rest);
                 return true;
-            } else { // No pipe = end of table
-                try parser.renderTop(output); // Continue to process this line as something else (return false)
-                return false;
-            }
-        }
-        if (current_pos >= full_data.len) return false;
-        if (std.mem.indexOfScalar(u8, line_content, '|') == null) return false;
-        if (!parser.isNextLineTableSeparator(full_data, current_pos)) return false;
-        const sep_line_end = if (std.mem.indexOfScalar(u8, full_data[current_pos..], '\n')) |nl|
-            current_pos + nl
-        else
-            full_data.len;
-        const sep_line = full_data[current_pos..sep_line_end];
-        var header_cells: [64][]const u8 = undefined;
-        const header_count = parser.splitTableRowCells(line_content, &header_cells);
-        var sep_cells: [64][]const u8 = undefined;
-        const sep_count = parser.splitTableRowCells(sep_line, &sep_cells);
-        parser.table_column_count = header_count;
-        var k: usize = 0;
-        while (k < header_count) : (k += 1) {
-            var col_align = TableAlignment.none;
-            if (k < sep_count) {
-                const cell = sep_cells[k];
-                if (cell.len > 0) {
-                    const left = cell[0] == ':';
-                    const right = cell[cell.len - 1] == ':';
-                    col_align = if (left and right) TableAlignment.center else if (left) TableAlignment.left else if (right) TableAlignment.right else TableAlignment.none;
-                }
             }
-            parser.table_alignments[k] = col_align;
+            try p.closeFootnote();
+            return false;
         }
-        try parser.tryCloseLeaf(output);
-        try parser.writeAll(output, "<table><thead><tr>");
-        k = 0;
-        while (k < header_count) : (k += 1) {
-            try parser.writeAll(output, "<th");
-            writeTableAlignment(parser, output, parser.table_alignments[k]) catch {};
-            try parser.writeAll(output, ">");
-            try parser.parseInlineContent(header_cells[k], output);
-            try parser.writeAll(output, "</th>");
+        /// Render the collected paragraph into `footnote_bodies`. The last paragraph stays open for
+        /// the back reference added by `writeFootnotes`.
+        fn flushFootnoteParagraph(p: *Self, last: bool) !void {
+            const text = std.mem.trim(u8, p.footnote_text.items, " \t\n");
+            if (!p.footnote_duplicate and (text.len > 0 or last)) {
+                const sink = BufferSink{ .list = &p.footnote_bodies, .allocator = p.allocator, .wiki_marks = &p.footnote_wiki_marks };
+                try p.writeAll(sink, "<p>");
+                try p.parseInlineContent(text, sink);
+                if (!last) try p.writeAll(sink, "</p>\n");
+            }
+            p.footnote_text.clearRetainingCapacity();
         }
-        try parser.writeAll(output, "</tr></thead><tbody>\n");
-        try parser.pushBlock(.table, 0);
-        return true;
-    }
-    fn parseDefinitionTerm(parser: *OctomarkParser, line_content: []const u8, full_data: []const u8, current_pos: usize, output: anytype) !bool {
-        const _s = parser.startCall(.parseDefinitionTerm);
-        defer parser.endCall(.parseDefinitionTerm, _s);
-        if (current_pos < full_data.len) {
-            const check = full_data[current_pos..];
-            var k: usize = 0;
-            while (k < check.len and check[k] == ' ') : (k += 1) {}
-            if (k < check.len and check[k] == ':') {
-                const block_type = parser.topT();
-                if (block_type == .paragraph or block_type == .table or block_type == .code or block_type == .math) {
-                    try parser.renderTop(output);
-                }
-                if (parser.stack_depth == 0 or parser.topT() != .definition_list) {
-                    try parser.writeAll(output, "<dl>\n");
-                    try parser.pushBlock(.definition_list, 0);
+        fn closeFootnote(p: *Self) !void {
+            const key = p.footnote_open orelse return;
+            try p.flushFootnoteParagraph(true);
+            p.footnote_open = null;
+            if (p.footnote_duplicate) return;
+            const f = p.footnotes.getPtr(key).?;
+            f.body_start = p.footnote_body_start;
+            f.body_end = p.footnote_bodies.items.len;
+            f.marks_start = p.footnote_marks_start;
+            f.marks_end = p.footnote_wiki_marks.items.len;
+        }
+        /// List the defined footnotes in reference order. A label referenced but never defined
+        /// still took a number when its reference was streamed out, so the item after the gap
+        /// carries `value` to keep the list numbers equal to the reference numbers.
+        fn writeFootnotes(p: *Self, o: anytype) !void {
+            var listed: usize = 0;
+            for (p.footnote_order.items, 1..) |key, n| {
+                const f = p.footnotes.get(key).?;
+                if (!f.defined) continue;
+                if (listed == 0) try p.writeAll(o, "<section class=\"footnotes\">\n<ol>\n");
+                var num_buf: [20]u8 = undefined;
+                const num = std.fmt.bufPrint(&num_buf, "{d}", .{n}) catch unreachable;
+                try p.writeAll(o, "<li id=\"fn-");
+                try p.writeAll(o, num);
+                if (n != listed + 1) {
+                    try p.writeAll(o, "\" value=\"");
+                    try p.writeAll(o, num);
                 }
-                try parser.writeAll(output, "<dt>");
-                try parser.parseInlineContent(line_content, output);
-                try parser.writeAll(output, "</dt>\n");
-                return true;
+                try p.writeAll(o, "\">\n");
+                listed = n;
+                var marks: []const WikiMark = p.footnote_wiki_marks.items[f.marks_start..f.marks_end];
+                try p.writeMarked(o, p.footnote_bodies.items, f.body_start, f.body_end, &marks);
+                try p.writeAll(o, " <a href=\"#fnref-");
+                try p.writeAll(o, num);
+                try p.writeAll(o, "\" class=\"footnote-backref\">\u{21A9}</a></p>\n</li>\n");
             }
+            if (listed > 0) try p.writeAll(o, "</ol>\n</section>\n");
         }
-        return false;
-    }
-    fn processParagraph(parser: *OctomarkParser, line_content: []const u8, is_dl: bool, is_list: bool, output: anytype) !void {
-        const _s = parser.startCall(.processParagraph);
-        defer parser.endCall(.processParagraph, _s);
-        if (line_content.len == 0) {
-            try parser.closeP(output);
-            return;
-        }
-        const block_type = parser.topT();
-        const in_container = (parser.stack_depth > 0 and
-            (block_type != null and
-                (@intFromEnum(block_type.?) < @intFromEnum(BlockType.blockquote) or block_type.? ==
-                    .definition_description)));
-        const list_loose = if (parser.active_list_stack_idx >= 0) parser.block_stack[@intCast(parser.active_list_stack_idx)].loose else false;
-        if (parser.topT() != .paragraph and (!in_container or list_loose)) {
-            try parser.pushBlock(.paragraph, 0);
-        } else if (parser.topT() == .paragraph or (in_container and !is_list and !is_dl and !list_loose)) {
-            try parser.paragraph_content.append(parser.allocator, '\n');
-        }
-        if (parser.pending_task_marker > 0) {
-            try parser.writeAll(output, if (parser.pending_task_marker == 2)
-                "<input type=\"checkbox\" checked disabled> "
-            else
-                "<input type=\"checkbox\" disabled> ");
-            parser.pending_task_marker = 0;
-        }
-        try parser.paragraph_content.appendSlice(parser.allocator, line_content);
-    }
-    fn isBSM(p: *OctomarkParser, s: []const u8, ls: usize) bool {
-        const _s = p.startCall(.isBlockStartMarker);
-        defer p.endCall(.isBlockStartMarker, _s);
-        if (ls > 3 or s.len == 0) return false;
-        return switch (s[0]) {
-            '`' => s.len >= 3 and std.mem.startsWith(u8, s, "```"),
-            '$' => s.len >= 2 and std.mem.startsWith(u8, s, "$$"),
-            '#', ':', '<', '|' => true,
-            '-', '*', '_' => isThematicBreakLine(s) or s.len == 1 or (s.len >= 2 and (s[1] == ' ' or s[1] == '\t')),
-            '0'...'9' => blk: {
-                var j: usize = 1;
-                while (j < s.len and std.ascii.isDigit(s[j])) : (j += 1) {}
-                if (j < s.len and (s[j] == '.' or s[j] == ')') and
-                    (j + 1 == s.len or (j + 1 < s.len and (s[j + 1] == ' ' or s[j + 1] == '\t'))))
-                {
-                    if (p.topT() == .paragraph) {
-                        const start_num = std.fmt.parseInt(u32, s[0..j], 10) catch 1;
-                        if (start_num != 1) break :blk false;
+        fn isBSM(p: *Self, s: []const u8, ls: usize) bool {
+            const _s = p.startCall(.isBlockStartMarker);
+            defer p.endCall(.isBlockStartMarker, _s);
+            if (ls > 3 or s.len == 0) return false;
+            return switch (s[0]) {
+                '`' => s.len >= 3 and std.mem.startsWith(u8, s, "```"),
+                '$' => dialect.math and s.len >= 2 and std.mem.startsWith(u8, s, "$$"),
+                '#' => true,
+                ':' => dialect.definition_lists,
+                '<' => dialect.html,
+                '|' => dialect.tables,
+                '-', '*', '_' => isThematicBreakLine(s) or s.len == 1 or (s.len >= 2 and (s[1] == ' ' or s[1] == '\t')),
+                '0'...'9' => blk: {
+                    var j: usize = 1;
+                    while (j < s.len and std.ascii.isDigit(s[j])) : (j += 1) {}
+                    if (j < s.len and (s[j] == '.' or s[j] == ')') and
+                        (j + 1 == s.len or (j + 1 < s.len and (s[j + 1] == ' ' or s[j + 1] == '\t'))))
+                    {
+                        if (p.topT() == .paragraph) {
+                            const start_num = std.fmt.parseInt(u32, s[0..j], 10) catch 1;
+                            if (start_num != 1) break :blk false;
+                        }
+                        break :blk true;
                     }
-                    break :blk true;
-                }
-                break :blk false;
-            },
-            else => false,
-        };
-    }
-    const BlockquoteScan = struct {
-        depth: usize,
-        extra_indent: usize,
-        rest: []const u8,
-    };
-    fn scanBlockquotePrefix(line: []const u8, base_cols: usize) BlockquoteScan {
-        var lc = line;
-        var q_lv: usize = 0;
-        var ex_id: usize = 0;
-        var i: usize = 0;
-        var col: usize = base_cols;
-        while (i < lc.len) {
-            const start_i = i;
-            while (i < lc.len) : (i += 1) switch (lc[i]) {
-                ' ' => col += 1,
-                '\t' => col += 4 - (col % 4),
-                else => break,
+                    break :blk false;
+                },
+                else => false,
             };
-            if (col > 3) {
-                i = start_i;
-                break;
-            }
-            if (i < lc.len and lc[i] == '>') {
-                q_lv += 1;
-                i += 1;
-                col += 1;
-                if (i < lc.len) switch (lc[i]) {
-                    ' ' => {
-                        i += 1;
-                        col += 1;
-                    },
-                    '\t' => {
-                        const tw = 4 - (col % 4);
-                        i += 1;
-                        col += tw;
-                        if (tw > 0) ex_id += tw - 1;
-                    },
-                    else => {},
+        }
+        const BlockquoteScan = struct {
+            depth: usize,
+            extra_indent: usize,
+            rest: []const u8,
+        };
+        fn scanBlockquotePrefix(line: []const u8, base_cols: usize) BlockquoteScan {
+            var lc = line;
+            var q_lv: usize = 0;
+            var ex_id: usize = 0;
+            var i: usize = 0;
+            var col: usize = base_cols;
+            while (i < lc.len) {
+                const start_i = i;
+                while (i < lc.len) : (i += 1) switch (lc[i]) {
+                    ' ' => col += 1,
+                    '\t' => col += 4 - (col % 4),
+                    else => break,
                 };
-                lc = lc[i..];
-                i = 0;
-                col = 0;
-            } else {
-                i = start_i;
-                break;
+                if (col > 3) {
+                    i = start_i;
+                    break;
+                }
+                if (i < lc.len and lc[i] == '>') {
+                    q_lv += 1;
+                    i += 1;
+                    col += 1;
+                    if (i < lc.len) switch (lc[i]) {
+                        ' ' => {
+                            i += 1;
+                            col += 1;
+                        },
+                        '\t' => {
+                            const tw = 4 - (col % 4);
+                            i += 1;
+                            col += tw;
+                            if (tw > 0) ex_id += tw - 1;
+                        },
+                        else => {},
+                    };
+                    lc = lc[i..];
+                    i = 0;
+                    col = 0;
+                } else {
+                    i = start_i;
+                    break;
+                }
             }
+            return .{ .depth = q_lv, .extra_indent = ex_id, .rest = lc };
         }
-        return .{ .depth = q_lv, .extra_indent = ex_id, .rest = lc };
-    }
-    fn adjustIndentForBlockquote(p: *OctomarkParser, ls: usize, q_lv: usize, cur_q: usize) usize {
-        if (q_lv == 0) return ls;
-        var remove: usize = 0;
-        if (cur_q > 0) {
-            remove = if (ls > 3) 3 else ls;
-        } else {
-            const list_content_indent: ?usize = if (p.active_list_stack_idx >= 0)
-                @intCast(p.block_stack[@intCast(p.active_list_stack_idx)].content_indent)
-            else
-                null;
-            if (list_content_indent) |lci| {
-                if (ls >= lci) {
-                    const extra = ls - lci;
-                    if (extra > 0) remove = if (extra > 3) 3 else extra;
+        fn adjustIndentForBlockquote(p: *Self, ls: usize, q_lv: usize, cur_q: usize) usize {
+            if (q_lv == 0) return ls;
+            var remove: usize = 0;
+            if (cur_q > 0) {
+                remove = if (ls > 3) 3 else ls;
+            } else {
+                const list_content_indent: ?usize = if (p.active_list_stack_idx >= 0)
+                    @intCast(p.block_stack[@intCast(p.active_list_stack_idx)].content_indent)
+                else
+                    null;
+                if (list_content_indent) |lci| {
+                    if (ls >= lci) {
+                        const extra = ls - lci;
+                        if (extra > 0) remove = if (extra > 3) 3 else extra;
+                    } else {
+                        remove = if (ls > 3) 3 else ls;
+                    }
                 } else {
                     remove = if (ls > 3) 3 else ls;
                 }
-            } else {
-                remove = if (ls > 3) 3 else ls;
             }
+            return if (remove > 0) ls - remove else ls;
         }
-        return if (remove > 0) ls - remove else ls;
-    }
-    fn trySetextHeader(p: *OctomarkParser, lc: []const u8, parse_ls: usize, list_idx: ?usize, lazy: bool, o: anytype) !bool {
-        if (lazy or parse_ls > 3) return false;
-        if (p.topT() != .paragraph and (list_idx == null or p.paragraph_content.items.len == 0)) return false;
-        var st: usize = 0;
-        while (st < lc.len and (lc[st] == ' ' or lc[st] == '\t')) st += 1;
-        var en = lc.len;
-        while (en > st and (lc[en - 1] == ' ' or lc[en - 1] == '\t')) en -= 1;
-        if (st >= en or (lc[st] != '=' and lc[st] != '-')) return false;
-        var i = st;
-        while (i < en) : (i += 1) if (lc[i] != lc[st]) break;
-        if (i != en) return false;
-        const tr = std.mem.trim(u8, p.paragraph_content.items, " \t\n");
-        if (tr.len == 0) return false;
-        p.paragraph_content.clearRetainingCapacity();
-        if (p.topT() == .paragraph) p.pop();
-        const lv: u8 = if (lc[st] == '=') '1' else '2';
-        try p.writeAll(o, "<h");
-        try p.writeByte(o, lv);
-        try p.writeAll(o, ">");
-        try p.parseInlineContent(tr, o);
-        try p.writeAll(o, "</h");
-        try p.writeByte(o, lv);
-        try p.writeAll(o, ">\n");
-        return true;
-    }
-    fn tryOpenBlockquoteFromLine(p: *OctomarkParser, lc: []const u8, ls: usize, o: anytype) !?[]const u8 {
-        var q_lc = lc;
-        var q_ls = ls;
-        if (p.stack_depth > 0) {
-            const l_idx: ?usize = if (p.active_list_stack_idx >= 0) @intCast(p.active_list_stack_idx) else null;
-            if (l_idx) |idx| {
-                const li: usize = @intCast(p.block_stack[idx].content_indent);
-                if (ls >= li) {
-                    q_lc = stripIndentColumns(lc, li);
-                    q_ls = ls - li;
-                }
-            }
+        fn trySetextHeader(p: *Self, lc: []const u8, parse_ls: usize, list_idx: ?usize, lazy: bool, o: anytype) !bool {
+            if (lazy or parse_ls > 3) return false;
+            if (p.topT() != .paragraph and (list_idx == null or p.paragraph_content.items.len == 0)) return false;
+            var st: usize = 0;
+            while (st < lc.len and (lc[st] == ' ' or lc[st] == '\t')) st += 1;
+            var en = lc.len;
+            while (en > st and (lc[en - 1] == ' ' or lc[en - 1] == '\t')) en -= 1;
+            if (st >= en or (lc[st] != '=' and lc[st] != '-')) return false;
+            var i = st;
+            while (i < en) : (i += 1) if (lc[i] != lc[st]) break;
+            if (i != en) return false;
+            const tr = std.mem.trim(u8, p.paragraph_content.items, " \t\n");
+            if (tr.len == 0) return false;
+            p.paragraph_content.clearRetainingCapacity();
+            if (p.topT() == .paragraph) p.pop();
+            const lv: u8 = if (lc[st] == '=') '1' else '2';
+            try p.writeAll(o, "<h");
+            try p.writeByte(o, lv);
+            try p.writeAll(o, ">");
+            p.token_field = .heading;
+            defer p.token_field = .body;
+            try p.parseInlineContent(tr, o);
+            try p.writeAll(o, "</h");
+            try p.writeByte(o, lv);
+            try p.writeAll(o, ">\n");
+            return true;
         }
-        if (q_ls <= 3) {
-            var q_c: usize = 0;
-            var l_c = q_lc;
-            while (true) {
-                var k: usize = 0;
-                while (k < l_c.len and (l_c[k] == ' ' or l_c[k] == '\t')) k += 1;
-                if (k < l_c.len and l_c[k] == '>') {
-                    q_c += 1;
-                    k += 1;
-                    if (k < l_c.len and (l_c[k] == ' ' or l_c[k] == '\t')) k += 1;
-                    l_c = l_c[k..];
-                } else break;
+        fn tryOpenBlockquoteFromLine(p: *Self, lc: []const u8, ls: usize, o: anytype) !?[]const u8 {
+            var q_lc = lc;
+            var q_ls = ls;
+            if (p.stack_depth > 0) {
+                const l_idx: ?usize = if (p.active_list_stack_idx >= 0) @intCast(p.active_list_stack_idx) else null;
+                if (l_idx) |idx| {
+                    const li: usize = @intCast(p.block_stack[idx].content_indent);
+                    if (ls >= li) {
+                        q_lc = stripIndentColumns(lc, li);
+                        q_ls = ls - li;
+                    }
+                }
             }
-            if (q_c > 0) {
-                try p.closeP(o);
-                var k: usize = 0;
-                while (k < q_c) : (k += 1) {
-                    try p.writeAll(o, "<blockquote>");
-                    try p.pushBlock(.blockquote, 0);
+            if (q_ls <= 3) {
+                var q_c: usize = 0;
+                var l_c = q_lc;
+                while (true) {
+                    var k: usize = 0;
+                    while (k < l_c.len and (l_c[k] == ' ' or l_c[k] == '\t')) k += 1;
+                    if (k < l_c.len and l_c[k] == '>') {
+                        q_c += 1;
+                        k += 1;
+                        if (k < l_c.len and (l_c[k] == ' ' or l_c[k] == '\t')) k += 1;
+                        l_c = l_c[k..];
+                    } else break;
+                }
+                if (q_c > 0) {
+                    try p.closeP(o);
+                    var k: usize = 0;
+                    while (k < q_c) : (k += 1) {
+                        try p.writeAll(o, "<blockquote>");
+                        try p.pushBlock(.blockquote, 0);
+                    }
+                    return l_c;
                 }
-                return l_c;
             }
+            return null;
         }
-        return null;
-    }
-    fn tryStartHtmlBlock(p: *OctomarkParser, lc: []const u8, html_ls: usize, o: anytype) !bool {
-        if (lc.len < 3 or html_ls > 3) return false;
-        var h_t: u8 = 0;
-        if (lc.len >= 4 and lc[1] == '!') {
-            if (std.mem.startsWith(u8, lc, "<!--")) h_t = 2 else if (std.mem.startsWith(u8, lc, "<![CDATA[")) h_t = 5 else h_t = 4;
-        } else if (lc.len >= 2 and lc[1] == '?') {
-            h_t = 3;
-        } else {
-            const is_close = lc.len >= 2 and lc[1] == '/';
-            const tr = if (is_close) lc[2..] else lc[1..];
-            const t1 = [_][]const u8{ "script", "pre", "style", "textarea" };
-            if (!is_close) for (t1) |t| if (std.mem.startsWith(u8, tr, t)) {
-                if (tr.len == t.len or !std.ascii.isAlphanumeric(tr[t.len])) {
-                    h_t = 1;
-                    break;
-                }
-            };
-            if (h_t == 0) {
-                const t6 = [_][]const u8{
-                    "address",  "article",  "aside",    "base",       "basefont", "blockquote", "body",   "caption",
-                    "center",   "col",      "colgroup", "dd",         "details",  "dialog",     "dir",    "div",
-                    "dl",       "dt",       "fieldset", "figcaption", "figure",   "footer",     "form",   "frame",
-                    "frameset", "h1",       "h2",       "h3",         "h4",       "h5",         "h6",     "head",
-                    "header",   "hr",       "html",     "iframe",     "legend",   "li",         "link",   "main",
-                    "menu",     "menuitem", "nav",      "noframes",   "ol",       "optgroup",   "option", "p",
-                    "param",    "section",  "source",   "summary",    "table",    "tbody",      "td",     "textarea",
-                    "tfoot",    "th",       "thead",    "title",      "tr",       "ul",
-                };
-                for (t6) |t| if (std.mem.startsWith(u8, tr, t)) {
+        fn tryStartHtmlBlock(p: *Self, lc: []const u8, html_ls: usize, o: anytype) !bool {
+            if (lc.len < 3 or html_ls > 3) return false;
+            var h_t: u8 = 0;
+            if (lc.len >= 4 and lc[1] == '!') {
+                if (std.mem.startsWith(u8, lc, "<!--")) h_t = 2 else if (std.mem.startsWith(u8, lc, "<![CDATA[")) h_t = 5 else h_t = 4;
+            } else if (lc.len >= 2 and lc[1] == '?') {
+                h_t = 3;
+            } else {
+                const is_close = lc.len >= 2 and lc[1] == '/';
+                const tr = if (is_close) lc[2..] else lc[1..];
+                const t1 = [_][]const u8{ "script", "pre", "style", "textarea" };
+                if (!is_close) for (t1) |t| if (std.mem.startsWith(u8, tr, t)) {
                     if (tr.len == t.len or !std.ascii.isAlphanumeric(tr[t.len])) {
-                        h_t = 6;
+                        h_t = 1;
                         break;
                     }
                 };
+                if (h_t == 0) {
+                    const t6 = [_][]const u8{
+                        "address",  "article",  "aside",    "base",       "basefont", "blockquote", "body",   "caption",
+                        "center",   "col",      "colgroup", "dd",         "details",  "dialog",     "dir",    "div",
+                        "dl",       "dt",       "fieldset", "figcaption", "figure",   "footer",     "form",   "frame",
+                        "frameset", "h1",       "h2",       "h3",         "h4",       "h5",         "h6",     "head",
+                        "header",   "hr",       "html",     "iframe",     "legend",   "li",         "link",   "main",
+                        "menu",     "menuitem", "nav",      "noframes",   "ol",       "optgroup",   "option", "p",
+                        "param",    "section",  "source",   "summary",    "table",    "tbody",      "td",     "textarea",
+                        "tfoot",    "th",       "thead",    "title",      "tr",       "ul",
+                    };
+                    for (t6) |t| if (std.mem.startsWith(u8, tr, t)) {
+                        if (tr.len == t.len or !std.ascii.isAlphanumeric(tr[t.len])) {
+                            h_t = 6;
+                            break;
+                        }
+                    };
+                }
+                if (h_t == 0 and p.topT() != .paragraph) {
+                    const l = p.parseHtmlTag(lc);
+                    if (l > 0) {
+                        var rem = lc[l..];
+                        while (rem.len > 0 and (rem[0] == ' ' or rem[0] == '\t')) rem = rem[1..];
+                        if (rem.len == 0) h_t = 7;
+                    }
+                }
             }
-            if (h_t == 0 and p.topT() != .paragraph) {
-                const l = p.parseHtmlTag(lc);
-                if (l > 0) {
-                    var rem = lc[l..];
-                    while (rem.len > 0 and (rem[0] == ' ' or rem[0] == '\t')) rem = rem[1..];
-                    if (rem.len == 0) h_t = 7;
-                }
-            }
-        }
-        if (h_t == 0) return false;
-        try p.tryCloseLeaf(o);
-        try p.pushBlockExtra(.html_block, 0, h_t);
-        var pad: usize = 0;
-        while (pad < html_ls) : (pad += 1) try p.writeByte(o, ' ');
-        try p.writeAll(o, lc);
-        try p.writeByte(o, '\n');
-        var term = false;
-        if (h_t == 1) {
-            const tags = [_][]const u8{ "</script>", "</pre>", "</style>", "</textarea>" };
-            var i: usize = 0;
-            while (i < lc.len) : (i += 1) {
-                if (lc[i] == '<' and i + 1 < lc.len and lc[i + 1] == '/') {
-                    for (tags) |tag| {
-                        if (i + tag.len <= lc.len) {
-                            if (std.ascii.eqlIgnoreCase(lc[i .. i + tag.len], tag)) {
-                                term = true;
-                                break;
+            if (h_t == 0) return false;
+            try p.tryCloseLeaf(o);
+            try p.pushBlockExtra(.html_block, 0, h_t);
+            var pad: usize = 0;
+            while (pad < html_ls) : (pad += 1) try p.writeByte(o, ' ');
+            try p.writeRawHtml(lc, o);
+            try p.writeByte(o, '\n');
+            var term = false;
+            if (h_t == 1) {
+                const tags = [_][]const u8{ "</script>", "</pre>", "</style>", "</textarea>" };
+                var i: usize = 0;
+                while (i < lc.len) : (i += 1) {
+                    if (lc[i] == '<' and i + 1 < lc.len and lc[i + 1] == '/') {
+                        for (tags) |tag| {
+                            if (i + tag.len <= lc.len) {
+                                if (std.ascii.eqlIgnoreCase(lc[i .. i + tag.len], tag)) {
+                                    term = true;
+                                    break;
+                                }
                             }
                         }
                     }
+                    if (term) break;
                 }
-                if (term) break;
+            } else if (h_t == 2) {
+                if (std.mem.indexOf(u8, lc, "-->") != null) term = true;
+            } else if (h_t == 3) {
+                if (std.mem.indexOf(u8, lc, "?>") != null) term = true;
+            } else if (h_t == 4) {
+                if (std.mem.indexOf(u8, lc, ">") != null) term = true;
+            } else if (h_t == 5) {
+                if (std.mem.indexOf(u8, lc, "]]>") != null) term = true;
             }
-        } else if (h_t == 2) {
-            if (std.mem.indexOf(u8, lc, "-->") != null) term = true;
-        } else if (h_t == 3) {
-            if (std.mem.indexOf(u8, lc, "?>") != null) term = true;
-        } else if (h_t == 4) {
-            if (std.mem.indexOf(u8, lc, ">") != null) term = true;
-        } else if (h_t == 5) {
-            if (std.mem.indexOf(u8, lc, "]]>") != null) term = true;
+            if (term) try p.renderTop(o);
+            return true;
         }
-        if (term) try p.renderTop(o);
-        return true;
-    }
-    const ListParseResult = struct {
-        is_dl: bool,
-        is_list: bool,
-    };
-    const ListContext = struct {
-        idx: ?usize,
-        content_indent: usize,
-        indent: usize,
-        lazy: bool,
-        parse_ls: usize,
-        html_ls: usize,
-        force_close_empty: bool,
-    };
-    fn syncBlockquoteDepth(p: *OctomarkParser, q_lv: usize, o: anytype) !void {
-        var cur_q: usize = p.blockquote_depth;
-        while (cur_q > q_lv) {
-            const t = p.topT().?;
-            try p.renderTop(o);
-            if (t == .blockquote) cur_q -= 1;
-        }
-        while (cur_q < q_lv) {
-            if (p.topT() == .paragraph) {
-                try p.closeP(o);
-            } else if (p.paragraph_content.items.len > 0) {
-                try p.parseInlineContent(p.paragraph_content.items, o);
-                p.paragraph_content.clearRetainingCapacity();
+        const ListParseResult = struct {
+            is_dl: bool,
+            is_list: bool,
+        };
+        const ListContext = struct {
+            idx: ?usize,
+            content_indent: usize,
+            indent: usize,
+            lazy: bool,
+            parse_ls: usize,
+            html_ls: usize,
+            force_close_empty: bool,
+        };
+        fn syncBlockquoteDepth(p: *Self, q_lv: usize, o: anytype) !void {
+            var cur_q: usize = p.blockquote_depth;
+            while (cur_q > q_lv) {
+                const t = p.topT().?;
+                try p.renderTop(o);
+                if (t == .blockquote) cur_q -= 1;
+            }
+            while (cur_q < q_lv) {
+                if (p.topT() == .paragraph) {
+                    try p.closeP(o);
+                } else if (p.paragraph_content.items.len > 0) {
+                    try p.parseInlineContent(p.paragraph_content.items, o);
+                    p.paragraph_content.clearRetainingCapacity();
+                }
+                try p.writeAll(o, "<blockquote>");
+                try p.pushBlock(.blockquote, 0);
+                cur_q += 1;
             }
-            try p.writeAll(o, "<blockquote>");
-            try p.pushBlock(.blockquote, 0);
-            cur_q += 1;
         }
-    }
-    fn findFirstBlockquoteIndex(p: *OctomarkParser) ?usize {
-        if (p.stack_depth == 0) return null;
-        var i = p.stack_depth;
-        while (i > 0) {
-            i -= 1;
-            const bt = p.block_stack[i].block_type;
-            if (bt == .blockquote) return i;
-        }
-        return null;
-    }
-    fn handleBlankLineAfterPrefixes(p: *OctomarkParser, o: anytype) !bool {
-        p.prev_line_blank = true;
-        const bq_idx = p.findFirstBlockquoteIndex();
-        return try p.handleBlankLine(o, bq_idx, false);
-    }
-    fn parseDefinitionAndList(p: *OctomarkParser, lc: *[]const u8, ls: *usize, o: anytype) !ListParseResult {
-        const is_dl = try p.parseDefinitionList(lc, ls, o);
-        var is_list = try p.parseListItem(lc, ls, o);
-        if ((is_dl or is_list) and lc.*.len > 0) {
-            const ex = leadingIndent(lc.*);
-            if (ex.idx > 0) {
-                ls.* += ex.columns;
-                lc.* = lc.*[ex.idx..];
-            }
-        }
-        if (is_list and lc.*.len > 0) {
-            var nest_attempts: usize = 0;
-            while (nest_attempts < 2 and lc.*.len > 0) : (nest_attempts += 1) {
-                const list_idx: ?usize = if (p.active_list_stack_idx >= 0) @intCast(p.active_list_stack_idx) else null;
-                var list_content_indent: usize = 0;
-                if (list_idx) |idx| {
-                    list_content_indent = @intCast(p.block_stack[idx].content_indent);
-                }
-                if (list_idx != null and ls.* >= list_content_indent) {
-                    var lc2 = lc.*;
-                    var ls2 = ls.*;
-                    if (try p.parseListItem(&lc2, &ls2, o)) {
-                        lc.* = lc2;
-                        ls.* = ls2;
-                        is_list = true;
-                        if (lc.*.len > 0) {
-                            const ex2 = leadingIndent(lc.*);
-                            if (ex2.idx > 0) {
-                                ls.* += ex2.columns;
-                                lc.* = lc.*[ex2.idx..];
+        fn findFirstBlockquoteIndex(p: *Self) ?usize {
+            if (p.stack_depth == 0) return null;
+            var i = p.stack_depth;
+            while (i > 0) {
+                i -= 1;
+                const bt = p.block_stack[i].block_type;
+                if (bt == .blockquote) return i;
+            }
+            return null;
+        }
+        fn handleBlankLineAfterPrefixes(p: *Self, o: anytype) !bool {
+            p.prev_line_blank = true;
+            const bq_idx = p.findFirstBlockquoteIndex();
+            return try p.handleBlankLine(o, bq_idx, false);
+        }
+        fn parseDefinitionAndList(p: *Self, lc: *[]const u8, ls: *usize, o: anytype) !ListParseResult {
+            const is_dl = dialect.definition_lists and try p.parseDefinitionList(lc, ls, o);
+            var is_list = try p.parseListItem(lc, ls, o);
+            if ((is_dl or is_list) and lc.*.len > 0) {
+                const ex = leadingIndent(lc.*);
+                if (ex.idx > 0) {
+                    ls.* += ex.columns;
+                    lc.* = lc.*[ex.idx..];
+                }
+            }
+            if (is_list and lc.*.len > 0) {
+                var nest_attempts: usize = 0;
+                while (nest_attempts < 2 and lc.*.len > 0) : (nest_attempts += 1) {
+                    const list_idx: ?usize = if (p.active_list_stack_idx >= 0) @intCast(p.active_list_stack_idx) else null;
+                    var list_content_indent: usize = 0;
+                    if (list_idx) |idx| {
+                        list_content_indent = @intCast(p.block_stack[idx].content_indent);
+                    }
+                    if (list_idx != null and ls.* >= list_content_indent) {
+                        var lc2 = lc.*;
+                        var ls2 = ls.*;
+                        if (try p.parseListItem(&lc2, &ls2, o)) {
+                            lc.* = lc2;
+                            ls.* = ls2;
+                            is_list = true;
+                            if (lc.*.len > 0) {
+                                const ex2 = leadingIndent(lc.*);
+                                if (ex2.idx > 0) {
+                                    ls.* += ex2.columns;
+                                    lc.* = lc.*[ex2.idx..];
+                                }
                             }
+                            continue;
                         }
-                        continue;
                     }
+                    break;
                 }
-                break;
             }
+            return .{ .is_dl = is_dl, .is_list = is_list };
         }
-        return .{ .is_dl = is_dl, .is_list = is_list };
-    }
-    fn buildListContext(
-        p: *OctomarkParser,
-        lc: []const u8,
-        ls: usize,
-        is_list: bool,
-        is_dl: bool,
-        lazy: bool,
-        prev_blank: bool,
-    ) ListContext {
-        const list_idx: ?usize = if (p.active_list_stack_idx >= 0) @intCast(p.active_list_stack_idx) else null;
-        var list_content_indent: usize = 0;
-        var list_indent: usize = 0;
-        if (list_idx) |idx| {
-            list_content_indent = @intCast(p.block_stack[idx].content_indent);
-            list_indent = @intCast(p.block_stack[idx].indent_level);
-        }
-        var list_lazy = false;
-        if (list_idx != null and !is_list and !is_dl and lc.len > 0 and !lazy and !prev_blank) {
-            const li = list_idx.?;
-            const entry = p.block_stack[li];
-            const has_para = p.topT() == .paragraph or p.paragraph_content.items.len > 0;
-            if (ls < list_content_indent and !p.isBSM(lc, ls)) {
-                if (has_para) {
-                    list_lazy = true;
-                } else if (entry.pending_empty_item and ls > list_indent) {
-                    list_lazy = true;
-                    p.block_stack[li].pending_empty_item = false;
-                }
-            }
-            if (ls >= list_content_indent or list_lazy) {
-                if (p.block_stack[li].pending_empty_item) p.block_stack[li].pending_empty_item = false;
-            }
-        }
-        var parse_ls = ls;
-        if (list_idx != null and !is_list and !is_dl and ls >= list_content_indent) {
-            parse_ls = ls - list_content_indent;
-        }
-        var html_ls = ls;
-        if (list_idx != null and ls >= list_content_indent) html_ls = ls - list_content_indent;
-        const force_close_empty = prev_blank and list_idx != null and !is_list and !is_dl and
-            p.block_stack[list_idx.?].pending_empty_item;
-        return .{
-            .idx = list_idx,
-            .content_indent = list_content_indent,
-            .indent = list_indent,
-            .lazy = list_lazy,
-            .parse_ls = parse_ls,
-            .html_ls = html_ls,
-            .force_close_empty = force_close_empty,
-        };
-    }
-    fn adjustListStackForLine(
-        p: *OctomarkParser,
-        ls: usize,
-        ctx: ListContext,
-        is_list: bool,
-        is_dl: bool,
-        lazy: bool,
-        o: anytype,
-    ) !void {
-        if (p.stack_depth == 0) return;
-        var mi: usize = 0;
-        while (mi < p.stack_depth) {
-            const e = p.block_stack[mi];
-            if (e.block_type == .unordered_list or e.block_type == .ordered_list) {
-                if (ctx.force_close_empty and ctx.idx.? == mi) {
-                    while (p.stack_depth > mi) try p.renderTop(o);
-                    break;
+        fn buildListContext(
+            p: *Self,
+            lc: []const u8,
+            ls: usize,
+            is_list: bool,
+            is_dl: bool,
+            lazy: bool,
+            prev_blank: bool,
+        ) ListContext {
+            const list_idx: ?usize = if (p.active_list_stack_idx >= 0) @intCast(p.active_list_stack_idx) else null;
+            var list_content_indent: usize = 0;
+            var list_indent: usize = 0;
+            if (list_idx) |idx| {
+                list_content_indent = @intCast(p.block_stack[idx].content_indent);
+                list_indent = @intCast(p.block_stack[idx].indent_level);
+            }
+            var list_lazy = false;
+            if (list_idx != null and !is_list and !is_dl and lc.len > 0 and !lazy and !prev_blank) {
+                const li = list_idx.?;
+                const entry = p.block_stack[li];
+                const has_para = p.topT() == .paragraph or p.paragraph_content.items.len > 0;
+                if (ls < list_content_indent and !p.isBSM(lc, ls)) {
+                    if (has_para) {
+                        list_lazy = true;
+                    } else if (entry.pending_empty_item and ls > list_indent) {
+                        list_lazy = true;
+                        p.block_stack[li].pending_empty_item = false;
+                    }
                 }
-                if (ls < @as(usize, @intCast(e.content_indent)) and !lazy and !is_list and !is_dl and !ctx.lazy) {
-                    if (p.pending_loose_idx) |idx| {
-                        if (idx == mi) {
-                            var outer: ?usize = null;
-                            var j: usize = mi;
-                            while (j > 0) {
-                                j -= 1;
-                                const bt = p.block_stack[j].block_type;
-                                if (bt == .unordered_list or bt == .ordered_list) {
-                                    outer = j;
-                                    break;
+                if (ls >= list_content_indent or list_lazy) {
+                    if (p.block_stack[li].pending_empty_item) p.block_stack[li].pending_empty_item = false;
+                }
+            }
+            var parse_ls = ls;
+            if (list_idx != null and !is_list and !is_dl and ls >= list_content_indent) {
+                parse_ls = ls - list_content_indent;
+            }
+            var html_ls = ls;
+            if (list_idx != null and ls >= list_content_indent) html_ls = ls - list_content_indent;
+            const force_close_empty = prev_blank and list_idx != null and !is_list and !is_dl and
+                p.block_stack[list_idx.?].pending_empty_item;
+            return .{
+                .idx = list_idx,
+                .content_indent = list_content_indent,
+                .indent = list_indent,
+                .lazy = list_lazy,
+                .parse_ls = parse_ls,
+                .html_ls = html_ls,
+                .force_close_empty = force_close_empty,
+            };
+        }
+        fn adjustListStackForLine(
+            p: *Self,
+            ls: usize,
+            ctx: ListContext,
+            is_list: bool,
+            is_dl: bool,
+            lazy: bool,
+            o: anytype,
+        ) !void {
+            if (p.stack_depth == 0) return;
+            var mi: usize = 0;
+            while (mi < p.stack_depth) {
+                const e = p.block_stack[mi];
+                if (e.block_type == .unordered_list or e.block_type == .ordered_list) {
+                    if (ctx.force_close_empty and ctx.idx.? == mi) {
+                        while (p.stack_depth > mi) try p.renderTop(o);
+                        break;
+                    }
+                    if (ls < @as(usize, @intCast(e.content_indent)) and !lazy and !is_list and !is_dl and !ctx.lazy) {
+                        if (p.pending_loose_idx) |idx| {
+                            if (idx == mi) {
+                                var outer: ?usize = null;
+                                var j: usize = mi;
+                                while (j > 0) {
+                                    j -= 1;
+                                    const bt = p.block_stack[j].block_type;
+                                    if (bt == .unordered_list or bt == .ordered_list) {
+                                        outer = j;
+                                        break;
+                                    }
                                 }
+                                p.pending_loose_idx = outer;
                             }
-                            p.pending_loose_idx = outer;
                         }
+                        while (p.stack_depth > mi) try p.renderTop(o);
+                        break;
                     }
-                    while (p.stack_depth > mi) try p.renderTop(o);
-                    break;
                 }
+                mi += 1;
             }
-            mi += 1;
-        }
-        if (p.pending_loose_idx) |idx| {
-            if (idx < p.stack_depth) {
-                const entry = p.block_stack[idx];
-                const entry_content: usize = @intCast(entry.content_indent);
-                if (is_list or ls >= entry_content) {
-                    try p.applyPendingLoose(o);
+            if (p.pending_loose_idx) |idx| {
+                if (idx < p.stack_depth) {
+                    const entry = p.block_stack[idx];
+                    const entry_content: usize = @intCast(entry.content_indent);
+                    if (is_list or ls >= entry_content) {
+                        try p.applyPendingLoose(o);
+                    }
+                } else {
+                    p.pending_loose_idx = null;
                 }
-            } else {
-                p.pending_loose_idx = null;
             }
         }
-    }
-    fn handleThematicBreakListClose(p: *OctomarkParser, lc: []const u8, ls: usize, o: anytype) !void {
-        if (ls > 3 or !isThematicBreakLine(lc) or p.stack_depth == 0) return;
-        const l_id: ?i32 = if (p.active_list_stack_idx >= 0) p.block_stack[@intCast(p.active_list_stack_idx)].content_indent else null;
-        if (l_id) |lim| {
-            if (ls < @as(usize, @intCast(lim))) {
-                try p.closeP(o);
-                while (p.topT() == .unordered_list or p.topT() == .ordered_list) {
-                    try p.renderTop(o);
+        fn handleThematicBreakListClose(p: *Self, lc: []const u8, ls: usize, o: anytype) !void {
+            if (ls > 3 or !isThematicBreakLine(lc) or p.stack_depth == 0) return;
+            const l_id: ?i32 = if (p.active_list_stack_idx >= 0) p.block_stack[@intCast(p.active_list_stack_idx)].content_indent else null;
+            if (l_id) |lim| {
+                if (ls < @as(usize, @intCast(lim))) {
+                    try p.closeP(o);
+                    while (p.topT() == .unordered_list or p.topT() == .ordered_list) {
+                        try p.renderTop(o);
+                    }
                 }
             }
         }
-    }
-    fn processSingleLine(p: *OctomarkParser, line: []const u8, full: []const u8, pos: usize, o: anytype) !bool {
-        const s = p.startCall(.processSingleLine);
-        defer p.endCall(.processSingleLine, s);
-        if (try p.processLeafBlockContinuation(line, o)) return false;
-        const id = leadingIndent(line);
-        var ls = id.columns;
-        var lc = line[id.idx..];
-        if (lc.len == 0) {
-            p.prev_line_blank = true;
-            return try p.handleBlankLine(o, null, true);
-        }
-        const prev_blank = p.prev_line_blank;
-        p.prev_line_blank = false;
-        const bq_scan = scanBlockquotePrefix(lc, ls);
-        var q_lv: usize = bq_scan.depth;
-        const ex_id: usize = bq_scan.extra_indent;
-        lc = bq_scan.rest;
-        const cur_q: usize = p.blockquote_depth;
-        ls = adjustIndentForBlockquote(p, ls, q_lv, cur_q);
-        ls += ex_id;
-        const p_id = leadingIndent(lc);
-        ls += p_id.columns;
-        lc = lc[p_id.idx..];
-        var lazy = false;
-        if (q_lv < cur_q and p.topT() == .paragraph) {
-            if (!p.isBSM(lc, ls)) {
-                q_lv = cur_q;
-                lazy = true;
-            }
-        }
-        try p.syncBlockquoteDepth(q_lv, o);
-        if (lc.len == 0) {
-            return try p.handleBlankLineAfterPrefixes(o);
-        }
-        const list_result = try p.parseDefinitionAndList(&lc, &ls, o);
-        const is_dl = list_result.is_dl;
-        const is_list = list_result.is_list;
-        const list_ctx = p.buildListContext(lc, ls, is_list, is_dl, lazy, prev_blank);
-        const list_idx = list_ctx.idx;
-        const parse_ls = list_ctx.parse_ls;
-        const html_ls = list_ctx.html_ls;
-        if (lc.len > 0) {
-            try p.adjustListStackForLine(ls, list_ctx, is_list, is_dl, lazy, o);
-            try p.handleThematicBreakListClose(lc, ls, o);
-            if (try p.trySetextHeader(lc, parse_ls, list_idx, lazy, o)) return false;
-            switch (lc[0]) {
-                '#' => if (try p.parseHeader(lc, parse_ls, o)) return false,
-                '`', '~' => if (try p.parseFencedCodeBlock(lc, parse_ls, o)) return false,
-                '$' => if (try p.parseMathBlock(lc, parse_ls, o)) return false,
-                '-', '*', '_' => if (try p.parseHorizontalRule(lc, parse_ls, o)) return false,
-                '|' => if (try p.parseTable(lc, full, pos, o)) return true,
-                '>' => if (try p.tryOpenBlockquoteFromLine(lc, ls, o)) |new_lc| {
-                    lc = new_lc;
-                },
-                '<' => if (try p.tryStartHtmlBlock(lc, html_ls, o)) return false,
-                else => {},
+        /// Count a top-level block starting at `line`, recording a checkpoint when one is due and
+        /// ending the page at `page_end`.
+        fn markTopLevelBlock(p: *Self, line: []const u8) !void {
+            if (leadingIndent(line).idx == line.len) return;
+            if (dialect.footnotes and p.footnote_open != null) return;
+            if (p.page_end != null and p.top_blocks >= p.page_end.?) {
+                p.page_done = true;
+                return;
             }
-        }
-        if (!is_dl and try p.parseDefinitionTerm(lc, full, pos, o)) return false;
-        if (!is_dl and try p.parseIndentedCodeBlock(lc, ls, o)) return false;
-        try p.processParagraph(lc, is_dl, is_list, o);
-        return false;
-    }
-    fn isNextLineTableSeparator(parser: *OctomarkParser, full_data: []const u8, start_pos: usize) bool {
-        const _s = parser.startCall(.isNextLineTableSeparator);
-        defer parser.endCall(.isNextLineTableSeparator, _s);
-        if (start_pos >= full_data.len) return false;
-        const nl = std.mem.indexOfScalar(u8, full_data[start_pos..], '\n') orelse full_data.len - start_pos;
-        const next_line = full_data[start_pos .. start_pos + nl];
-        const trimmed = std.mem.trim(u8, next_line, &std.ascii.whitespace);
-        if (trimmed.len < 3) return false;
-        const first = trimmed[0];
-        if (first != '|' and first != '-' and first != ':') return false;
-        var has_dash = false;
-        for (trimmed) |c| {
-            switch (c) {
-                '-' => has_dash = true,
-                ':', '|', ' ', '\t', '\r' => {},
-                else => return false,
+            const offset = p.rawOffset(p.sourceOffset(line).?);
+            const last = p.checkpoint_list.items;
+            const due = if (last.len == 0) true else offset - last[last.len - 1].offset >= p.options.checkpoint_interval;
+            if (p.options.checkpoint_interval > 0 and due) {
+                try p.checkpoint_list.append(p.allocator, .{ .offset = offset, .block = p.top_blocks });
             }
+            p.top_blocks += 1;
         }
-        return has_dash;
-    }
-    fn parseHtmlTag(parser: *OctomarkParser, text: []const u8) usize {
-        const _s = parser.startCall(.parseHtmlTag);
-        defer parser.endCall(.parseHtmlTag, _s);
-        const len = text.len;
-        if (len < 3 or text[0] != '<') return 0;
-        var i: usize = 1;
-        if (i + 2 < len and std.mem.eql(u8, text[i .. i + 3], "!--")) {
-            i += 3;
-            if (i < len and text[i] == '>') return i + 1;
-            if (i + 1 < len and text[i] == '-' and text[i + 1] == '>') return i + 2;
-            while (i + 2 < len) : (i += 1) {
-                if (std.mem.eql(u8, text[i .. i + 3], "-->")) return i + 3;
+        fn processSingleLine(p: *Self, line: []const u8, full: []const u8, pos: usize, o: anytype) !bool {
+            const s = p.startCall(.processSingleLine);
+            defer p.endCall(.processSingleLine, s);
+            if (dialect.tables and p.table_row_ends.items.len > 0) {
+                const first = leadingIndent(line).idx;
+                if (first >= line.len or line[first] != '|') try p.flushTableBatch(o);
             }
-            return 0;
+            if (p.stack_depth == 0 and (p.options.checkpoint_interval > 0 or p.page_end != null)) {
+                try p.markTopLevelBlock(line);
+                if (p.page_done) return false;
+            }
+            if (dialect.footnotes and p.footnote_open != null and try p.continueFootnote(line)) return false;
+            if (try p.processLeafBlockContinuation(line, o)) return false;
+            const id = leadingIndent(line);
+            var ls = id.columns;
+            var lc = line[id.idx..];
+            if (lc.len == 0) {
+                p.prev_line_blank = true;
+                return try p.handleBlankLine(o, null, true);
+            }
+            const prev_blank = p.prev_line_blank;
+            p.prev_line_blank = false;
+            const bq_scan = if (block_start[lc[0]] & BlockStart.quote != 0)
+                scanBlockquotePrefix(lc, ls)
+            else
+                BlockquoteScan{ .depth = 0, .extra_indent = 0, .rest = lc };
+            var q_lv: usize = bq_scan.depth;
+            const ex_id: usize = bq_scan.extra_indent;
+            lc = bq_scan.rest;
+            const cur_q: usize = p.blockquote_depth;
+            ls = adjustIndentForBlockquote(p, ls, q_lv, cur_q);
+            ls += ex_id;
+            const p_id = leadingIndent(lc);
+            ls += p_id.columns;
+            lc = lc[p_id.idx..];
+            var lazy = false;
+            if (q_lv < cur_q and p.topT() == .paragraph) {
+                if (!p.isBSM(lc, ls)) {
+                    q_lv = cur_q;
+                    lazy = true;
+                }
+            }
+            try p.syncBlockquoteDepth(q_lv, o);
+            if (lc.len == 0) {
+                return try p.handleBlankLineAfterPrefixes(o);
+            }
+            const list_result: ListParseResult = if (block_start[lc[0]] & (BlockStart.list | BlockStart.definition) != 0)
+                try p.parseDefinitionAndList(&lc, &ls, o)
+            else
+                .{ .is_dl = false, .is_list = false };
+            const is_dl = list_result.is_dl;
+            const is_list = list_result.is_list;
+            const list_ctx = p.buildListContext(lc, ls, is_list, is_dl, lazy, prev_blank);
+            const list_idx = list_ctx.idx;
+            const parse_ls = list_ctx.parse_ls;
+            const html_ls = list_ctx.html_ls;
+            if (lc.len > 0) {
+                try p.adjustListStackForLine(ls, list_ctx, is_list, is_dl, lazy, o);
+                const class = block_start[lc[0]];
+                if (class & BlockStart.thematic != 0) try p.handleThematicBreakListClose(lc, ls, o);
+                if (class & BlockStart.setext != 0 and try p.trySetextHeader(lc, parse_ls, list_idx, lazy, o)) return false;
+                if (class & BlockStart.leaf != 0) switch (lc[0]) {
+                    '#' => if (try p.parseHeader(lc, parse_ls, o)) return false,
+                    '`', '~' => if (try p.parseFencedCodeBlock(lc, parse_ls, o)) return false,
+                    '$' => if (dialect.math and try p.parseMathBlock(lc, parse_ls, o)) return false,
+                    '-', '*', '_' => if (try p.parseHorizontalRule(lc, parse_ls, o)) return false,
+                    '|' => if (dialect.tables) {
+                        // Only a new table consumes the following separator line; body rows do not.
+                        const in_table = p.topT() == .table;
+                        if (try p.parseTable(lc, full, pos, o)) return !in_table;
+                    },
+                    '>' => if (try p.tryOpenBlockquoteFromLine(lc, ls, o)) |new_lc| {
+                        lc = new_lc;
+                    },
+                    '<' => if (dialect.html and try p.tryStartHtmlBlock(lc, html_ls, o)) return false,
+                    '[' => if (dialect.footnotes and try p.startFootnoteDefinition(lc, parse_ls)) return false,
+                    else => {},
+                };
+            }
+            if (dialect.definition_lists and !is_dl and try p.parseDefinitionTerm(lc, full, pos, o)) return false;
+            if (!is_dl and ls >= 4 and try p.parseIndentedCodeBlock(lc, ls, o)) return false;
+            try p.processParagraph(lc, is_dl, is_list, o);
+            return false;
         }
-        if (i + 7 < len and std.mem.eql(u8, text[i .. i + 8], "![CDATA[")) {
-            i += 8;
-            while (i + 2 < len) : (i += 1) {
-                if (text[i] == ']' and text[i + 1] == ']' and text[i + 2] == '>') return i + 3;
+        fn isNextLineTableSeparator(parser: *Self, full_data: []const u8, start_pos: usize) bool {
+            const _s = parser.startCall(.isNextLineTableSeparator);
+            defer parser.endCall(.isNextLineTableSeparator, _s);
+            if (start_pos >= full_data.len) return false;
+            const nl = std.mem.indexOfScalar(u8, full_data[start_pos..], '\n') orelse full_data.len - start_pos;
+            const next_line = full_data[start_pos .. start_pos + nl];
+            const trimmed = std.mem.trim(u8, next_line, &std.ascii.whitespace);
+            if (trimmed.len < 3) return false;
+            const first = trimmed[0];
+            if (first != '|' and first != '-' and first != ':') return false;
+            var has_dash = false;
+            for (trimmed) |c| {
+                switch (c) {
+                    '-' => has_dash = true,
+                    ':', '|', ' ', '\t', '\r' => {},
+                    else => return false,
+                }
             }
-            return 0;
+            return has_dash;
+        }
+        inline fn writeRawHtml(p: *Self, html: []const u8, o: anytype) !void {
+            if (p.options.sanitize) try p.writeSanitizedHtml(html, o) else try p.writeAll(o, html);
         }
-        if (i < len and text[i] == '?') {
-            i += 1;
-            while (i + 1 < len) : (i += 1) {
-                if (std.mem.eql(u8, text[i .. i + 2], "?>")) return i + 2;
+        /// Write raw HTML with every tag filtered by `writeSanitizedTag`. Text between tags passes
+        /// through and a `<` that does not start a complete tag is escaped.
+        fn writeSanitizedHtml(p: *Self, html: []const u8, o: anytype) !void {
+            var i: usize = 0;
+            while (std.mem.indexOfScalarPos(u8, html, i, '<')) |lt| {
+                try p.writeAll(o, html[i..lt]);
+                const l = p.parseHtmlTag(html[lt..]);
+                if (l == 0) {
+                    try p.writeAll(o, "&lt;");
+                    i = lt + 1;
+                } else {
+                    try p.writeSanitizedTag(html[lt .. lt + l], o);
+                    i = lt + l;
+                }
             }
-            return 0;
+            try p.writeAll(o, html[i..]);
         }
-        if (i < len and text[i] == '!') {
-            i += 1;
-            while (i < len) : (i += 1) {
-                if (text[i] == '>') return i + 1;
+        /// Write one tag as matched by `parseHtmlTag`. Comments, declarations, processing
+        /// instructions and tags outside the allowlist are dropped; kept tags keep only allowlisted
+        /// attributes, re-quoted, with dangerous URLs emptied.
+        fn writeSanitizedTag(p: *Self, tag: []const u8, o: anytype) !void {
+            if (tag[1] == '!' or tag[1] == '?') return;
+            const closing = tag[1] == '/';
+            var i: usize = if (closing) 2 else 1;
+            const name_start = i;
+            while (i < tag.len and (std.ascii.isAlphanumeric(tag[i]) or tag[i] == '-')) i += 1;
+            const name = tag[name_start..i];
+            if (!sanitize_tags.contains(name)) return;
+            try p.writeAll(o, if (closing) "</" else "<");
+            try p.writeAll(o, name);
+            while (!closing) {
+                while (i < tag.len and std.ascii.isWhitespace(tag[i])) i += 1;
+                const attr_start = i;
+                while (i < tag.len and isAttributeNameChar(tag[i])) i += 1;
+                const attr = tag[attr_start..i];
+                if (attr.len == 0) break;
+                var value: ?[]const u8 = null;
+                var j = i;
+                while (j < tag.len and std.ascii.isWhitespace(tag[j])) j += 1;
+                if (j < tag.len and tag[j] == '=') {
+                    j += 1;
+                    while (j < tag.len and std.ascii.isWhitespace(tag[j])) j += 1;
+                    if (j < tag.len and (tag[j] == '"' or tag[j] == '\'')) {
+                        const end = std.mem.indexOfScalarPos(u8, tag, j + 1, tag[j]) orelse tag.len;
+                        value = tag[j + 1 .. end];
+                        j = @min(end + 1, tag.len);
+                    } else {
+                        const value_start = j;
+                        while (j < tag.len and !std.ascii.isWhitespace(tag[j]) and tag[j] != '>') j += 1;
+                        value = tag[value_start..j];
+                    }
+                    i = j;
+                }
+                if (!sanitize_attributes.contains(attr)) continue;
+                try p.writeByte(o, ' ');
+                try p.writeAll(o, attr);
+                if (value) |v| {
+                    try p.writeAll(o, "=\"");
+                    if (!(isUrlAttribute(attr) and isDangerousUrl(v))) try p.writeAttributeValue(v, o);
+                    try p.writeByte(o, '"');
+                }
             }
-            return 0;
+            try p.writeByte(o, '>');
         }
-        const closing = if (i < len and text[i] == '/') blk: {
-            i += 1;
-            break :blk true;
-        } else false;
-        if (i >= len or !std.ascii.isAlphabetic(text[i])) return 0;
-        while (i < len and (std.ascii.isAlphanumeric(text[i]) or text[i] == '-')) : (i += 1) {}
-        if (closing) {
-            while (i < len and std.ascii.isWhitespace(text[i])) : (i += 1) {}
-            return if (i < len and text[i] == '>') i + 1 else 0;
+        /// Write a raw attribute value for double quoting; entities in it are kept as written.
+        fn writeAttributeValue(p: *Self, value: []const u8, o: anytype) !void {
+            var start: usize = 0;
+            while (std.mem.indexOfAnyPos(u8, value, start, "\"<>")) |k| {
+                try p.writeAll(o, value[start..k]);
+                try p.writeAll(o, html_escape_map[value[k]].?);
+                start = k + 1;
+            }
+            try p.writeAll(o, value[start..]);
         }
-        while (i < len) {
-            const has_ws = std.ascii.isWhitespace(text[i]);
-            while (i < len and std.ascii.isWhitespace(text[i])) : (i += 1) {}
-            if (i >= len) return 0;
-            if (text[i] == '>') return i + 1;
-            if (i + 1 < len and text[i] == '/' and text[i + 1] == '>') return i + 2;
-            if (!has_ws) return 0;
-            if (std.ascii.isAlphabetic(text[i]) or text[i] == '_' or text[i] == ':') {
+        fn parseHtmlTag(parser: *Self, text: []const u8) usize {
+            const _s = parser.startCall(.parseHtmlTag);
+            defer parser.endCall(.parseHtmlTag, _s);
+            const len = text.len;
+            if (len < 3 or text[0] != '<') return 0;
+            var i: usize = 1;
+            if (i + 2 < len and std.mem.eql(u8, text[i .. i + 3], "!--")) {
+                i += 3;
+                if (i < len and text[i] == '>') return i + 1;
+                if (i + 1 < len and text[i] == '-' and text[i + 1] == '>') return i + 2;
+                while (i + 2 < len) : (i += 1) {
+                    if (std.mem.eql(u8, text[i .. i + 3], "-->")) return i + 3;
+                }
+                return 0;
+            }
+            if (i + 7 < len and std.mem.eql(u8, text[i .. i + 8], "![CDATA[")) {
+                i += 8;
+                while (i + 2 < len) : (i += 1) {
+                    if (text[i] == ']' and text[i + 1] == ']' and text[i + 2] == '>') return i + 3;
+                }
+                return 0;
+            }
+            if (i < len and text[i] == '?') {
                 i += 1;
-                while (i < len and (std.ascii.isAlphanumeric(text[i]) or text[i] == '_' or text[i] == '.' or
-                    text[i] == ':' or text[i] == '-')) : (i += 1)
-                {}
-                const before_eq = i;
+                while (i + 1 < len) : (i += 1) {
+                    if (std.mem.eql(u8, text[i .. i + 2], "?>")) return i + 2;
+                }
+                return 0;
+            }
+            if (i < len and text[i] == '!') {
+                i += 1;
+                while (i < len) : (i += 1) {
+                    if (text[i] == '>') return i + 1;
+                }
+                return 0;
+            }
+            const closing = if (i < len and text[i] == '/') blk: {
+                i += 1;
+                break :blk true;
+            } else false;
+            if (i >= len or !std.ascii.isAlphabetic(text[i])) return 0;
+            while (i < len and (std.ascii.isAlphanumeric(text[i]) or text[i] == '-')) : (i += 1) {}
+            if (closing) {
+                while (i < len and std.ascii.isWhitespace(text[i])) : (i += 1) {}
+                return if (i < len and text[i] == '>') i + 1 else 0;
+            }
+            while (i < len) {
+                const has_ws = std.ascii.isWhitespace(text[i]);
                 while (i < len and std.ascii.isWhitespace(text[i])) : (i += 1) {}
-                if (i < len and text[i] == '=') {
+                if (i >= len) return 0;
+                if (text[i] == '>') return i + 1;
+                if (i + 1 < len and text[i] == '/' and text[i + 1] == '>') return i + 2;
+                if (!has_ws) return 0;
+                if (std.ascii.isAlphabetic(text[i]) or text[i] == '_' or text[i] == ':') {
                     i += 1;
+                    while (i < len and (std.ascii.isAlphanumeric(text[i]) or text[i] == '_' or text[i] == '.' or
+                        text[i] == ':' or text[i] == '-')) : (i += 1)
+                    {}
+                    const before_eq = i;
                     while (i < len and std.ascii.isWhitespace(text[i])) : (i += 1) {}
-                    if (i >= len) return 0;
-                    if (text[i] == '"') {
-                        i += 1;
-                        while (i < len and text[i] != '"') : (i += 1) {}
-                        if (i >= len) return 0;
+                    if (i < len and text[i] == '=') {
                         i += 1;
-                    } else if (text[i] == '\'') {
-                        i += 1;
-                        while (i < len and text[i] != '\'') : (i += 1) {}
+                        while (i < len and std.ascii.isWhitespace(text[i])) : (i += 1) {}
                         if (i >= len) return 0;
-                        i += 1;
+                        if (text[i] == '"') {
+                            i += 1;
+                            while (i < len and text[i] != '"') : (i += 1) {}
+                            if (i >= len) return 0;
+                            i += 1;
+                        } else if (text[i] == '\'') {
+                            i += 1;
+                            while (i < len and text[i] != '\'') : (i += 1) {}
+                            if (i >= len) return 0;
+                            i += 1;
+                        } else {
+                            if (std.ascii.isWhitespace(text[i]) or text[i] == '"' or text[i] == '\'' or text[i] == '=' or
+                                text[i] == '<' or text[i] == '>' or text[i] == '`') return 0;
+                            while (i < len and !std.ascii.isWhitespace(text[i]) and text[i] != '"' and text[i] != '\'' and
+                                text[i] != '=' and text[i] != '<' and text[i] != '>' and text[i] != '`') : (i += 1)
+                            {}
+                        }
                     } else {
-                        if (std.ascii.isWhitespace(text[i]) or text[i] == '"' or text[i] == '\'' or text[i] == '=' or
-                            text[i] == '<' or text[i] == '>' or text[i] == '`') return 0;
-                        while (i < len and !std.ascii.isWhitespace(text[i]) and text[i] != '"' and text[i] != '\'' and
-                            text[i] != '=' and text[i] != '<' and text[i] != '>' and text[i] != '`') : (i += 1)
-                        {}
+                        i = before_eq;
                     }
-                } else {
-                    i = before_eq;
-                }
-            } else return 0;
+                } else return 0;
+            }
+            return if (i < len and text[i] == '>') i + 1 else 0;
         }
-        return if (i < len and text[i] == '>') i + 1 else 0;
-    }
-    fn splitTableRowCells(parser: *OctomarkParser, str: []const u8, cells: *[64][]const u8) usize {
-        const _s = parser.startCall(.splitTableRowCells);
-        defer parser.endCall(.splitTableRowCells, _s);
-        var count: usize = 0;
-        var cursor = std.mem.trim(u8, str, &std.ascii.whitespace);
-        if (cursor.len > 0 and cursor[0] == '|') cursor = cursor[1..];
-        while (cursor.len > 0) {
-            var k: usize = 0;
-            var end_offset: usize = cursor.len;
-            while (std.mem.indexOfScalar(u8, cursor[k..], '|')) |offset| {
-                const j = k + offset;
-                var backslashes: usize = 0;
-                var b = j;
-                while (b > 0 and cursor[b - 1] == '\\') : (b -= 1) {
-                    backslashes += 1;
-                }
-                if (backslashes % 2 == 0) {
-                    end_offset = j;
-                    break;
+        fn splitTableRowCells(parser: *Self, str: []const u8, cells: *std.ArrayListUnmanaged([]const u8)) !void {
+            const _s = parser.startCall(.splitTableRowCells);
+            defer parser.endCall(.splitTableRowCells, _s);
+            cells.clearRetainingCapacity();
+            var cursor = std.mem.trim(u8, str, &std.ascii.whitespace);
+            if (cursor.len > 0 and cursor[0] == '|') cursor = cursor[1..];
+            while (cursor.len > 0) {
+                var k: usize = 0;
+                var end_offset: usize = cursor.len;
+                while (std.mem.indexOfScalar(u8, cursor[k..], '|')) |offset| {
+                    const j = k + offset;
+                    var backslashes: usize = 0;
+                    var b = j;
+                    while (b > 0 and cursor[b - 1] == '\\') : (b -= 1) {
+                        backslashes += 1;
+                    }
+                    if (backslashes % 2 == 0) {
+                        end_offset = j;
+                        break;
+                    }
+                    k = j + 1;
                 }
-                k = j + 1;
+                try cells.append(parser.allocator, std.mem.trim(u8, cursor[0..end_offset], &std.ascii.whitespace));
+                if (end_offset >= cursor.len) break;
+                cursor = cursor[end_offset + 1 ..];
+                cursor = std.mem.trimLeft(u8, cursor, &std.ascii.whitespace);
             }
-            const cell = std.mem.trim(u8, cursor[0..end_offset], &std.ascii.whitespace);
-            if (count < cells.len) {
-                cells[count] = cell;
-                count += 1;
-            }
-            if (end_offset >= cursor.len) break;
-            cursor = cursor[end_offset + 1 ..];
-            cursor = std.mem.trimLeft(u8, cursor, &std.ascii.whitespace);
         }
-        return count;
-    }
-    fn writeTableAlignment(parser: *OctomarkParser, output: anytype, align_type: TableAlignment) !void {
-        try switch (align_type) {
-            .left => parser.writeAll(output, " style=\"text-align:left\""),
-            .center => parser.writeAll(output, " style=\"text-align:center\""),
-            .right => parser.writeAll(output, " style=\"text-align:right\""),
-            .none => {},
-        };
-    }
-};
+    };
+}
+
+/// Parser for the default `Dialect`: the CommonMark core with tables, task lists, definition
+/// lists, math and raw HTML, and the extensions off. `OctomarkOptions` still toggles behavior
+/// at runtime.
+pub const OctomarkParser = Octomark(.{});
@@ -0,0 +1,84 @@
+const std = @import("std");
+
+/// Perfect hash over a static set of lowercase ASCII keys, built at compile time by hash and
+/// displace: a first hash groups keys into buckets, and each bucket, largest first, gets the
+/// smallest seed that sends all of its keys to free slots. A lookup costs two hashes and one
+/// comparison and matches ASCII case-insensitively.
+pub fn Set(comptime keys: []const []const u8) type {
+    const slot_count = std.math.ceilPowerOfTwo(usize, @max(keys.len * 2, 2)) catch unreachable;
+    const bucket_count = @max(keys.len / 4, 1);
+    const empty = std.math.maxInt(u16);
+    const place = struct {
+        /// Claim a free slot for every key of a bucket under `seed`, or undo the claims made so
+        /// far and fail.
+        fn place(slots: *[slot_count]u16, members: []const u16, seed: u32) bool {
+            for (members, 0..) |k, j| {
+                const s = hash(keys[k], seed) % slot_count;
+                if (slots[s] != empty) {
+                    for (members[0..j]) |done| slots[hash(keys[done], seed) % slot_count] = empty;
+                    return false;
+                }
+                slots[s] = k;
+            }
+            return true;
+        }
+    }.place;
+    const tables = comptime build: {
+        @setEvalBranchQuota(100_000 + keys.len * 5_000);
+        var max_len: usize = 0;
+        var bucket_of: [keys.len]usize = undefined;
+        var bucket_sizes = [_]usize{0} ** bucket_count;
+        for (keys, 0..) |key, k| {
+            max_len = @max(max_len, key.len);
+            bucket_of[k] = hash(key, 0) % bucket_count;
+            bucket_sizes[bucket_of[k]] += 1;
+        }
+        // Key indices grouped by bucket, so a seed attempt only hashes the bucket's own keys.
+        var bucket_starts: [bucket_count + 1]usize = undefined;
+        bucket_starts[0] = 0;
+        for (0..bucket_count) |b| bucket_starts[b + 1] = bucket_starts[b] + bucket_sizes[b];
+        var fill = bucket_starts;
+        var grouped: [keys.len]u16 = undefined;
+        for (0..keys.len) |k| {
+            grouped[fill[bucket_of[k]]] = @intCast(k);
+            fill[bucket_of[k]] += 1;
+        }
+        var seeds = [_]u32{0} ** bucket_count;
+        var slots = [_]u16{empty} ** slot_count;
+        var size = std.mem.max(usize, &bucket_sizes);
+        while (size > 0) : (size -= 1) {
+            for (0..bucket_count) |b| {
+                if (bucket_sizes[b] != size) continue;
+                const members = grouped[bucket_starts[b]..bucket_starts[b + 1]];
+                var seed: u32 = 1;
+                while (!place(&slots, members, seed)) seed += 1;
+                seeds[b] = seed;
+            }
+        }
+        break :build .{ .seeds = seeds, .slots = slots, .max_len = max_len };
+    };
+    return struct {
+        /// Length of the longest key.
+        pub const max_len = tables.max_len;
+        /// Index of `name` in `keys`, or null.
+        pub fn index(name: []const u8) ?usize {
+            if (name.len == 0 or name.len > tables.max_len) return null;
+            const seed = tables.seeds[hash(name, 0) % bucket_count];
+            const k = tables.slots[hash(name, seed) % slot_count];
+            if (k == empty or !std.ascii.eqlIgnoreCase(keys[k], name)) return null;
+            return k;
+        }
+        pub fn contains(name: []const u8) bool {
+            return index(name) != null;
+        }
+    };
+}
+
+fn hash(bytes: []const u8, seed: u32) u32 {
+    var h: u32 = 0x811C9DC5 ^ (seed *% 0x9E3779B9);
+    for (bytes) |b| h = (h ^ std.ascii.toLower(b)) *% 0x01000193;
+    h ^= h >> 16;
+    h *%= 0x85EBCA6B;
+    h ^= h >> 13;
+    return h;
+}
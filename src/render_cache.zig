@@ -0,0 +1,171 @@
+const std = @import("std");
+const builtin = @import("builtin");
+
+/// Rendered documents kept in a directory, one file per key, shared by any number of processes.
+/// An entry is written to a temporary file and renamed into place, so concurrent builds see a
+/// whole entry or none. The running total of entry sizes is kept in a summary file, so opening
+/// the cache does not list the directory. Past `max_bytes`, the directory is listed and the least
+/// recently used entries are removed until it is under three quarters of the limit.
+pub const RenderCache = struct {
+    allocator: std.mem.Allocator,
+    dir: std.fs.Dir,
+    max_bytes: u64,
+    /// Mixed into every key; change it when hooks or resolvers change their output.
+    salt: u64 = 0,
+    /// Bytes of entries in the directory as of `open` or the last eviction, plus entries
+    /// written since. Processes sharing the directory update the summary without locking, so
+    /// this is an estimate until the next eviction recounts it.
+    size: u64 = 0,
+    hits: usize = 0,
+    misses: usize = 0,
+
+    /// Entry layout: magic, key and output length (little-endian u64s), then the output.
+    const magic = "OMRC";
+    const header_len = magic.len + 16;
+    const name_len = 16 + ".omc".len;
+    /// Summary file holding `size` in decimal.
+    const size_name = "size";
+    const can_map = builtin.os.tag != .windows and builtin.os.tag != .wasi;
+
+    /// Stored output, mapped read-only where the platform supports it.
+    pub const Entry = struct {
+        /// Header and output as stored; the output is `data[header_len..]`.
+        data: []align(std.heap.page_size_min) const u8,
+        pub fn bytes(e: Entry) []const u8 {
+            return e.data[header_len..];
+        }
+    };
+
+    /// Open the cache at `path`, creating the directory if needed.
+    pub fn open(allocator: std.mem.Allocator, path: []const u8, max_bytes: u64) !RenderCache {
+        var dir = try std.fs.cwd().makeOpenPath(path, .{ .iterate = true });
+        errdefer dir.close();
+        var c: RenderCache = .{ .allocator = allocator, .dir = dir, .max_bytes = max_bytes };
+        c.size = c.readSize() orelse size: {
+            // A new directory, or one written before the summary existed.
+            const total = try c.scan(null);
+            try c.writeSize(total);
+            break :size total;
+        };
+        return c;
+    }
+    pub fn close(c: *RenderCache) void {
+        c.dir.close();
+    }
+    /// The entry for `key`, or null. A hit refreshes the entry's modification time, which
+    /// orders eviction. Release the entry with `release`.
+    pub fn get(c: *RenderCache, key: u64) !?Entry {
+        var name: [name_len]u8 = undefined;
+        const file = c.dir.openFile(entryName(key, &name), .{}) catch |e| switch (e) {
+            error.FileNotFound => {
+                c.misses += 1;
+                return null;
+            },
+            else => return e,
+        };
+        defer file.close();
+        const len: usize = @intCast((try file.stat()).size);
+        if (len < header_len) {
+            c.misses += 1;
+            return null;
+        }
+        const data: []align(std.heap.page_size_min) const u8 = if (can_map)
+            try std.posix.mmap(null, len, std.posix.PROT.READ, .{ .TYPE = .PRIVATE }, file.handle, 0)
+        else
+            try file.readToEndAllocOptions(c.allocator, len, len, .fromByteUnits(std.heap.page_size_min), null);
+        const entry: Entry = .{ .data = data };
+        // An entry from another version of the layout, or one truncated outside this cache.
+        if (!std.mem.eql(u8, data[0..magic.len], magic) or
+            std.mem.readInt(u64, data[magic.len..][0..8], .little) != key or
+            std.mem.readInt(u64, data[magic.len + 8 ..][0..8], .little) != len - header_len)
+        {
+            c.release(entry);
+            c.misses += 1;
+            return null;
+        }
+        const now = std.time.nanoTimestamp();
+        // A failed touch only makes the entry an earlier eviction candidate.
+        file.updateTimes(now, now) catch {};
+        c.hits += 1;
+        return entry;
+    }
+    pub fn release(c: *RenderCache, entry: Entry) void {
+        if (can_map) std.posix.munmap(entry.data) else c.allocator.free(entry.data);
+    }
+    /// Store `output` under `key`, replacing any entry atomically, and evict if the cache has
+    /// outgrown `max_bytes`.
+    pub fn put(c: *RenderCache, key: u64, output: []const u8) !void {
+        var name: [name_len]u8 = undefined;
+        var buffer: [4096]u8 = undefined;
+        var file = try c.dir.atomicFile(entryName(key, &name), .{ .write_buffer = &buffer });
+        defer file.deinit();
+        const w = &file.file_writer.interface;
+        try w.writeAll(magic);
+        try w.writeInt(u64, key, .little);
+        try w.writeInt(u64, output.len, .little);
+        try w.writeAll(output);
+        try file.finish();
+        // Another process may have grown the cache since `open`.
+        c.size = @max(c.size, c.readSize() orelse 0) + header_len + output.len;
+        if (c.size > c.max_bytes) c.size = try c.scan(c.max_bytes / 4 * 3);
+        try c.writeSize(c.size);
+    }
+    fn readSize(c: *RenderCache) ?u64 {
+        var buf: [20]u8 = undefined;
+        const text = c.dir.readFile(size_name, &buf) catch return null;
+        return std.fmt.parseInt(u64, text, 10) catch null;
+    }
+    fn writeSize(c: *RenderCache, size: u64) !void {
+        var buf: [20]u8 = undefined;
+        var file = try c.dir.atomicFile(size_name, .{ .write_buffer = &buf });
+        defer file.deinit();
+        try file.file_writer.interface.print("{d}", .{size});
+        try file.finish();
+    }
+    /// Total size of the entries in the directory. With `target`, the least recently used
+    /// entries are deleted until the total is at most `target`; entries another process
+    /// removed first are skipped.
+    fn scan(c: *RenderCache, target: ?u64) !u64 {
+        const Item = struct {
+            name: [name_len]u8,
+            mtime: i128,
+            size: u64,
+            fn older(_: void, a: @This(), b: @This()) bool {
+                return a.mtime < b.mtime;
+            }
+        };
+        var items: std.ArrayListUnmanaged(Item) = .{};
+        defer items.deinit(c.allocator);
+        var total: u64 = 0;
+        var it = c.dir.iterate();
+        while (try it.next()) |e| {
+            if (e.kind != .file or !isEntryName(e.name)) continue;
+            const st = c.dir.statFile(e.name) catch |err| switch (err) {
+                error.FileNotFound => continue,
+                else => return err,
+            };
+            total += st.size;
+            if (target == null) continue;
+            var item: Item = .{ .name = undefined, .mtime = st.mtime, .size = st.size };
+            @memcpy(&item.name, e.name);
+            try items.append(c.allocator, item);
+        }
+        const limit = target orelse return total;
+        std.mem.sort(Item, items.items, {}, Item.older);
+        for (items.items) |item| {
+            if (total <= limit) break;
+            c.dir.deleteFile(&item.name) catch |err| switch (err) {
+                error.FileNotFound => {},
+                else => return err,
+            };
+            total -= item.size;
+        }
+        return total;
+    }
+    fn entryName(key: u64, buf: *[name_len]u8) []const u8 {
+        return std.fmt.bufPrint(buf, "{x:0>16}.omc", .{key}) catch unreachable;
+    }
+    fn isEntryName(name: []const u8) bool {
+        return name.len == name_len and std.mem.endsWith(u8, name, ".omc");
+    }
+};